@@ -17,6 +17,7 @@
 #include "ChiObjectFactory.h"
 
 #include "chi_mpi.h"
+#include "mpi/chi_mpi_utils.h"
 #include "chi_log.h"
 #include "utils/chi_timer.h"
 
@@ -58,6 +59,8 @@ bool Chi::run_time::allow_petsc_error_handler_ = false;
 bool Chi::run_time::supress_beg_end_timelog_ = false;
 bool Chi::run_time::suppress_color_ = false;
 bool Chi::run_time::dump_registry_ = false;
+bool Chi::run_time::print_timing_report_ = false;
+size_t Chi::run_time::num_mesh_threads_ = 1;
 
 const std::string Chi::run_time::command_line_help_string_ =
   "\nUsage: exe inputfile [options values]\n"
@@ -72,6 +75,14 @@ const std::string Chi::run_time::command_line_help_string_ =
   "     --suppress_color            Suppresses the printing of color.\n"
   "                                 useful for unit tests requiring a diff.\n"
   "     --dump-object-registry      Dumps the object registry.\n"
+  "     --timing_report             Prints the timing blocks reduced over\n"
+  "                                 all locations at the end of execution.\n"
+  "     --sparse_all_to_all         Uses the sparse non-blocking consensus\n"
+  "                                 algorithm (NBX) for the all-to-all\n"
+  "                                 exchanges of variable sized lists.\n"
+  "     --mesh_threads N            Number of threads each location uses\n"
+  "                                 for mesh operations such as building\n"
+  "                                 the connectivity of meshes. Default 1.\n"
   "\n\n\n";
 
 // ############################################### Argument parser
@@ -106,6 +117,39 @@ void Chi::run_time::ParseArguments(int argc, char** argv)
     {
       Chi::run_time::suppress_color_ = true;
     }
+    else if (argument.find("--timing_report") != std::string::npos)
+    {
+      Chi::run_time::print_timing_report_ = true;
+    }
+    else if (argument.find("--sparse_all_to_all") != std::string::npos)
+    {
+      chi_mpi_utils::SetMapAllToAllAlgorithm(
+        chi_mpi_utils::AllToAllAlgorithm::NBX);
+    }
+    else if (argument.find("--mesh_threads") != std::string::npos)
+    {
+      int num_threads = 0;
+      if ((i + 1) < argc)
+      {
+        try
+        {
+          num_threads = std::stoi(std::string(argv[i + 1]));
+        }
+        catch (const std::exception&)
+        {
+          num_threads = 0;
+        }
+      }
+      if (num_threads < 1)
+      {
+        std::cerr << "Invalid option used with command line argument "
+                     "--mesh_threads. A positive integer is required."
+                  << std::endl;
+        Chi::Exit(EXIT_FAILURE);
+      }
+      Chi::run_time::num_mesh_threads_ = static_cast<size_t>(num_threads);
+      ++i;
+    }
     else if (argument.find("--dump-object-registry") != std::string::npos)
     {
       Chi::run_time::dump_registry_ = true;
@@ -174,13 +218,18 @@ int Chi::Initialize(int argc, char** argv, MPI_Comm communicator)
 {
   int location_id = 0, number_processes = 1;
 
-  MPI_Init(&argc, &argv);                         /* starts MPI */
+  // Worker threads (e.g. threaded sweeps) never call MPI, only the main
+  // thread does, hence FUNNELED is sufficient.
+  int mpi_thread_support = MPI_THREAD_SINGLE;
+  MPI_Init_thread(
+    &argc, &argv, MPI_THREAD_FUNNELED, &mpi_thread_support); /* starts MPI */
   MPI_Comm_rank(communicator, &location_id);      /* get cur process id */
   MPI_Comm_size(communicator, &number_processes); /* get num of processes */
 
   mpi.SetCommunicator(communicator);
   mpi.SetLocationID(location_id);
   mpi.SetProcessCount(number_processes);
+  mpi.SetThreadSupport(mpi_thread_support);
 
   Chi::console.LoadRegisteredLuaItems();
   Chi::console.PostMPIInfo(location_id, number_processes);
@@ -217,6 +266,11 @@ void Chi::Finalize()
 {
   auto& t_main = Chi::log.GetTimingBlock("ChiTech");
   t_main.TimeSectionEnd();
+  if (run_time::print_timing_report_)
+  {
+    const std::string report = Chi::log.MakeGlobalTimingReportString();
+    Chi::log.Log() << "\nTiming report:\n" << report;
+  }
   chi::SystemWideEventPublisher::GetInstance().PublishEvent(chi::Event(
     "ProgramExecuted", chi::GetStandardEventCode("ProgramExecuted")));
   meshhandler_stack.clear();
@@ -111,6 +111,8 @@ public:
     static bool supress_beg_end_timelog_;
     static bool suppress_color_;
     static bool dump_registry_;
+    static bool print_timing_report_;
+    static size_t num_mesh_threads_;
 
     static const std::string command_line_help_string_;
 
@@ -95,6 +95,29 @@ public:
     return value;
   }
 
+  /**Writes the size of a vector followed by its values. The template type
+   * `T` must be trivially copyable.*/
+  template <typename T>
+  void WriteVector(const std::vector<T>& values)
+  {
+    Write<size_t>(values.size());
+    for (const T& value : values)
+      Write<T>(value);
+  }
+
+  /**Reads a vector written with `WriteVector`, starting at the internal
+   * address marker.*/
+  template <typename T>
+  std::vector<T> ReadVector()
+  {
+    const size_t num_values = Read<size_t>();
+    std::vector<T> values;
+    values.reserve(num_values);
+    for (size_t i = 0; i < num_values; ++i)
+      values.push_back(Read<T>());
+    return values;
+  }
+
   /**Appends a `ByteArray` to the current internal byte array.*/
   void Append(const ByteArray& other_raw)
   {
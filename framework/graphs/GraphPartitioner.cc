@@ -15,4 +15,13 @@ GraphPartitioner::GraphPartitioner(const InputParameters& params)
 {
 }
 
+std::vector<int64_t> GraphPartitioner::WeightedPartition(
+  const std::vector<std::vector<uint64_t>>& graph,
+  const std::vector<chi_mesh::Vector3>& centroids,
+  int number_of_parts,
+  const GraphWeights&)
+{
+  return Partition(graph, centroids, number_of_parts);
+}
+
 } // namespace chi
@@ -12,6 +12,18 @@ struct Vector3;
 namespace chi
 {
 
+/**Optional weights for a graph. Vertex weights are stored vertex-major with
+ * `num_constraints` entries per vertex. Edge weights, when not empty, have
+ * the same layout as the graph.*/
+struct GraphWeights
+{
+  size_t num_constraints = 1;
+  std::vector<int64_t> vertex_weights;
+  std::vector<std::vector<int64_t>> edge_weights;
+
+  bool Empty() const { return vertex_weights.empty() and edge_weights.empty(); }
+};
+
 /**Abstract base class for all partitioners*/
 class GraphPartitioner : public ChiObject
 {
@@ -22,6 +34,14 @@ public:
             const std::vector<chi_mesh::Vector3>& centroids,
             int number_of_parts) = 0;
 
+  /**Given a graph and its weights. Returns the partition ids of each row in
+   * the graph. Partitioners that cannot make use of weights ignore them.*/
+  virtual std::vector<int64_t>
+  WeightedPartition(const std::vector<std::vector<uint64_t>>& graph,
+                    const std::vector<chi_mesh::Vector3>& centroids,
+                    int number_of_parts,
+                    const GraphWeights& weights);
+
 protected:
   static InputParameters GetInputParameters();
   explicit GraphPartitioner(const InputParameters& params);
@@ -9,6 +9,7 @@
 #include "chi_log.h"
 
 #include <cmath>
+#include <map>
 
 namespace chi
 {
@@ -41,6 +42,13 @@ InputParameters KBAGraphPartitioner::GetInputParameters()
     std::vector<double>{},
     "Location of the internal z-cuts. Require nz-1 entries");
 
+  params.AddOptionalParameter(
+    "optimize_cuts",
+    false,
+    "If true, the cuts are computed such that each slab in each direction "
+    "carries approximately the same cell weight (the cell count when no "
+    "weights are supplied). Any supplied cuts are then ignored.");
+
   return params;
 }
 
@@ -52,6 +60,7 @@ KBAGraphPartitioner::KBAGraphPartitioner(const InputParameters& params)
     xcuts_(params.GetParamVectorValue<double>("xcuts")),
     ycuts_(params.GetParamVectorValue<double>("ycuts")),
     zcuts_(params.GetParamVectorValue<double>("zcuts")),
+    optimize_cuts_(params.GetParamValue<bool>("optimize_cuts")),
     coordinate_infos_{CoordinateInfo{&xcuts_, nx_, "x"},
                       CoordinateInfo{&ycuts_, ny_, "y"},
                       CoordinateInfo{&zcuts_, nz_, "z"}}
@@ -60,7 +69,11 @@ KBAGraphPartitioner::KBAGraphPartitioner(const InputParameters& params)
   {
     const auto& cuts = *cuts_ptr;
 
+    ChiInvalidArgumentIf(n == 0,
+                         "Parameter \"n" + name + "\" must be at least 1.");
+
     //======================= Check number of items
+    if (optimize_cuts_) continue;
     if (cuts.size() != (n - 1))
       ChiInvalidArgument("The number of cuts supplied for \"" + name +
                          "cuts\" is not equal to n" + name + "-1.");
@@ -85,6 +98,15 @@ std::vector<int64_t>
 KBAGraphPartitioner::Partition(const std::vector<std::vector<uint64_t>>& graph,
                                const std::vector<chi_mesh::Vector3>& centroids,
                                int number_of_parts)
+{
+  return WeightedPartition(graph, centroids, number_of_parts, {});
+}
+
+std::vector<int64_t> KBAGraphPartitioner::WeightedPartition(
+  const std::vector<std::vector<uint64_t>>& graph,
+  const std::vector<chi_mesh::Vector3>& centroids,
+  int number_of_parts,
+  const GraphWeights& weights)
 {
   Chi::log.Log0Verbose1() << "Partitioning with KBAGraphPartitioner";
 
@@ -92,6 +114,29 @@ KBAGraphPartitioner::Partition(const std::vector<std::vector<uint64_t>>& graph,
     centroids.size() != graph.size(),
     "Graph number of entries not equal to centroids' number of entries.");
   const size_t num_cells = graph.size();
+
+  //============================================= Determine cuts
+  std::array<std::vector<double>, 3> all_cuts = {xcuts_, ycuts_, zcuts_};
+  if (optimize_cuts_)
+  {
+    // Only the first constraint is used to balance the cuts
+    std::vector<int64_t> cell_weights(num_cells, 1);
+    if (not weights.vertex_weights.empty())
+    {
+      ChiInvalidArgumentIf(weights.vertex_weights.size() !=
+                             num_cells * weights.num_constraints,
+                           "Number of vertex weights not equal to the number "
+                           "of graph entries times the number of "
+                           "constraints.");
+      for (size_t c = 0; c < num_cells; ++c)
+        cell_weights[c] = weights.vertex_weights[c * weights.num_constraints];
+    }
+
+    for (size_t i = 0; i < 3; ++i)
+      all_cuts[i] = ComputeBalancedCuts(
+        centroids, cell_weights, i, coordinate_infos_[i].n_);
+  }
+
   std::vector<int64_t> pids(num_cells, 0);
   for (size_t c = 0; c < num_cells; ++c)
   {
@@ -100,7 +145,7 @@ KBAGraphPartitioner::Partition(const std::vector<std::vector<uint64_t>>& graph,
     std::array<size_t, 3> p_vals = {0, 0, 0};
     for (size_t i = 0; i < 3; ++i)
     {
-      const auto& cuts = *coordinate_infos_[i].cuts_;
+      const auto& cuts = all_cuts[i];
       const size_t num_cuts = cuts.size();
 
       size_t p_val;
@@ -148,4 +193,56 @@ KBAGraphPartitioner::Partition(const std::vector<std::vector<uint64_t>>& graph,
   return real_pids;
 }
 
+std::vector<double> KBAGraphPartitioner::ComputeBalancedCuts(
+  const std::vector<chi_mesh::Vector3>& centroids,
+  const std::vector<int64_t>& cell_weights,
+  size_t coordinate_index,
+  size_t n)
+{
+  if (n <= 1) return {};
+
+  //============================================= Accumulate the weight at each
+  //                                              distinct coordinate
+  std::map<double, double> coord_weights;
+  double total_weight = 0.0;
+  for (size_t c = 0; c < centroids.size(); ++c)
+  {
+    const auto w = static_cast<double>(cell_weights[c]);
+    coord_weights[centroids[c][coordinate_index]] += w;
+    total_weight += w;
+  }
+
+  //============================================= Cut midway between the
+  //                                              coordinates where the
+  //                                              running weight passes each
+  //                                              target
+  std::vector<double> cuts;
+  cuts.reserve(n - 1);
+  double running_weight = 0.0;
+  for (auto it = coord_weights.begin(); it != coord_weights.end(); ++it)
+  {
+    running_weight += it->second;
+    const auto next = std::next(it);
+    if (next == coord_weights.end()) break;
+
+    const double target =
+      total_weight * static_cast<double>(cuts.size() + 1) /
+      static_cast<double>(n);
+    if (running_weight >= target)
+    {
+      cuts.push_back(0.5 * (it->first + next->first));
+      if (cuts.size() == n - 1) break;
+    }
+  }
+
+  //============================================= Too few distinct coordinates
+  // Slabs without cells are placed beyond the last centroid
+  const double last_coord =
+    coord_weights.empty() ? 0.0 : coord_weights.rbegin()->first;
+  while (cuts.size() < n - 1)
+    cuts.push_back(last_coord + static_cast<double>(cuts.size() + 1));
+
+  return cuts;
+}
+
 } // namespace chi
\ No newline at end of file
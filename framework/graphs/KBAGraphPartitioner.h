@@ -4,6 +4,7 @@
 #include "GraphPartitioner.h"
 
 #include "array"
+#include <string>
 
 namespace chi
 {
@@ -19,9 +20,24 @@ public:
             const std::vector<chi_mesh::Vector3>& centroids,
             int number_of_parts) override;
 
+  std::vector<int64_t>
+  WeightedPartition(const std::vector<std::vector<uint64_t>>& graph,
+                    const std::vector<chi_mesh::Vector3>& centroids,
+                    int number_of_parts,
+                    const GraphWeights& weights) override;
+
 protected:
+  /**Computes n-1 cuts along a coordinate such that each of the n slabs
+   * carries approximately the same total weight.*/
+  static std::vector<double>
+  ComputeBalancedCuts(const std::vector<chi_mesh::Vector3>& centroids,
+                      const std::vector<int64_t>& cell_weights,
+                      size_t coordinate_index,
+                      size_t n);
+
   const size_t nx_, ny_, nz_;
   const std::vector<double> xcuts_, ycuts_, zcuts_;
+  const bool optimize_cuts_;
 
   struct CoordinateInfo
   {
@@ -32,10 +32,31 @@ PETScGraphPartitioner::PETScGraphPartitioner(const InputParameters& params)
 
 std::vector<int64_t> PETScGraphPartitioner::Partition(
   const std::vector<std::vector<uint64_t>>& graph,
-  const std::vector<chi_mesh::Vector3>&,
+  const std::vector<chi_mesh::Vector3>& centroids,
   int number_of_parts)
+{
+  return WeightedPartition(graph, centroids, number_of_parts, {});
+}
+
+std::vector<int64_t> PETScGraphPartitioner::WeightedPartition(
+  const std::vector<std::vector<uint64_t>>& graph,
+  const std::vector<chi_mesh::Vector3>&,
+  int number_of_parts,
+  const GraphWeights& weights)
 {
   Chi::log.Log0Verbose1() << "Partitioning with PETScGraphPartitioner";
+
+  const bool has_vertex_weights = not weights.vertex_weights.empty();
+  const bool has_edge_weights = not weights.edge_weights.empty();
+  ChiInvalidArgumentIf(has_vertex_weights and
+                         weights.vertex_weights.size() !=
+                           graph.size() * weights.num_constraints,
+                       "Number of vertex weights not equal to the number of "
+                       "graph entries times the number of constraints.");
+  ChiInvalidArgumentIf(has_edge_weights and
+                         weights.edge_weights.size() != graph.size(),
+                       "Number of edge weight rows not equal to the number "
+                       "of graph entries.");
   //================================================== Determine avg num faces
   //                                                   per cell
   // This is done so we can reserve size better
@@ -85,6 +106,22 @@ std::vector<int64_t> PETScGraphPartitioner::Partition(
     for (int64_t j = 0; j < static_cast<int64_t>(j_indices.size()); ++j)
       j_indices_raw[j] = j_indices[j];
 
+    //======================================== Copy edge weights
+    // Stored in the same layout as j_indices. The adjacency matrix takes
+    // ownership.
+    int64_t* edge_weights_raw = nullptr;
+    if (has_edge_weights)
+    {
+      PetscMalloc(j_indices.size() * sizeof(int64_t), &edge_weights_raw);
+      size_t k = 0;
+      for (const auto& row_weights : weights.edge_weights)
+        for (const int64_t w : row_weights)
+          edge_weights_raw[k++] = w;
+
+      ChiLogicalErrorIf(k != j_indices.size(),
+                        "Edge weights do not match the graph.");
+    }
+
     Chi::log.Log0Verbose1() << "Done copying to raw indices.";
 
     //========================================= Create adjacency matrix
@@ -94,7 +131,7 @@ std::vector<int64_t> PETScGraphPartitioner::Partition(
                     (int64_t)num_raw_cells,
                     i_indices_raw,
                     j_indices_raw,
-                    nullptr,
+                    edge_weights_raw,
                     &Adj);
 
     Chi::log.Log0Verbose1() << "Done creating adjacency matrix.";
@@ -106,6 +143,20 @@ std::vector<int64_t> PETScGraphPartitioner::Partition(
     MatPartitioningSetAdjacency(part, Adj);
     MatPartitioningSetType(part, type_.c_str());
     MatPartitioningSetNParts(part, number_of_parts);
+    if (has_edge_weights) MatPartitioningSetUseEdgeWeights(part, PETSC_TRUE);
+    if (has_vertex_weights)
+    {
+      // The partitioning takes ownership
+      int64_t* vertex_weights_raw;
+      PetscMalloc(weights.vertex_weights.size() * sizeof(int64_t),
+                  &vertex_weights_raw);
+      for (size_t k = 0; k < weights.vertex_weights.size(); ++k)
+        vertex_weights_raw[k] = weights.vertex_weights[k];
+
+      MatPartitioningSetNumberVertexWeights(
+        part, static_cast<int64_t>(weights.num_constraints));
+      MatPartitioningSetVertexWeights(part, vertex_weights_raw);
+    }
     MatPartitioningApply(part, &is);
     MatPartitioningDestroy(&part);
     MatDestroy(&Adj);
@@ -17,6 +17,12 @@ public:
             const std::vector<chi_mesh::Vector3>& centroids,
             int number_of_parts) override;
 
+  std::vector<int64_t>
+  WeightedPartition(const std::vector<std::vector<uint64_t>>& graph,
+                    const std::vector<chi_mesh::Vector3>& centroids,
+                    int number_of_parts,
+                    const GraphWeights& weights) override;
+
 protected:
   const std::string type_;
 };
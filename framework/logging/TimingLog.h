@@ -12,6 +12,21 @@ namespace chi
 
 class TimingBlock;
 
+/**Timing of a timing block reduced over all the locations. Times are in
+ * seconds. Locations where the block does not exist contribute zero.*/
+struct TimingReportEntry
+{
+  std::string path; ///< Names from the root block, separated by "/"
+  std::string name;
+  size_t depth = 0;
+  double average_occurences = 0.0;
+  double min_time = 0.0;
+  double average_time = 0.0;
+  double max_time = 0.0;
+  int max_location = 0; ///< Location with the maximum time
+  double imbalance = 1.0; ///< Maximum time divided by the average time
+};
+
 /**Utility class for defining time logs.*/
 class TimingLog
 {
@@ -34,6 +49,17 @@ public:
    * `std::invalid_argument`.*/
   TimingBlock& GetTimingBlock(const std::string& name);
 
+  /**Reduces the total time of every timing block, in the hierarchy of the
+   * "ChiTech" block, over all the locations. Blocks existing on only some
+   * of the locations are included. Must be called by all the locations.*/
+  std::vector<TimingReportEntry> MakeGlobalTimingReport();
+  /**Makes a string table of the global timing report. Must be called by
+   * all the locations.*/
+  std::string MakeGlobalTimingReportString();
+  /**Makes a JSON string of the global timing report. Must be called by
+   * all the locations.*/
+  std::string MakeGlobalTimingReportJSON();
+
 protected:
   std::map<std::string, std::unique_ptr<TimingBlock>> timing_blocks_;
 };
@@ -69,6 +95,9 @@ public:
 
 protected:
   friend class TimingLog;
+  /**Returns the total time, including the time since the last section
+   * began if the block is the root block and has not ended yet.*/
+  double ReportTime() const;
   /**Adds the supplied timing black as a child.*/
   void AddChild(const TimingBlock& child_block);
   /**Used when building the graph, this is a recursive function that adds
@@ -0,0 +1,285 @@
+#include "TimingLog.h"
+
+#include "utils/chi_timer.h"
+
+#include "chi_runtime.h"
+#include "chi_mpi.h"
+
+#include "chi_log_exceptions.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace chi
+{
+
+// ##################################################################
+double TimingBlock::ReportTime() const
+{
+  if (name_ == "ChiTech" and num_occurences_ == 0)
+    return Chi::program_timer.GetTime() - reference_time_;
+
+  return total_time_;
+}
+
+// ##################################################################
+std::vector<TimingReportEntry> TimingLog::MakeGlobalTimingReport()
+{
+  //================================================== Local hierarchy
+  struct LocalEntry
+  {
+    std::string path;
+    size_t depth;
+    const TimingBlock* block;
+  };
+  std::vector<LocalEntry> local_entries;
+
+  auto root_iter = timing_blocks_.find("ChiTech");
+  ChiLogicalErrorIf(root_iter == timing_blocks_.end(),
+                    "Could not find the \"ChiTech\" timing block.");
+
+  std::vector<LocalEntry> stack = {{"ChiTech", 0, root_iter->second.get()}};
+  while (not stack.empty())
+  {
+    const LocalEntry entry = stack.back();
+    stack.pop_back();
+    local_entries.push_back(entry);
+
+    const auto& children = entry.block->children_;
+    for (auto child = children.rbegin(); child != children.rend(); ++child)
+      stack.push_back({entry.path + "/" + (*child)->name_,
+                       entry.depth + 1,
+                       *child});
+  }
+
+  //================================================== Gather all the paths
+  std::string local_paths;
+  for (const auto& entry : local_entries)
+    local_paths.append(entry.path).append("\n");
+
+  const int local_size = static_cast<int>(local_paths.size());
+  std::vector<int> sizes(Chi::mpi.process_count, 0);
+  MPI_Allgather(&local_size, 1, MPI_INT, sizes.data(), 1, MPI_INT,
+                Chi::mpi.comm);
+
+  std::vector<int> displacements(Chi::mpi.process_count, 0);
+  for (int p = 1; p < Chi::mpi.process_count; ++p)
+    displacements[p] = displacements[p - 1] + sizes[p - 1];
+
+  std::string global_paths(displacements.back() + sizes.back(), '\0');
+  MPI_Allgatherv(local_paths.data(), local_size, MPI_CHAR,
+                 global_paths.data(), sizes.data(), displacements.data(),
+                 MPI_CHAR, Chi::mpi.comm);
+
+  //================================================== Build the union
+  // Every location lists a parent before its children, hence processing
+  // the lists in location order always finds the parent of a new path.
+  std::map<std::string, std::vector<std::string>> children_of;
+  {
+    std::stringstream paths_stream(global_paths);
+    std::string path;
+    while (std::getline(paths_stream, path))
+    {
+      if (children_of.count(path) > 0) continue;
+      children_of[path];
+
+      const size_t separator = path.rfind('/');
+      if (separator != std::string::npos)
+        children_of[path.substr(0, separator)].push_back(path);
+    }
+  }
+
+  std::vector<TimingReportEntry> report;
+  std::vector<std::string> path_stack = {"ChiTech"};
+  while (not path_stack.empty())
+  {
+    const std::string path = path_stack.back();
+    path_stack.pop_back();
+
+    TimingReportEntry entry;
+    entry.path = path;
+    entry.name = path.substr(path.rfind('/') + 1);
+    entry.depth = std::count(path.begin(), path.end(), '/');
+    report.push_back(std::move(entry));
+
+    const auto& children = children_of.at(path);
+    path_stack.insert(path_stack.end(), children.rbegin(), children.rend());
+  }
+
+  //================================================== Reduce the timings
+  const size_t num_entries = report.size();
+
+  std::map<std::string, const TimingBlock*> local_blocks;
+  for (const auto& entry : local_entries)
+    local_blocks[entry.path] = entry.block;
+
+  struct DoubleInt
+  {
+    double value;
+    int location;
+  };
+  std::vector<double> local_times(num_entries, 0.0);
+  std::vector<double> local_occurences(num_entries, 0.0);
+  std::vector<DoubleInt> local_maxloc(num_entries);
+  for (size_t e = 0; e < num_entries; ++e)
+  {
+    auto iter = local_blocks.find(report[e].path);
+    if (iter != local_blocks.end())
+    {
+      local_times[e] = iter->second->ReportTime() / 1000.0;
+      local_occurences[e] =
+        static_cast<double>(iter->second->NumberOfOccurences());
+    }
+    local_maxloc[e] = {local_times[e], Chi::mpi.location_id};
+  }
+
+  std::vector<double> min_times(num_entries, 0.0);
+  std::vector<double> sum_times(num_entries, 0.0);
+  std::vector<double> sum_occurences(num_entries, 0.0);
+  std::vector<DoubleInt> maxloc(num_entries);
+
+  const int n = static_cast<int>(num_entries);
+  MPI_Allreduce(local_times.data(), min_times.data(), n, MPI_DOUBLE,
+                MPI_MIN, Chi::mpi.comm);
+  MPI_Allreduce(local_times.data(), sum_times.data(), n, MPI_DOUBLE,
+                MPI_SUM, Chi::mpi.comm);
+  MPI_Allreduce(local_occurences.data(), sum_occurences.data(), n,
+                MPI_DOUBLE, MPI_SUM, Chi::mpi.comm);
+  MPI_Allreduce(local_maxloc.data(), maxloc.data(), n, MPI_DOUBLE_INT,
+                MPI_MAXLOC, Chi::mpi.comm);
+
+  const auto num_locations = static_cast<double>(Chi::mpi.process_count);
+  for (size_t e = 0; e < num_entries; ++e)
+  {
+    auto& entry = report[e];
+    entry.average_occurences = sum_occurences[e] / num_locations;
+    entry.min_time = min_times[e];
+    entry.average_time = sum_times[e] / num_locations;
+    entry.max_time = maxloc[e].value;
+    entry.max_location = maxloc[e].location;
+    entry.imbalance = entry.average_time > 0.0
+                        ? entry.max_time / entry.average_time
+                        : 1.0;
+  }
+
+  return report;
+}
+
+// ##################################################################
+std::string TimingLog::MakeGlobalTimingReportString()
+{
+  const auto report = MakeGlobalTimingReport();
+
+  std::vector<std::string> headers = {"Section Name",
+                                      "Avg #calls",
+                                      "Min time[s]",
+                                      "Avg time[s]",
+                                      "Max time[s]",
+                                      "Max rank",
+                                      "Imbalance"};
+  const size_t J = headers.size();
+
+  auto Format = [](const char* format, double value)
+  {
+    char buffer[32];
+    ChiLogicalErrorIf(snprintf(buffer, 32, format, value) < 0,
+                      "Failed to convert value " + std::to_string(value));
+    return std::string(buffer);
+  };
+
+  std::vector<std::vector<std::string>> string_matrix;
+  for (const auto& entry : report)
+    string_matrix.push_back({std::string(2 * entry.depth, ' ') + entry.name,
+                             Format("%.5g", entry.average_occurences),
+                             Format("%.5g", entry.min_time),
+                             Format("%.5g", entry.average_time),
+                             Format("%.5g", entry.max_time),
+                             std::to_string(entry.max_location),
+                             Format("%.3f", entry.imbalance)});
+
+  std::vector<size_t> max_col_widths(J, 0);
+  for (size_t j = 0; j < J; ++j)
+  {
+    max_col_widths[j] = headers[j].size();
+    for (const auto& row : string_matrix)
+      max_col_widths[j] = std::max(max_col_widths[j], row[j].size());
+  }
+
+  std::stringstream outstr;
+
+  auto HDIV = [&outstr, &max_col_widths, J]()
+  {
+    outstr << "*-";
+    for (size_t j = 0; j < J; ++j)
+    {
+      outstr << std::string(max_col_widths[j] + 1, '-');
+      if (j < (J - 1)) outstr << "*-";
+    }
+    outstr << "*\n";
+  };
+
+  auto Row = [&outstr, &max_col_widths, J](const std::vector<std::string>& row)
+  {
+    outstr << "| ";
+    for (size_t j = 0; j < J; ++j)
+    {
+      const size_t width = max_col_widths[j] + (j == 0 ? 0 : 1);
+      const std::string pad(width - row[j].size(), ' ');
+      if (j == 0) outstr << row[j] << pad;
+      else
+        outstr << pad << row[j];
+      outstr << " |";
+    }
+    outstr << "\n";
+  };
+
+  HDIV();
+  Row(headers);
+  HDIV();
+  for (const auto& row : string_matrix)
+    Row(row);
+  HDIV();
+
+  return outstr.str();
+}
+
+// ##################################################################
+std::string TimingLog::MakeGlobalTimingReportJSON()
+{
+  const auto report = MakeGlobalTimingReport();
+
+  auto Escape = [](const std::string& input)
+  {
+    std::string output;
+    for (const char c : input)
+    {
+      if (c == '"' or c == '\\') output += '\\';
+      output += c;
+    }
+    return output;
+  };
+
+  std::stringstream outstr;
+  outstr.precision(9);
+  outstr << "{\n  \"num_locations\": " << Chi::mpi.process_count
+         << ",\n  \"timing_blocks\": [";
+  for (size_t e = 0; e < report.size(); ++e)
+  {
+    const auto& entry = report[e];
+    outstr << (e == 0 ? "\n" : ",\n")
+           << "    {\"path\": \"" << Escape(entry.path) << "\""
+           << ", \"name\": \"" << Escape(entry.name) << "\""
+           << ", \"depth\": " << entry.depth
+           << ", \"average_occurences\": " << entry.average_occurences
+           << ", \"min_time\": " << entry.min_time
+           << ", \"average_time\": " << entry.average_time
+           << ", \"max_time\": " << entry.max_time
+           << ", \"max_location\": " << entry.max_location
+           << ", \"imbalance\": " << entry.imbalance << "}";
+  }
+  outstr << "\n  ]\n}\n";
+
+  return outstr.str();
+}
+
+} // namespace chi
@@ -5,6 +5,9 @@
 
 #include "stringstream_color.h"
 
+#include <algorithm>
+#include <cmath>
+#include <fstream>
 #include <sstream>
 
 // ###################################################################
@@ -21,13 +24,13 @@ chi::ChiLog::ChiLog() noexcept
 {
   verbosity_ = 0;
   std::string memory_usage_event("Maximum Memory Usage");
-  repeating_events.emplace_back(memory_usage_event);
+  repeating_events.emplace_back(memory_usage_event, event_history_capacity_);
 
   RepeatingEvent& ref_rep_event = repeating_events.back();
 
-  ref_rep_event.Events().emplace_back(Chi::program_timer.GetTime(),
-                                      EventType::EVENT_CREATED,
-                                      std::make_shared<EventInfo>());
+  ref_rep_event.Record(Chi::program_timer.GetTime(),
+                       EventType::EVENT_CREATED,
+                       std::make_shared<EventInfo>());
 }
 
 // ###################################################################
@@ -175,13 +178,13 @@ int chi::ChiLog::GetVerbosity() const { return verbosity_; }
 /** Returns a unique tag to a newly created repeating event.*/
 size_t chi::ChiLog::GetRepeatingEventTag(std::string event_name)
 {
-  repeating_events.emplace_back(event_name);
+  repeating_events.emplace_back(event_name, event_history_capacity_);
 
   RepeatingEvent& ref_rep_event = repeating_events.back();
 
-  ref_rep_event.Events().emplace_back(Chi::program_timer.GetTime(),
-                                      EventType::EVENT_CREATED,
-                                      std::make_shared<EventInfo>());
+  ref_rep_event.Record(Chi::program_timer.GetTime(),
+                       EventType::EVENT_CREATED,
+                       std::make_shared<EventInfo>());
 
   return repeating_events.size() - 1;
 }
@@ -200,29 +203,42 @@ size_t chi::ChiLog::GetExistingRepeatingEventTag(std::string event_name)
 }
 
 // ###################################################################
-/**Logs an event with the supplied event information.*/
-void chi::ChiLog::LogEvent(size_t ev_tag,
-                           EventType ev_type,
-                           const std::shared_ptr<EventInfo>& ev_info)
+/**Records an event. Called by LogEvent when event tracing is enabled.*/
+void chi::ChiLog::RecordEvent(size_t ev_tag,
+                              EventType ev_type,
+                              std::shared_ptr<EventInfo> ev_info)
 {
   if (ev_tag >= repeating_events.size()) return;
 
-  RepeatingEvent& ref_rep_event = repeating_events[ev_tag];
-
-  ref_rep_event.Events().emplace_back(
-    Chi::program_timer.GetTime(), ev_type, ev_info);
+  repeating_events[ev_tag].Record(
+    Chi::program_timer.GetTime(), ev_type, std::move(ev_info));
 }
 
 // ###################################################################
-/**Logs an event without any event information.*/
-void chi::ChiLog::LogEvent(size_t ev_tag, EventType ev_type)
+/**Records a begin/end pair. Called by LogEventInterval when event tracing
+ * is enabled.*/
+void chi::ChiLog::RecordEventInterval(size_t ev_tag,
+                                      double begin_time,
+                                      double end_time)
 {
   if (ev_tag >= repeating_events.size()) return;
 
-  RepeatingEvent& ref_rep_event = repeating_events[ev_tag];
+  auto& ref_rep_event = repeating_events[ev_tag];
+  ref_rep_event.Record(begin_time, EventType::EVENT_BEGIN, nullptr);
+  ref_rep_event.Record(end_time, EventType::EVENT_END, nullptr);
+}
 
-  ref_rep_event.Events().emplace_back(
-    Chi::program_timer.GetTime(), ev_type, nullptr);
+// ###################################################################
+/**Sets the number of events retained by each repeating event, existing
+ * and future. Existing histories keep their most recent events.*/
+void chi::ChiLog::SetEventHistoryCapacity(size_t capacity)
+{
+  ChiInvalidArgumentIf(capacity == 0,
+                       "The event history capacity must be positive.");
+
+  event_history_capacity_ = capacity;
+  for (auto& repeating_event : repeating_events)
+    repeating_event.SetHistoryCapacity(capacity);
 }
 
 // ###################################################################
@@ -230,7 +246,8 @@ void chi::ChiLog::LogEvent(size_t ev_tag, EventType ev_type)
  * the tag. Each event entry will be prepended by the location id and
  * the program timestamp in seconds. This method uses the
  * ChiLog::EventInfo::GetString method to append information. This allows
- * derived classes to implement more sophisticated outputs.*/
+ * derived classes to implement more sophisticated outputs. Only the
+ * retained events are printed, see ChiLog::SetEventHistoryCapacity.*/
 std::string chi::ChiLog::PrintEventHistory(size_t ev_tag)
 {
   std::stringstream outstr;
@@ -238,7 +255,7 @@ std::string chi::ChiLog::PrintEventHistory(size_t ev_tag)
 
   RepeatingEvent& ref_rep_event = repeating_events[ev_tag];
 
-  for (auto& event : ref_rep_event.Events())
+  for (auto& event : ref_rep_event.History())
   {
     outstr << "[" << Chi::mpi.location_id << "] ";
 
@@ -269,96 +286,270 @@ std::string chi::ChiLog::PrintEventHistory(size_t ev_tag)
   return outstr.str();
 }
 
+// ###################################################################
+/**Returns a string with the aggregates of the event associated with the
+ * tag, i.e., the number of occurrences, the duration statistics and the
+ * non-empty bins of the duration histogram. Durations are in seconds.*/
+std::string chi::ChiLog::PrintEventSummary(size_t ev_tag)
+{
+  std::stringstream outstr;
+  if (ev_tag >= repeating_events.size()) return outstr.str();
+
+  const RepeatingEvent& ref_rep_event = repeating_events[ev_tag];
+  const auto& aggregates = ref_rep_event.GetAggregates();
+
+  const std::string header = "[" + std::to_string(Chi::mpi.location_id) + "] ";
+
+  outstr << header << ref_rep_event.Name() << "\n"
+         << header << "  Occurrences      " << aggregates.num_occurrences
+         << "\n";
+
+  if (aggregates.num_durations > 0)
+  {
+    const double n = static_cast<double>(aggregates.num_durations);
+    outstr << header << "  Durations        " << aggregates.num_durations
+           << "\n"
+           << header << "  Total duration   "
+           << aggregates.total_duration / 1000.0 << "\n"
+           << header << "  Average duration "
+           << aggregates.total_duration / (1000.0 * n) << "\n"
+           << header << "  Min duration     "
+           << aggregates.min_duration / 1000.0 << "\n"
+           << header << "  Max duration     "
+           << aggregates.max_duration / 1000.0 << "\n";
+
+    outstr << header << "  Duration histogram [us]\n";
+    const auto& histogram = aggregates.duration_histogram;
+    for (size_t k = 0; k < histogram.size(); ++k)
+    {
+      if (histogram[k] == 0) continue;
+
+      char buf[100];
+      if (k == 0) snprintf(buf, 100, "    %12s < %-12.0f", "", 2.0);
+      else
+        snprintf(buf, 100, "    %12.0f - %-12.0f", std::ldexp(1.0, k),
+                 std::ldexp(1.0, k + 1));
+      outstr << header << buf << histogram[k] << "\n";
+    }
+  }
+
+  return outstr.str();
+}
+
 // ###################################################################
 /**Processes an event given an event operation. See ChiLog for further
- * reference.*/
+ * reference. The values are computed from the event's aggregates,
+ * therefore all the events logged are accounted for, not only the
+ * retained ones.*/
 double chi::ChiLog::ProcessEvent(size_t ev_tag,
                                  chi::ChiLog::EventOperation ev_operation)
 {
   if (ev_tag >= repeating_events.size()) return 0.0;
 
-  RepeatingEvent& ref_rep_event = repeating_events[ev_tag];
+  const auto& aggregates = repeating_events[ev_tag].GetAggregates();
+  const double num_durations = static_cast<double>(aggregates.num_durations);
 
   double ret_val = 0.0;
   switch (ev_operation)
   {
     case EventOperation::NUMBER_OF_OCCURRENCES:
-    {
-      for (auto& event : ref_rep_event.Events())
-      {
-        if ((event.ev_type == EventType::EVENT_CREATED) or
-            (event.ev_type == EventType::SINGLE_OCCURRENCE) or
-            (event.ev_type == EventType::EVENT_BEGIN))
-          ret_val += 1.0;
-      } // for events
+      ret_val = static_cast<double>(aggregates.num_occurrences);
       break;
-    }
     case EventOperation::TOTAL_DURATION:
-    {
-      double start_time = 0.0;
-      for (auto& event : ref_rep_event.Events())
-      {
-        if (event.ev_type == EventType::EVENT_BEGIN) start_time = event.ev_time;
-        if (event.ev_type == EventType::EVENT_END)
-          ret_val += event.ev_time - start_time;
-      } // for events
-      ret_val *= 1000.0;
+      ret_val = aggregates.total_duration * 1000.0;
       break;
-    }
     case EventOperation::AVERAGE_DURATION:
-    {
-      double start_time = 0.0;
-      int counter = 0;
-      for (auto& event : ref_rep_event.Events())
-      {
-        if (event.ev_type == EventType::EVENT_BEGIN) start_time = event.ev_time;
-
-        if (event.ev_type == EventType::EVENT_END)
-        {
-          ret_val += event.ev_time - start_time;
-          counter++;
-        }
-      } // for events
-      ret_val /= (1000.0 * counter);
+      if (aggregates.num_durations > 0)
+        ret_val = aggregates.total_duration / (1000.0 * num_durations);
       break;
-    }
     case EventOperation::MAX_VALUE:
-    {
-      ret_val = 0.0;
-      for (auto& event : ref_rep_event.Events())
-      {
-        if ((event.ev_type == EventType::SINGLE_OCCURRENCE) or
-            (event.ev_type == EventType::EVENT_BEGIN) or
-            (event.ev_type == EventType::EVENT_END))
-        {
-          if (event.ev_info != nullptr)
-            ret_val = std::max(event.ev_info->arb_value, ret_val);
-        }
-      } // for events
+      ret_val = aggregates.value_max;
       break;
-    }
     case EventOperation::AVERAGE_VALUE:
     {
-      ret_val = 0.0;
-      int count = 0;
-      for (auto& event : ref_rep_event.Events())
-      {
-        if ((event.ev_type == EventType::SINGLE_OCCURRENCE) or
-            (event.ev_type == EventType::EVENT_BEGIN) or
-            (event.ev_type == EventType::EVENT_END))
-        {
-          if (event.ev_info != nullptr)
-          {
-            ret_val += event.ev_info->arb_value;
-            ++count;
-          }
-        }
-      } // for events
-      if (count == 0) count = 1;
-      ret_val /= count;
+      const size_t count = std::max<size_t>(aggregates.num_values, 1);
+      ret_val = aggregates.value_sum / static_cast<double>(count);
       break;
     }
+    case EventOperation::MIN_DURATION:
+      ret_val = aggregates.min_duration / 1000.0;
+      break;
+    case EventOperation::MAX_DURATION:
+      ret_val = aggregates.max_duration / 1000.0;
+      break;
   } // switch
 
   return ret_val;
 }
+
+// ###################################################################
+/**Writes the retained events of all the repeating events to a file in
+ * the Chrome/Perfetto trace-event JSON format. Begin and end events become
+ * duration events, single occurrences instant events, and the location id
+ * is used as process id. Must be called by all the locations; the events
+ * are gathered to location 0 which writes the file.*/
+void chi::ChiLog::ExportEventTrace(const std::string& file_name)
+{
+  //================================================== Sort local events
+  struct TraceEvent
+  {
+    double time;
+    size_t tag;
+    const Event* event;
+  };
+  std::vector<std::vector<Event>> histories;
+  histories.reserve(repeating_events.size());
+  std::vector<TraceEvent> trace_events;
+  for (size_t tag = 0; tag < repeating_events.size(); ++tag)
+  {
+    histories.push_back(repeating_events[tag].History());
+    for (const auto& event : histories.back())
+      if (event.ev_type != EventType::EVENT_CREATED)
+        trace_events.push_back({event.ev_time, tag, &event});
+  }
+  std::stable_sort(trace_events.begin(), trace_events.end(),
+                   [](const TraceEvent& a, const TraceEvent& b)
+                   { return a.time < b.time; });
+
+  //================================================== Serialize
+  auto Escape = [](const std::string& input)
+  {
+    std::string output;
+    output.reserve(input.size());
+    for (const char c : input)
+    {
+      if (c == '"' or c == '\\') output += '\\';
+      if (static_cast<unsigned char>(c) < 0x20) output += ' ';
+      else output += c;
+    }
+    return output;
+  };
+
+  std::stringstream local_json;
+  char buf[64];
+  for (const auto& [time, tag, event] : trace_events)
+  {
+    const char* phase = "i";
+    if (event->ev_type == EventType::EVENT_BEGIN) phase = "B";
+    if (event->ev_type == EventType::EVENT_END) phase = "E";
+
+    snprintf(buf, 64, "%.3f", time * 1000.0);
+    local_json << ",\n{\"name\":\"" << Escape(repeating_events[tag].Name())
+               << "\",\"ph\":\"" << phase << "\",\"ts\":" << buf
+               << ",\"pid\":" << Chi::mpi.location_id << ",\"tid\":0";
+    if (event->ev_type == EventType::SINGLE_OCCURRENCE)
+      local_json << ",\"s\":\"t\"";
+    if (event->ev_info != nullptr)
+      local_json << ",\"args\":{\"info\":\""
+                 << Escape(event->ev_info->GetString())
+                 << "\",\"value\":" << event->ev_info->arb_value << "}";
+    local_json << "}";
+  }
+
+  //================================================== Gather to location 0
+  const std::string local_str = local_json.str();
+  const int local_size = static_cast<int>(local_str.size());
+
+  std::vector<int> sizes(Chi::mpi.process_count, 0);
+  MPI_Gather(&local_size, 1, MPI_INT,
+             sizes.data(), 1, MPI_INT, 0, Chi::mpi.comm);
+
+  std::vector<int> displacements(Chi::mpi.process_count, 0);
+  for (int p = 1; p < Chi::mpi.process_count; ++p)
+    displacements[p] = displacements[p - 1] + sizes[p - 1];
+
+  std::string global_str;
+  if (Chi::mpi.location_id == 0)
+    global_str.resize(displacements.back() + sizes.back());
+
+  MPI_Gatherv(local_str.data(), local_size, MPI_CHAR,
+              global_str.data(), sizes.data(), displacements.data(), MPI_CHAR,
+              0, Chi::mpi.comm);
+
+  if (Chi::mpi.location_id != 0) return;
+
+  std::ofstream file(file_name);
+  ChiLogicalErrorIf(not file.is_open(),
+                    "Failed to open \"" + file_name + "\" for writing.");
+
+  // Every entry starts with a comma, hence the first one is dropped
+  file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+       << (global_str.empty() ? global_str : global_str.substr(2))
+       << "\n]}\n";
+
+  Log() << "Event trace exported to \"" << file_name << "\"";
+}
+
+// ###################################################################
+/**Records an event, updating the aggregates and the history.*/
+void chi::ChiLog::RepeatingEvent::Record(double time,
+                                         EventType type,
+                                         std::shared_ptr<EventInfo> info)
+{
+  //================================================== Aggregates
+  if (type != EventType::EVENT_END) ++aggregates_.num_occurrences;
+  if (type == EventType::EVENT_BEGIN) begin_time_ = time;
+  if (type == EventType::EVENT_END)
+  {
+    const double duration = time - begin_time_;
+
+    if (aggregates_.num_durations == 0)
+      aggregates_.min_duration = aggregates_.max_duration = duration;
+    aggregates_.min_duration = std::min(aggregates_.min_duration, duration);
+    aggregates_.max_duration = std::max(aggregates_.max_duration, duration);
+    aggregates_.total_duration += duration;
+    ++aggregates_.num_durations;
+
+    // Durations are in milliseconds, bins in powers of 2 microseconds
+    const double microseconds = duration * 1000.0;
+    size_t bin = 0;
+    if (microseconds >= 2.0)
+      bin = std::min(static_cast<size_t>(std::ilogb(microseconds)),
+                     NUM_HISTOGRAM_BINS - 1);
+    ++aggregates_.duration_histogram[bin];
+  }
+  if (type != EventType::EVENT_CREATED and info != nullptr)
+  {
+    ++aggregates_.num_values;
+    aggregates_.value_sum += info->arb_value;
+    aggregates_.value_max = std::max(aggregates_.value_max, info->arb_value);
+  }
+
+  //================================================== History
+  auto& slot = history_[history_next_];
+  slot.ev_time = time;
+  slot.ev_type = type;
+  slot.ev_info = std::move(info);
+
+  history_next_ = (history_next_ + 1) % history_.size();
+  history_size_ = std::min(history_size_ + 1, history_.size());
+}
+
+// ###################################################################
+/**Returns the retained events, oldest first.*/
+std::vector<chi::ChiLog::Event> chi::ChiLog::RepeatingEvent::History() const
+{
+  std::vector<Event> events;
+  events.reserve(history_size_);
+
+  const size_t capacity = history_.size();
+  const size_t first = (history_next_ + capacity - history_size_) % capacity;
+  for (size_t k = 0; k < history_size_; ++k)
+    events.push_back(history_[(first + k) % capacity]);
+
+  return events;
+}
+
+// ###################################################################
+/**Changes the number of retained events, keeping the most recent ones.*/
+void chi::ChiLog::RepeatingEvent::SetHistoryCapacity(size_t capacity)
+{
+  auto events = History();
+  if (events.size() > capacity)
+    events.erase(events.begin(), events.end() - capacity);
+
+  history_size_ = events.size();
+  history_next_ = history_size_ % capacity;
+  events.resize(capacity);
+  history_ = std::move(events);
+}
@@ -5,6 +5,7 @@
 #include "chi_log_exceptions.h"
 #include "TimingLog.h"
 
+#include <array>
 #include <utility>
 #include <vector>
 #include <memory>
@@ -189,6 +190,26 @@ namespace chi
   [0]      3.813121000 SINGLE_OCCURRENCE B
   [0]      3.813122000 SINGLE_OCCURRENCE C
   \endverbatim
+   *
+   * ### Bounded history and aggregates
+   * Events are not stored indefinitely. Every repeating event keeps
+   * streaming aggregates (number of occurrences, total/min/max duration,
+   * a duration histogram and value statistics) from which
+   * ChiLog::ProcessEvent is computed, and only the most recent events are
+   * retained, in a fixed-size ring buffer, for ChiLog::PrintEventHistory and
+   * ChiLog::ExportEventTrace. The capacity of the ring buffers can be changed
+   * with ChiLog::SetEventHistoryCapacity. Logging an event therefore costs a
+   * timer read and a few arithmetic operations, and the memory used does not
+   * grow with the number of events logged.
+   *
+   * Event tracing can be switched off at runtime with
+   * ChiLog::SetEventTracing, after which ChiLog::LogEvent returns
+   * immediately, or at compile time by defining
+   * `CHI_DISABLE_EVENT_TRACING` (CMake option of the same name).
+   *
+   * The retained events of all the repeating events can be exported to the
+   * Chrome/Perfetto trace-event JSON format with ChiLog::ExportEventTrace,
+   * which can be opened in `chrome://tracing` or https://ui.perfetto.dev.
    * */
 class ChiLog : public TimingLog
 {
@@ -263,23 +284,66 @@ public:
     TOTAL_DURATION = 1,   ///< Integrates times between begins and ends
     AVERAGE_DURATION = 2, ///< Computes average time between begins and ends
     MAX_VALUE = 3,        ///< Computes the maximum of the EventInfo arb_value
-    AVERAGE_VALUE = 4     ///< Computes the average of the EventInfo arb_value
+    AVERAGE_VALUE = 4,    ///< Computes the average of the EventInfo arb_value
+    MIN_DURATION = 5,     ///< Shortest time between a begin and an end
+    MAX_DURATION = 6      ///< Longest time between a begin and an end
   };
   struct EventInfo;
   struct Event;
 
+  /**Default number of events retained per repeating event.*/
+  static constexpr size_t DEFAULT_EVENT_HISTORY_CAPACITY = 1024;
+
 private:
   std::vector<RepeatingEvent> repeating_events;
+  bool event_tracing_enabled_ = true;
+  size_t event_history_capacity_ = DEFAULT_EVENT_HISTORY_CAPACITY;
+
+  void RecordEvent(size_t ev_tag,
+                   EventType ev_type,
+                   std::shared_ptr<EventInfo> ev_info);
+  void RecordEventInterval(size_t ev_tag, double begin_time, double end_time);
 
 public:
   size_t GetRepeatingEventTag(std::string event_name);
   size_t GetExistingRepeatingEventTag(std::string event_name);
+
+  /**Logs an event with the supplied event information.*/
   void LogEvent(size_t ev_tag,
                 EventType ev_type,
-                const std::shared_ptr<EventInfo>& ev_info);
-  void LogEvent(size_t ev_tag, EventType ev_type);
+                const std::shared_ptr<EventInfo>& ev_info)
+  {
+#ifndef CHI_DISABLE_EVENT_TRACING
+    if (event_tracing_enabled_) RecordEvent(ev_tag, ev_type, ev_info);
+#endif
+  }
+  /**Logs an event without any event information.*/
+  void LogEvent(size_t ev_tag, EventType ev_type)
+  {
+#ifndef CHI_DISABLE_EVENT_TRACING
+    if (event_tracing_enabled_) RecordEvent(ev_tag, ev_type, nullptr);
+#endif
+  }
+
+  /**Logs an EVENT_BEGIN/EVENT_END pair with times measured elsewhere, e.g.,
+   * by a worker thread, which must not log events itself. The times are
+   * program times, see Chi::program_timer.*/
+  void LogEventInterval(size_t ev_tag, double begin_time, double end_time)
+  {
+#ifndef CHI_DISABLE_EVENT_TRACING
+    if (event_tracing_enabled_)
+      RecordEventInterval(ev_tag, begin_time, end_time);
+#endif
+  }
+
+  void SetEventTracing(bool enabled) { event_tracing_enabled_ = enabled; }
+  bool EventTracingEnabled() const { return event_tracing_enabled_; }
+  void SetEventHistoryCapacity(size_t capacity);
+
   std::string PrintEventHistory(size_t ev_tag);
+  std::string PrintEventSummary(size_t ev_tag);
   double ProcessEvent(size_t ev_tag, EventOperation ev_operation);
+  void ExportEventTrace(const std::string& file_name);
 };
 } // namespace chi
 
@@ -307,10 +371,11 @@ struct chi::ChiLog::EventInfo
 /** Object used by repeating events.*/
 struct chi::ChiLog::Event
 {
-  const double ev_time = 0.0;
-  const EventType ev_type = EventType::SINGLE_OCCURRENCE;
+  double ev_time = 0.0;
+  EventType ev_type = EventType::SINGLE_OCCURRENCE;
   std::shared_ptr<EventInfo> ev_info;
 
+  Event() = default;
   Event(double in_time,
         EventType in_ev_type,
         std::shared_ptr<EventInfo> in_event_info)
@@ -320,16 +385,45 @@ struct chi::ChiLog::Event
 };
 
 // ###################################################################
-/**Repeating event object.*/
+/**Repeating event object. Keeps streaming aggregates of all the events
+ * logged and the most recent events in a ring buffer.*/
 class chi::ChiLog::RepeatingEvent
 {
 public:
-  explicit RepeatingEvent(std::string& name) : name_(name) {}
+  /**Number of bins of the duration histogram. Bin `k > 0` counts the
+   * durations in \f$ [2^k, 2^{k+1}) \f$ microseconds, bin 0 those shorter
+   * than 2 microseconds, and the last bin also the longer ones.*/
+  static constexpr size_t NUM_HISTOGRAM_BINS = 32;
+
+  /**Statistics over all the events ever logged.*/
+  struct Aggregates
+  {
+    size_t num_occurrences = 0; ///< Creations, single occurrences and begins
+    size_t num_durations = 0;   ///< Number of ends
+    double total_duration = 0.0;
+    double min_duration = 0.0;
+    double max_duration = 0.0;
+    std::array<size_t, NUM_HISTOGRAM_BINS> duration_histogram{};
+
+    size_t num_values = 0; ///< Non-creation events with EventInfo
+    double value_sum = 0.0;
+    double value_max = 0.0;
+  };
+
+  RepeatingEvent(std::string& name, size_t history_capacity)
+    : name_(name), history_(history_capacity)
+  {
+  }
 
   const std::string& Name() const { return name_; }
 
-  std::vector<Event>& Events() { return events_; }
-  const std::vector<Event>& Events() const { return events_; }
+  void Record(double time, EventType type, std::shared_ptr<EventInfo> info);
+
+  const Aggregates& GetAggregates() const { return aggregates_; }
+
+  /**Returns the retained events, oldest first.*/
+  std::vector<Event> History() const;
+  void SetHistoryCapacity(size_t capacity);
 
   bool operator==(const RepeatingEvent& other)
   {
@@ -338,8 +432,13 @@ public:
 
 private:
   const std::string name_;
-  std::vector<Event> events_;
 
+  Aggregates aggregates_;
+  double begin_time_ = 0.0;
+
+  std::vector<Event> history_;
+  size_t history_next_ = 0;
+  size_t history_size_ = 0;
 };
 
 #endif // CHI_LOG_H
\ No newline at end of file
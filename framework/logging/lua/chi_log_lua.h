@@ -9,6 +9,10 @@ int chiLogSetVerbosity(lua_State* L);
 int chiLog(lua_State* L);
 int chiLogProcessEvent(lua_State* L);
 int chiLogPrintTimingGraph(lua_State* L);
+int chiLogSetEventTracing(lua_State* L);
+int chiLogExportEventTrace(lua_State* L);
+int chiLogPrintTimingReport(lua_State* L);
+int chiLogExportTimingReport(lua_State* L);
 } // namespace chi_log_utils::lua_utils
 
 #endif // CHITECH_CHI_LOG_LUA_H
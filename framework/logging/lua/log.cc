@@ -6,6 +6,8 @@
 #include "lua/chi_log_lua.h"
 #include "console/chi_console.h"
 
+#include <fstream>
+
 namespace chi_log_utils::lua_utils
 {
 
@@ -13,6 +15,10 @@ RegisterLuaFunctionAsIs(chiLogSetVerbosity);
 RegisterLuaFunctionAsIs(chiLog);
 RegisterLuaFunctionAsIs(chiLogProcessEvent);
 RegisterLuaFunctionAsIs(chiLogPrintTimingGraph);
+RegisterLuaFunctionAsIs(chiLogSetEventTracing);
+RegisterLuaFunctionAsIs(chiLogExportEventTrace);
+RegisterLuaFunctionAsIs(chiLogPrintTimingReport);
+RegisterLuaFunctionAsIs(chiLogExportTimingReport);
 
 RegisterLuaConstantAsIs(LOG_0, chi_data_types::Varying(1));
 RegisterLuaConstantAsIs(LOG_0WARNING, chi_data_types::Varying(2));
@@ -136,6 +142,10 @@ int chiLogProcessEvent(lua_State* L)
     event_operation = chi::ChiLog::EventOperation::MAX_VALUE;
   else if (event_operation_name == "AVERAGE_VALUE")
     event_operation = chi::ChiLog::EventOperation::AVERAGE_VALUE;
+  else if (event_operation_name == "MIN_DURATION")
+    event_operation = chi::ChiLog::EventOperation::MIN_DURATION;
+  else if (event_operation_name == "MAX_DURATION")
+    event_operation = chi::ChiLog::EventOperation::MAX_DURATION;
   else
     ChiInvalidArgument("Unsupported event operation name \"" +
                        event_operation_name + "\".");
@@ -176,4 +186,93 @@ int chiLogPrintTimingGraph(lua_State* L)
   return 0;
 }
 
-} // namespace chi_log_utils::lua_utils
\ No newline at end of file
+// ##################################################################
+/**Enables or disables the logging of repeating events. When disabled,
+ * events are neither recorded nor aggregated.
+ *
+ * \param enabled bool Required. Flag to enable event tracing.
+ *
+ * \ingroup LuaLogging
+ * */
+int chiLogSetEventTracing(lua_State* L)
+{
+  const std::string fname = __FUNCTION__;
+  const int num_args = lua_gettop(L);
+  if (num_args != 1) LuaPostArgAmountError(fname, 1, num_args);
+
+  LuaCheckBoolValue(fname, L, 1);
+
+  Chi::log.SetEventTracing(lua_toboolean(L, 1));
+
+  return 0;
+}
+
+// ##################################################################
+/**Exports the retained events of all repeating events, of all locations,
+ * to a Chrome/Perfetto trace-event JSON file.
+ *
+ * \param file_name string Required. Name of the file to write.
+ *
+ * \ingroup LuaLogging
+ * */
+int chiLogExportEventTrace(lua_State* L)
+{
+  const std::string fname = __FUNCTION__;
+  const int num_args = lua_gettop(L);
+  if (num_args != 1) LuaPostArgAmountError(fname, 1, num_args);
+
+  LuaCheckStringValue(fname, L, 1);
+
+  Chi::log.ExportEventTrace(lua_tostring(L, 1));
+
+  return 0;
+}
+
+// ##################################################################
+/**Prints the timing blocks reduced over all the locations, i.e., the
+ * minimum, average and maximum time of every block, the location with the
+ * maximum time and the imbalance ratio (maximum over average). Must be
+ * called by all the locations.
+ *
+ * \ingroup LuaLogging
+ * */
+int chiLogPrintTimingReport(lua_State* L)
+{
+  const std::string report = Chi::log.MakeGlobalTimingReportString();
+
+  Chi::log.Log() << "\nTiming report:\n" << report;
+
+  return 0;
+}
+
+// ##################################################################
+/**Writes the timing blocks reduced over all the locations to a JSON
+ * file. Must be called by all the locations.
+ *
+ * \param file_name string Required. Name of the file to write.
+ *
+ * \ingroup LuaLogging
+ * */
+int chiLogExportTimingReport(lua_State* L)
+{
+  const std::string fname = __FUNCTION__;
+  const int num_args = lua_gettop(L);
+  if (num_args != 1) LuaPostArgAmountError(fname, 1, num_args);
+
+  LuaCheckStringValue(fname, L, 1);
+  const std::string file_name = lua_tostring(L, 1);
+
+  const std::string report = Chi::log.MakeGlobalTimingReportJSON();
+
+  if (Chi::mpi.location_id == 0)
+  {
+    std::ofstream file(file_name);
+    ChiLogicalErrorIf(not file.is_open(),
+                      "Failed to open \"" + file_name + "\" for writing.");
+    file << report;
+  }
+
+  return 0;
+}
+
+} // namespace chi_log_utils::lua_utils
@@ -2,6 +2,7 @@
 
 #include "math/ParallelVector/ParallelVector.h"
 
+#include "chi_runtime.h"
 #include "chi_log.h"
 
 // ###################################################################
@@ -133,8 +134,14 @@ void chi_math::PETScUtils::CopyGlobalVecToSTLvector(
  * vector.*/
 void chi_math::PETScUtils::CommunicateGhostEntries(Vec x)
 {
+  auto& t_ghost_comm =
+    Chi::log.CreateOrGetTimingBlock("PETScUtils::CommunicateGhostEntries");
+  t_ghost_comm.TimeSectionBegin();
+
   VecGhostUpdateBegin(x, INSERT_VALUES, SCATTER_FORWARD);
   VecGhostUpdateEnd(x, INSERT_VALUES, SCATTER_FORWARD);
+
+  t_ghost_comm.TimeSectionEnd();
 }
 
 // ###################################################################
@@ -90,6 +90,22 @@ public:
     ghost_comm_.CommunicateGhostEntries(values_);
   }
 
+  /**
+   * Start communicating the ghost entries. Locally owned entries can be
+   * modified, e.g., to overlap interior work with the communication, but
+   * ghost entries must not be accessed until CommunicateGhostEntriesEnd.
+   */
+  void CommunicateGhostEntriesBegin()
+  {
+    ghost_comm_.CommunicateGhostEntriesBegin(values_);
+  }
+
+  /// Complete the communication started with CommunicateGhostEntriesBegin.
+  void CommunicateGhostEntriesEnd()
+  {
+    ghost_comm_.CommunicateGhostEntriesEnd(values_);
+  }
+
 private:
   VectorGhostCommunicator ghost_comm_;
 };
@@ -178,22 +178,27 @@ chi_math::SpatialDiscretization::MakeInternalFaceNodeMappings(
         const auto& adj_cell = grid.cells[face.neighbor_id_];
         const auto& adj_cell_mapping = this->GetCellMapping(adj_cell);
         const auto& adj_node_locations = adj_cell_mapping.GetNodeLocations();
-        const size_t adj_num_nodes = adj_cell_mapping.NumNodes();
+
+        // Only the nodes of the associated face can coincide
+        const auto af = grid.GetFaceAdjacency().AssociatedFace(cell.local_id_,
+                                                               f);
+        const size_t adj_num_face_nodes = adj_cell_mapping.NumFaceNodes(af);
 
         for (size_t fi = 0; fi < num_face_nodes; ++fi)
         {
           const int i = cell_mapping.MapFaceNode(f, fi);
           const auto& ivec3 = node_locations[i];
 
-          for (size_t ai = 0; ai < adj_num_nodes; ++ai)
+          for (size_t afi = 0; afi < adj_num_face_nodes; ++afi)
           {
+            const int ai = adj_cell_mapping.MapFaceNode(af, afi);
             const auto& aivec3 = adj_node_locations[ai];
             if ((ivec3 - aivec3).NormSquare() < tolerance)
             {
-              face_adj_mapping[fi] = static_cast<int>(ai);
+              face_adj_mapping[fi] = ai;
               break;
             }
-          } // for ai
+          } // for afi
           if (face_adj_mapping[fi] < 0)
             throw std::logic_error("Face node mapping failed");
         } // for fi
@@ -2,7 +2,8 @@
 
 #include "mpi/chi_mpi_utils.h"
 
-#include "chi_log_exceptions.h"
+#include "chi_runtime.h"
+#include "chi_log.h"
 
 #include <map>
 #include <string>
@@ -13,12 +14,27 @@
 namespace chi_math
 {
 
+namespace
+{
+/**Deleter of the shared distributed graph communicator. Communicators
+ * outliving MPI are not freed.*/
+void FreeGraphCommunicator(MPI_Comm* graph_comm)
+{
+  int finalized = 0;
+  MPI_Finalized(&finalized);
+  if (not finalized and *graph_comm != MPI_COMM_NULL)
+    MPI_Comm_free(graph_comm);
+  delete graph_comm;
+}
+} // namespace
+
 // ######################################################################
 VectorGhostCommunicator::VectorGhostCommunicator(
   const uint64_t local_size,
   const uint64_t global_size,
   const std::vector<int64_t>& ghost_ids,
-  const MPI_Comm communicator)
+  const MPI_Comm communicator,
+  const GhostCommunicationMode mode)
   : local_size_(local_size),
     global_size_(global_size),
     ghost_ids_(ghost_ids),
@@ -26,6 +42,7 @@ VectorGhostCommunicator::VectorGhostCommunicator(
     location_id_(chi_mpi_utils::GetLocationID(communicator)),
     process_count_(chi_mpi_utils::GetProcessCount(communicator)),
     extents_(chi_mpi_utils::BuildLocationExtents(local_size, communicator)),
+    mode_(mode),
     cached_parallel_data_(MakeCachedParallelData())
 {
 }
@@ -114,23 +131,75 @@ VectorGhostCommunicator::MakeCachedParallelData()
     total_sendcounts += static_cast<int>(gids.size());
   }
 
+  // The receive position of each ghost is stored in ghost order so that
+  // unpacking does not need map lookups.
+  std::vector<size_t> ghost_recv_positions;
+  ghost_recv_positions.reserve(ghost_ids_.size());
+  for (const int64_t ghost_id : ghost_ids_)
+    ghost_recv_positions.push_back(ghost_to_recv_map.at(ghost_id));
+
+  // For the neighbor mode, a distributed graph communicator is created that
+  // only connects this process to the processes it exchanges data with.
+  // The sources and destinations are in ascending process order, as are
+  // the process-contiguous send and receive buffers.
+  std::vector<int> neighbor_sendcounts, neighbor_senddispls;
+  std::vector<int> neighbor_recvcounts, neighbor_recvdispls;
+  std::shared_ptr<MPI_Comm> neighbor_comm;
+  if (mode_ == GhostCommunicationMode::NEIGHBORHOOD)
+  {
+    std::vector<int> sources, destinations;
+    for (const auto& [pid, gids] : recv_map)
+    {
+      sources.push_back(pid);
+      neighbor_recvcounts.push_back(recvcounts[pid]);
+      neighbor_recvdispls.push_back(recvdispls[pid]);
+    }
+    for (const auto& [pid, gids] : send_map)
+    {
+      destinations.push_back(pid);
+      neighbor_sendcounts.push_back(sendcounts[pid]);
+      neighbor_senddispls.push_back(senddispls[pid]);
+    }
+
+    neighbor_comm = std::shared_ptr<MPI_Comm>(new MPI_Comm(MPI_COMM_NULL),
+                                              FreeGraphCommunicator);
+
+    MPI_Dist_graph_create_adjacent(comm_,
+                                   static_cast<int>(sources.size()),
+                                   sources.data(),
+                                   MPI_UNWEIGHTED,
+                                   static_cast<int>(destinations.size()),
+                                   destinations.data(),
+                                   MPI_UNWEIGHTED,
+                                   MPI_INFO_NULL,
+                                   /*reorder=*/0,
+                                   neighbor_comm.get());
+  }
+
   return CachedParallelData{std::move(sendcounts),
                             std::move(senddispls),
                             std::move(recvcounts),
                             std::move(recvdispls),
                             std::move(local_ids_to_send),
-                            std::move(ghost_to_recv_map)};
+                            std::move(ghost_to_recv_map),
+                            std::move(ghost_recv_positions),
+                            std::move(neighbor_sendcounts),
+                            std::move(neighbor_senddispls),
+                            std::move(neighbor_recvcounts),
+                            std::move(neighbor_recvdispls),
+                            std::move(neighbor_comm)};
 }
 
 VectorGhostCommunicator::VectorGhostCommunicator(
   const VectorGhostCommunicator& other)
   : local_size_(other.local_size_),
-    global_size_(other.local_size_),
+    global_size_(other.global_size_),
     ghost_ids_(other.ghost_ids_),
     comm_(other.comm_),
     location_id_(other.location_id_),
     process_count_(other.process_count_),
     extents_(other.extents_),
+    mode_(other.mode_),
     cached_parallel_data_(other.cached_parallel_data_)
 {
 }
@@ -138,12 +207,13 @@ VectorGhostCommunicator::VectorGhostCommunicator(
 VectorGhostCommunicator::VectorGhostCommunicator(
   VectorGhostCommunicator&& other) noexcept
   : local_size_(other.local_size_),
-    global_size_(other.local_size_),
+    global_size_(other.global_size_),
     ghost_ids_(other.ghost_ids_),
     comm_(other.comm_),
     location_id_(other.location_id_),
     process_count_(other.process_count_),
     extents_(other.extents_),
+    mode_(other.mode_),
     cached_parallel_data_(other.cached_parallel_data_)
 {
 }
@@ -166,6 +236,14 @@ int64_t VectorGhostCommunicator::MapGhostToLocal(const int64_t ghost_id) const
 // ######################################################################
 void VectorGhostCommunicator::CommunicateGhostEntries(
   std::vector<double>& ghosted_vector) const
+{
+  CommunicateGhostEntriesBegin(ghosted_vector);
+  CommunicateGhostEntriesEnd(ghosted_vector);
+}
+
+// ######################################################################
+void VectorGhostCommunicator::CommunicateGhostEntriesBegin(
+  const std::vector<double>& ghosted_vector) const
 {
   ChiInvalidArgumentIf(ghosted_vector.size() != local_size_ + ghost_ids_.size(),
                        std::string(__FUNCTION__) +
@@ -174,36 +252,87 @@ void VectorGhostCommunicator::CommunicateGhostEntries(
                          std::to_string(ghosted_vector.size()) +
                          " requirement " +
                          std::to_string(local_size_ + ghost_ids_.size()));
+  ChiLogicalErrorIf(pending_.active_,
+                    std::string(__FUNCTION__) +
+                      ": A ghost communication is already in progress.");
+
+  auto& t_ghost_comm = Chi::log.CreateOrGetTimingBlock(
+    "VectorGhostCommunicator::CommunicateGhostEntries");
+  t_ghost_comm.TimeSectionBegin();
 
   // Serialize the data that needs to be sent
-  const size_t send_size = cached_parallel_data_.local_ids_to_send_.size();
-  std::vector<double> send_data;
-  send_data.reserve(send_size);
-  for (const int64_t local_id : cached_parallel_data_.local_ids_to_send_)
-    send_data.push_back(ghosted_vector[local_id]);
+  const auto& local_ids_to_send = cached_parallel_data_.local_ids_to_send_;
+  auto& send_data = pending_.send_data_;
+  send_data.resize(local_ids_to_send.size());
+  for (size_t i = 0; i < local_ids_to_send.size(); ++i)
+    send_data[i] = ghosted_vector[local_ids_to_send[i]];
 
   // Create serialized storage for the data to be received
-  const size_t recv_size = ghost_ids_.size();
-  std::vector<double> recv_data(recv_size, 0.0);
-
-  // Communicate the ghost data
-  MPI_Alltoallv(send_data.data(),
-                cached_parallel_data_.sendcounts_.data(),
-                cached_parallel_data_.senddispls_.data(),
-                MPI_DOUBLE,
-                recv_data.data(),
-                cached_parallel_data_.recvcounts_.data(),
-                cached_parallel_data_.recvdispls_.data(),
-                MPI_DOUBLE,
-                comm_);
+  auto& recv_data = pending_.recv_data_;
+  recv_data.assign(ghost_ids_.size(), 0.0);
+
+  // Start communicating the ghost data
+  const auto& cpd = cached_parallel_data_;
+  if (mode_ == GhostCommunicationMode::NEIGHBORHOOD)
+    MPI_Ineighbor_alltoallv(send_data.data(),
+                            cpd.neighbor_sendcounts_.data(),
+                            cpd.neighbor_senddispls_.data(),
+                            MPI_DOUBLE,
+                            recv_data.data(),
+                            cpd.neighbor_recvcounts_.data(),
+                            cpd.neighbor_recvdispls_.data(),
+                            MPI_DOUBLE,
+                            *cpd.neighbor_comm_,
+                            &pending_.request_);
+  else
+    MPI_Ialltoallv(send_data.data(),
+                   cpd.sendcounts_.data(),
+                   cpd.senddispls_.data(),
+                   MPI_DOUBLE,
+                   recv_data.data(),
+                   cpd.recvcounts_.data(),
+                   cpd.recvdispls_.data(),
+                   MPI_DOUBLE,
+                   comm_,
+                   &pending_.request_);
+  pending_.active_ = true;
+
+  t_ghost_comm.TimeSectionEnd();
+}
+
+// ######################################################################
+void VectorGhostCommunicator::CommunicateGhostEntriesEnd(
+  std::vector<double>& ghosted_vector) const
+{
+  ChiInvalidArgumentIf(ghosted_vector.size() != local_size_ + ghost_ids_.size(),
+                       std::string(__FUNCTION__) +
+                         ": Vector size mismatch. "
+                         "input size = " +
+                         std::to_string(ghosted_vector.size()) +
+                         " requirement " +
+                         std::to_string(local_size_ + ghost_ids_.size()));
+  ChiLogicalErrorIf(not pending_.active_,
+                    std::string(__FUNCTION__) +
+                      ": No ghost communication is in progress.");
+
+  auto& t_ghost_comm = Chi::log.CreateOrGetTimingBlock(
+    "VectorGhostCommunicator::CommunicateGhostEntries");
+  t_ghost_comm.TimeSectionBegin();
+
+  MPI_Wait(&pending_.request_, MPI_STATUS_IGNORE);
+  pending_.active_ = false;
 
   // Lastly, populate the local vector with ghost data. All ghost data is
   // appended to the back of the local vector. Using the mapping between
   // ghost indices and the relative ghost index position along with the
   // ordering of the ghost indices, this can be accomplished.
-  for (size_t k = 0; k < recv_size; ++k)
-    ghosted_vector[local_size_ + k] =
-      recv_data[cached_parallel_data_.ghost_to_recv_map_.at(ghost_ids_[k])];
+  const auto& recv_data = pending_.recv_data_;
+  const auto& ghost_recv_positions =
+    cached_parallel_data_.ghost_recv_positions_;
+  for (size_t k = 0; k < ghost_ids_.size(); ++k)
+    ghosted_vector[local_size_ + k] = recv_data[ghost_recv_positions[k]];
+
+  t_ghost_comm.TimeSectionEnd();
 }
 
 // ######################################################################
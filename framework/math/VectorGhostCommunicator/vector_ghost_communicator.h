@@ -4,21 +4,35 @@
 #include <vector>
 #include <cstdint>
 #include <map>
+#include <memory>
 
 #include <mpi.h>
 
 namespace chi_math
 {
 
+/**How the ghost entries are exchanged.*/
+enum class GhostCommunicationMode
+{
+  /**`MPI_Ialltoallv` over the full communicator. Involves all the
+   * processes of the communicator regardless of the pattern.*/
+  ALLTOALLV = 0,
+  /**`MPI_Ineighbor_alltoallv` over a distributed graph communicator that
+   * only connects the processes exchanging ghost entries.*/
+  NEIGHBORHOOD = 1
+};
+
 /**Vector with allocation space for ghosts.*/
 class VectorGhostCommunicator
 {
 
 public:
-  VectorGhostCommunicator(uint64_t local_size,
-                          uint64_t global_size,
-                          const std::vector<int64_t>& ghost_ids,
-                          MPI_Comm communicator);
+  VectorGhostCommunicator(
+    uint64_t local_size,
+    uint64_t global_size,
+    const std::vector<int64_t>& ghost_ids,
+    MPI_Comm communicator,
+    GhostCommunicationMode mode = GhostCommunicationMode::NEIGHBORHOOD);
 
   /**Copy constructor.*/
   VectorGhostCommunicator(const VectorGhostCommunicator& other);
@@ -33,11 +47,23 @@ public:
   const std::vector<int64_t>& GhostIndices() const { return ghost_ids_; }
 
   MPI_Comm Communicator() const { return comm_; }
+  GhostCommunicationMode Mode() const { return mode_; }
 
   int64_t MapGhostToLocal(int64_t ghost_id) const;
 
   void CommunicateGhostEntries(std::vector<double>& ghosted_vector) const;
 
+  /**Starts communicating the ghost entries of the given vector. The
+   * locally owned entries are copied before this returns and can be
+   * modified afterwards. The ghost entries are only valid after the
+   * matching call to CommunicateGhostEntriesEnd with the same vector.
+   * Only one communication can be in progress per communicator.*/
+  void CommunicateGhostEntriesBegin(
+    const std::vector<double>& ghosted_vector) const;
+  /**Completes the communication started with CommunicateGhostEntriesBegin
+   * and writes the ghost entries.*/
+  void CommunicateGhostEntriesEnd(std::vector<double>& ghosted_vector) const;
+
   std::vector<double> MakeGhostedVector() const;
   std::vector<double>
   MakeGhostedVector(const std::vector<double>& local_vector) const;
@@ -51,6 +77,7 @@ protected:
   const int location_id_;
   const int process_count_;
   const std::vector<uint64_t> extents_;
+  const GhostCommunicationMode mode_;
 
   struct CachedParallelData
   {
@@ -61,10 +88,32 @@ protected:
 
     std::vector<int64_t> local_ids_to_send_;
     std::map<int64_t, size_t> ghost_to_recv_map_;
+    /**Position in the receive buffer of each ghost id.*/
+    std::vector<size_t> ghost_recv_positions_;
+
+    /**Counts and displacements restricted to the neighbors, ordered as the
+     * sources and destinations of the neighbor communicator.*/
+    std::vector<int> neighbor_sendcounts_;
+    std::vector<int> neighbor_senddispls_;
+    std::vector<int> neighbor_recvcounts_;
+    std::vector<int> neighbor_recvdispls_;
+    /**Distributed graph communicator shared by copies.*/
+    std::shared_ptr<MPI_Comm> neighbor_comm_;
   };
 
   const CachedParallelData cached_parallel_data_;
 
+  /**Buffers and request of a communication in progress.*/
+  struct PendingCommunication
+  {
+    std::vector<double> send_data_;
+    std::vector<double> recv_data_;
+    MPI_Request request_ = MPI_REQUEST_NULL;
+    bool active_ = false;
+  };
+
+  mutable PendingCommunication pending_;
+
 private:
   int FindOwnerPID(int64_t global_id) const;
   CachedParallelData MakeCachedParallelData();
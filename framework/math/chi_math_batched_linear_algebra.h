@@ -0,0 +1,181 @@
+#ifndef CHITECH_CHI_MATH_BATCHED_LINEAR_ALGEBRA_H
+#define CHITECH_CHI_MATH_BATCHED_LINEAR_ALGEBRA_H
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace chi_math
+{
+
+// ###################################################################
+/**Allocator returning memory aligned to `Alignment` bytes. Used for
+ * buffers that are processed with SIMD instructions.*/
+template <typename T, size_t Alignment = 64>
+struct AlignedAllocator
+{
+  typedef T value_type;
+
+  template <typename U>
+  struct rebind
+  {
+    typedef AlignedAllocator<U, Alignment> other;
+  };
+
+  AlignedAllocator() = default;
+  template <typename U>
+  explicit AlignedAllocator(const AlignedAllocator<U, Alignment>&)
+  {
+  }
+
+  T* allocate(size_t n)
+  {
+    return static_cast<T*>(
+      ::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+  }
+  void deallocate(T* p, size_t)
+  {
+    ::operator delete(p, std::align_val_t(Alignment));
+  }
+
+  template <typename U>
+  bool operator==(const AlignedAllocator<U, Alignment>&) const
+  {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const AlignedAllocator<U, Alignment>&) const
+  {
+    return false;
+  }
+};
+
+typedef std::vector<double, AlignedAllocator<double>> AlignedVecDbl;
+
+/**Number of doubles making up a 64 byte cache line. Batch strides are
+ * padded to a multiple of this.*/
+constexpr size_t DOUBLES_PER_CACHE_LINE = 64 / sizeof(double);
+
+/**Rounds the batch size up to a multiple of DOUBLES_PER_CACHE_LINE.*/
+inline size_t PaddedBatchStride(size_t batch_size)
+{
+  const size_t w = DOUBLES_PER_CACHE_LINE;
+  return ((batch_size + w - 1) / w) * w;
+}
+
+// ###################################################################
+/**Solves a batch of dense `n x n` systems with Gaussian elimination
+ * without pivoting, i.e., the batched version of
+ * chi_math::GaussElimination.
+ *
+ * The systems are stored batch-innermost: entry \f$ A_{ij} \f$ of system
+ * `s` is located at `A[(i*n + j)*stride + s]` and entry \f$ b_i \f$ at
+ * `b[i*stride + s]`. The innermost loops therefore run over the systems
+ * with unit stride, which allows the compiler to vectorize them. `A` is
+ * overwritten with the factorization and `b` with the solution.
+ *
+ * When `N` is non-zero the matrix size is a compile time constant, which
+ * lets the compiler fully unroll the loops over the matrix entries, and
+ * the argument `n` is ignored.*/
+template <int N>
+void BatchedGaussElimination(double* __restrict A,
+                             double* __restrict b,
+                             int n,
+                             size_t num_systems,
+                             size_t stride)
+{
+  const int nn = (N > 0) ? N : n;
+
+  // Forward elimination
+  for (int i = 0; i < nn - 1; ++i)
+  {
+    const double* __restrict a_ii = &A[(i * nn + i) * stride];
+    const double* __restrict b_i = &b[i * stride];
+    for (int j = i + 1; j < nn; ++j)
+    {
+      double* __restrict a_ji = &A[(j * nn + i) * stride];
+      double* __restrict b_j = &b[j * stride];
+
+      // Store the factor in place of the eliminated entry
+      for (size_t s = 0; s < num_systems; ++s)
+        a_ji[s] /= a_ii[s];
+
+      for (size_t s = 0; s < num_systems; ++s)
+        b_j[s] -= a_ji[s] * b_i[s];
+
+      for (int k = i + 1; k < nn; ++k)
+      {
+        const double* __restrict a_ik = &A[(i * nn + k) * stride];
+        double* __restrict a_jk = &A[(j * nn + k) * stride];
+        for (size_t s = 0; s < num_systems; ++s)
+          a_jk[s] -= a_ji[s] * a_ik[s];
+      }
+    }
+  }
+
+  // Back substitution
+  for (int i = nn - 1; i >= 0; --i)
+  {
+    double* __restrict b_i = &b[i * stride];
+    for (int j = i + 1; j < nn; ++j)
+    {
+      const double* __restrict a_ij = &A[(i * nn + j) * stride];
+      const double* __restrict b_j = &b[j * stride];
+      for (size_t s = 0; s < num_systems; ++s)
+        b_i[s] -= a_ij[s] * b_j[s];
+    }
+
+    const double* __restrict a_ii = &A[(i * nn + i) * stride];
+    for (size_t s = 0; s < num_systems; ++s)
+      b_i[s] /= a_ii[s];
+  }
+}
+
+namespace detail
+{
+template <int... Ns>
+void BatchedGaussEliminationDispatch(double* A,
+                                     double* b,
+                                     int n,
+                                     size_t num_systems,
+                                     size_t stride,
+                                     std::integer_sequence<int, Ns...>)
+{
+  const bool specialized =
+    ((n == Ns and Ns > 0
+        ? (BatchedGaussElimination<Ns>(A, b, n, num_systems, stride), true)
+        : false) or
+     ...);
+  if (not specialized)
+    BatchedGaussElimination<0>(A, b, n, num_systems, stride);
+}
+} // namespace detail
+
+/**Maximum matrix size for which BatchedGaussElimination is specialized
+ * at compile time. This covers triangles, quadrilaterals, tetrahedra,
+ * hexahedra and most polyhedra.*/
+constexpr int MAX_SPECIALIZED_BATCHED_SIZE = 16;
+
+// ###################################################################
+/**Calls the compile time specialization of BatchedGaussElimination
+ * matching `n`, falling back to the run time sized version for
+ * `n > MAX_SPECIALIZED_BATCHED_SIZE`.*/
+inline void BatchedGaussElimination(double* A,
+                                    double* b,
+                                    int n,
+                                    size_t num_systems,
+                                    size_t stride)
+{
+  detail::BatchedGaussEliminationDispatch(
+    A,
+    b,
+    n,
+    num_systems,
+    stride,
+    std::make_integer_sequence<int, MAX_SPECIALIZED_BATCHED_SIZE + 1>{});
+}
+
+} // namespace chi_math
+
+#endif // CHITECH_CHI_MATH_BATCHED_LINEAR_ALGEBRA_H
@@ -3,11 +3,15 @@
 
 #include <memory>
 #include <array>
+#include <mutex>
+#include <unordered_map>
 
 #include "../chi_mesh.h"
 #include "chi_meshcontinuum_localcellhandler.h"
 #include "chi_meshcontinuum_globalcellhandler.h"
 #include "chi_meshcontinuum_vertexhandler.h"
+#include "chi_meshcontinuum_faceadjacency.h"
+#include "chi_meshcontinuum_flatfaceview.h"
 
 #include "chi_mpi.h"
 
@@ -42,8 +46,8 @@ private:
   std::vector<std::unique_ptr<chi_mesh::Cell>>
     ghost_cells_; ///< Locally stored ghosts
 
-  std::map<uint64_t, uint64_t> global_cell_id_to_local_id_map_;
-  std::map<uint64_t, uint64_t> global_cell_id_to_nonlocal_id_map_;
+  std::unordered_map<uint64_t, uint64_t> global_cell_id_to_local_id_map_;
+  std::unordered_map<uint64_t, uint64_t> global_cell_id_to_nonlocal_id_map_;
 
   uint64_t global_vertex_count_ = 0;
 
@@ -64,6 +68,11 @@ private:
 
   std::map<uint64_t, std::string> boundary_id_map_;
 
+  mutable std::shared_ptr<FaceAdjacency> face_adjacency_ = nullptr;
+  mutable std::mutex face_adjacency_mutex_;
+  mutable std::shared_ptr<FlatFaceView> flat_face_view_ = nullptr;
+  mutable std::mutex flat_face_view_mutex_;
+
 public:
   MeshContinuum()
     : local_cells(local_cells_),
@@ -106,6 +115,8 @@ public:
     global_cell_id_to_local_id_map_.clear();
     global_cell_id_to_nonlocal_id_map_.clear();
     vertices.Clear();
+    InvalidateFaceAdjacency();
+    InvalidateFlatFaceView();
   }
 
   void ExportCellsToObj(const char* fileName,
@@ -135,6 +146,26 @@ public:
                             const chi_mesh::Cell& adj_cell,
                             unsigned int f);
 
+  /**Builds the face adjacency of the local cells, using `--mesh_threads`
+   * threads. Called once the grid is complete.*/
+  void BuildFaceAdjacency();
+  /**Discards the face adjacency. Must be called after cells or faces are
+   * added, removed or reconnected on a complete grid.*/
+  void InvalidateFaceAdjacency();
+  /**Returns the face adjacency of the local cells. If it was not built, or
+   * was invalidated, it is built on this call. Safe to call concurrently.*/
+  const FaceAdjacency& GetFaceAdjacency() const;
+
+  /**Builds the flat face view of the local cells. Called once the grid is
+   * complete.*/
+  void BuildFlatFaceView();
+  /**Discards the flat face view. Must be called, like
+   * InvalidateFaceAdjacency, after cells or faces are modified.*/
+  void InvalidateFlatFaceView();
+  /**Returns the flat face view of the local cells, building it if needed.
+   * Safe to call concurrently.*/
+  const FlatFaceView& GetFlatFaceView() const;
+
   /**Given a global-id of a cell, will return the local-id if the
   * cell is local, otherwise will throw out_of_range.*/
   size_t MapCellGlobalID2LocalID(uint64_t global_id) const;
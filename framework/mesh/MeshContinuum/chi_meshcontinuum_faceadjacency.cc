@@ -0,0 +1,122 @@
+#include "chi_meshcontinuum_faceadjacency.h"
+
+#include "chi_meshcontinuum.h"
+
+#include "utils/chi_thread_pool.h"
+
+#include "chi_log_exceptions.h"
+
+#include <algorithm>
+
+namespace chi_mesh
+{
+
+namespace
+{
+/**Order independent fingerprint of a list of vertex ids. Used to reject
+ * non-matching faces before comparing the sorted vertex ids.*/
+uint64_t VertexIDsFingerprint(const std::vector<uint64_t>& vids)
+{
+  uint64_t sum = 0, xor_sum = 0;
+  for (uint64_t vid : vids)
+  {
+    sum += vid;
+    xor_sum ^= vid * 0x9e3779b97f4a7c15ULL;
+  }
+  return sum ^ (xor_sum << 1);
+}
+
+std::vector<uint64_t> SortedCopy(const std::vector<uint64_t>& vids)
+{
+  std::vector<uint64_t> sorted_vids(vids);
+  std::sort(sorted_vids.begin(), sorted_vids.end());
+  return sorted_vids;
+}
+
+/**Returns the position of `vid` in `vids`, or -1.*/
+short FindVertex(const std::vector<uint64_t>& vids, uint64_t vid)
+{
+  const auto it = std::find(vids.begin(), vids.end(), vid);
+  return it == vids.end() ? short(-1) : static_cast<short>(it - vids.begin());
+}
+} // namespace
+
+FaceAdjacency::FaceAdjacency(const MeshContinuum& grid, size_t num_threads)
+{
+  const size_t num_local_cells = grid.local_cells.size();
+
+  cell_face_offsets_.assign(num_local_cells + 1, 0);
+  for (const auto& cell : grid.local_cells)
+    cell_face_offsets_[cell.local_id_ + 1] = cell.faces_.size();
+  for (size_t c = 0; c < num_local_cells; ++c)
+    cell_face_offsets_[c + 1] += cell_face_offsets_[c];
+
+  faces_.resize(cell_face_offsets_.back());
+
+  //============================================= Build per cell
+  // Each cell only writes its own faces.
+  auto BuildCells = [&grid, this](size_t begin, size_t end, size_t)
+  {
+    for (size_t c = begin; c < end; ++c)
+    {
+      const auto& cell = grid.local_cells[c];
+      const size_t num_faces = cell.faces_.size();
+      for (size_t f = 0; f < num_faces; ++f)
+      {
+        const auto& face = cell.faces_[f];
+        if (not face.has_neighbor_) continue;
+
+        const auto& adj_cell = grid.cells[face.neighbor_id_];
+        auto& face_info = faces_[cell_face_offsets_[c] + f];
+
+        //================================ Find the associated face
+        const size_t num_face_vids = face.vertex_ids_.size();
+        const uint64_t fingerprint = VertexIDsFingerprint(face.vertex_ids_);
+        const auto sorted_vids = SortedCopy(face.vertex_ids_);
+
+        int associated_face = -1;
+        for (size_t af = 0; af < adj_cell.faces_.size(); ++af)
+        {
+          const auto& adj_face_vids = adj_cell.faces_[af].vertex_ids_;
+          if (adj_face_vids.size() != num_face_vids) continue;
+          if (VertexIDsFingerprint(adj_face_vids) != fingerprint) continue;
+          if (SortedCopy(adj_face_vids) != sorted_vids) continue;
+
+          associated_face = static_cast<int>(af);
+          break;
+        }
+
+        ChiLogicalErrorIf(associated_face < 0,
+                          "Could not find the face associated with face " +
+                            std::to_string(f) + " of cell " +
+                            std::to_string(cell.global_id_) +
+                            " on adjacent cell " +
+                            std::to_string(adj_cell.global_id_) + ".");
+
+        //================================ Map the face vertices
+        const auto& adj_face = adj_cell.faces_[associated_face];
+
+        face_info.associated_face_ = associated_face;
+        face_info.face_vertex_mapping_.reserve(num_face_vids);
+        face_info.cell_vertex_mapping_.reserve(num_face_vids);
+        for (uint64_t vid : face.vertex_ids_)
+        {
+          face_info.face_vertex_mapping_.push_back(
+            FindVertex(adj_face.vertex_ids_, vid));
+          face_info.cell_vertex_mapping_.push_back(
+            FindVertex(adj_cell.vertex_ids_, vid));
+
+          ChiLogicalErrorIf(face_info.cell_vertex_mapping_.back() < 0,
+                            "Face vertex mapping failed for cell " +
+                              std::to_string(cell.global_id_) + " face " +
+                              std::to_string(f) + ".");
+        }
+      } // for f
+    }   // for c
+  };
+
+  chi::ThreadPool thread_pool(num_threads);
+  thread_pool.ParallelFor(num_local_cells, BuildCells);
+}
+
+}//namespace chi_mesh
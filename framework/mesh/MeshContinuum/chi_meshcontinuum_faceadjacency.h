@@ -0,0 +1,65 @@
+#ifndef CHI_MESHCONTINUUM_FACEADJACENCY_H
+#define CHI_MESHCONTINUUM_FACEADJACENCY_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace chi_mesh
+{
+class MeshContinuum;
+
+//##################################################
+/**Cell-face adjacency of the local cells of a grid. For every face of every
+ * local cell that has a neighbor, stores the index of the associated face on
+ * the neighbor cell and, for every vertex of the face, its index on the
+ * associated face and on the neighbor cell. Boundary faces have an associated
+ * face of -1 and empty mappings.
+ *
+ * Built by MeshContinuum::BuildFaceAdjacency once the grid is set up, or on
+ * demand by MeshContinuum::GetFaceAdjacency.*/
+class FaceAdjacency
+{
+public:
+  /**Computes the adjacency of all local cells of the grid.*/
+  FaceAdjacency(const MeshContinuum& grid, size_t num_threads);
+
+  /**Returns the face index, on the neighbor cell, of the `f`-th face of a
+   * local cell, or -1 if the face has no neighbor.*/
+  int AssociatedFace(uint64_t cell_local_id, unsigned int f) const
+  {
+    return faces_[cell_face_offsets_[cell_local_id] + f].associated_face_;
+  }
+
+  /**Returns, for each vertex of the `f`-th face of a local cell, the
+   * vertex's index on the associated face of the neighbor cell.*/
+  const std::vector<short>& FaceVertexMapping(uint64_t cell_local_id,
+                                              unsigned int f) const
+  {
+    return faces_[cell_face_offsets_[cell_local_id] + f].face_vertex_mapping_;
+  }
+
+  /**Returns, for each vertex of the `f`-th face of a local cell, the
+   * vertex's index on the neighbor cell.*/
+  const std::vector<short>& CellVertexMapping(uint64_t cell_local_id,
+                                              unsigned int f) const
+  {
+    return faces_[cell_face_offsets_[cell_local_id] + f].cell_vertex_mapping_;
+  }
+
+private:
+  struct FaceInfo
+  {
+    int associated_face_ = -1;
+    std::vector<short> face_vertex_mapping_;
+    std::vector<short> cell_vertex_mapping_;
+  };
+
+  /**Offset of each local cell's first face in `faces_`.*/
+  std::vector<size_t> cell_face_offsets_;
+  std::vector<FaceInfo> faces_;
+};
+
+}//namespace chi_mesh
+
+#endif //CHI_MESHCONTINUUM_FACEADJACENCY_H
@@ -0,0 +1,54 @@
+#include "chi_meshcontinuum_flatfaceview.h"
+
+#include "chi_meshcontinuum.h"
+
+namespace chi_mesh
+{
+
+FlatFaceView::FlatFaceView(const MeshContinuum& grid)
+{
+  const size_t num_local_cells = grid.local_cells.size();
+
+  size_t num_faces = 0;
+  size_t num_face_vertices = 0;
+  for (const auto& cell : grid.local_cells)
+  {
+    num_faces += cell.faces_.size();
+    for (const auto& face : cell.faces_)
+      num_face_vertices += face.vertex_ids_.size();
+  }
+
+  cell_face_offsets_.reserve(num_local_cells + 1);
+  normals_.reserve(num_faces);
+  has_neighbor_.reserve(num_faces);
+  neighbor_ids_.reserve(num_faces);
+  neighbor_local_ids_.reserve(num_faces);
+  face_vertex_offsets_.reserve(num_faces + 1);
+  face_vertex_ids_.reserve(num_face_vertices);
+
+  cell_face_offsets_.push_back(0);
+  face_vertex_offsets_.push_back(0);
+  for (const auto& cell : grid.local_cells)
+  {
+    for (const auto& face : cell.faces_)
+    {
+      normals_.push_back(face.normal_);
+      has_neighbor_.push_back(face.has_neighbor_ ? 1 : 0);
+      neighbor_ids_.push_back(face.neighbor_id_);
+
+      int64_t neighbor_local_id = -1;
+      if (face.has_neighbor_ and grid.IsCellLocal(face.neighbor_id_))
+        neighbor_local_id =
+          static_cast<int64_t>(grid.cells[face.neighbor_id_].local_id_);
+      neighbor_local_ids_.push_back(neighbor_local_id);
+
+      face_vertex_ids_.insert(face_vertex_ids_.end(),
+                              face.vertex_ids_.begin(),
+                              face.vertex_ids_.end());
+      face_vertex_offsets_.push_back(face_vertex_ids_.size());
+    }
+    cell_face_offsets_.push_back(normals_.size());
+  }
+}
+
+}//namespace chi_mesh
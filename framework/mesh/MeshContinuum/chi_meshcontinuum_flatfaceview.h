@@ -0,0 +1,90 @@
+#ifndef CHI_MESHCONTINUUM_FLATFACEVIEW_H
+#define CHI_MESHCONTINUUM_FLATFACEVIEW_H
+
+#include "mesh/chi_mesh.h"
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace chi_mesh
+{
+class MeshContinuum;
+
+//##################################################
+/**Flat, read-only copy of the faces of the local cells of a grid. The faces
+ * of all local cells are numbered contiguously, in local cell order, and
+ * their normals, neighbors and vertex ids are stored in compressed (CSR)
+ * arrays. Loops over the faces of a cell read contiguous memory instead of
+ * following the cell's and each face's own allocations, and local
+ * neighbors are resolved without a global-id lookup.
+ *
+ * Built by MeshContinuum::BuildFlatFaceView once the grid is set up, or on
+ * demand by MeshContinuum::GetFlatFaceView.*/
+class FlatFaceView
+{
+public:
+  /**Copies the faces of all local cells of the grid.*/
+  explicit FlatFaceView(const MeshContinuum& grid);
+
+  /**Returns the index of the first face of a local cell. The `f`-th face
+   * of the cell has index `CellFaceOffset(cell_local_id) + f`.*/
+  size_t CellFaceOffset(uint64_t cell_local_id) const
+  {
+    return cell_face_offsets_[cell_local_id];
+  }
+  /**Returns the number of faces of a local cell.*/
+  size_t NumFaces(uint64_t cell_local_id) const
+  {
+    return cell_face_offsets_[cell_local_id + 1] -
+           cell_face_offsets_[cell_local_id];
+  }
+  /**Returns the total number of faces of the local cells.*/
+  size_t NumFaces() const { return normals_.size(); }
+
+  const Vector3& Normal(size_t face_index) const
+  {
+    return normals_[face_index];
+  }
+  bool HasNeighbor(size_t face_index) const
+  {
+    return has_neighbor_[face_index] != 0;
+  }
+  /**Returns the neighbor's global id, or the boundary id for a face
+   * without a neighbor.*/
+  uint64_t NeighborID(size_t face_index) const
+  {
+    return neighbor_ids_[face_index];
+  }
+  /**Returns the neighbor's local id, or -1 if the face has no neighbor or
+   * the neighbor is a ghost cell.*/
+  int64_t NeighborLocalID(size_t face_index) const
+  {
+    return neighbor_local_ids_[face_index];
+  }
+
+  size_t NumFaceVertices(size_t face_index) const
+  {
+    return face_vertex_offsets_[face_index + 1] -
+           face_vertex_offsets_[face_index];
+  }
+  /**Returns a pointer to the `NumFaceVertices(face_index)` vertex ids of a
+   * face.*/
+  const uint64_t* FaceVertexIDs(size_t face_index) const
+  {
+    return face_vertex_ids_.data() + face_vertex_offsets_[face_index];
+  }
+
+private:
+  std::vector<size_t> cell_face_offsets_;
+  std::vector<Vector3> normals_;
+  std::vector<char> has_neighbor_;
+  std::vector<uint64_t> neighbor_ids_;
+  std::vector<int64_t> neighbor_local_ids_;
+  std::vector<size_t> face_vertex_offsets_;
+  std::vector<uint64_t> face_vertex_ids_;
+};
+
+}//namespace chi_mesh
+
+#endif //CHI_MESHCONTINUUM_FLATFACEVIEW_H
@@ -3,7 +3,7 @@
 
 #include "mesh/Cell/cell.h"
 
-#include <map>
+#include <unordered_map>
 
 namespace chi_mesh
 {
@@ -16,16 +16,18 @@ private:
   std::vector<std::unique_ptr<chi_mesh::Cell>>& local_cells_ref_;
   std::vector<std::unique_ptr<chi_mesh::Cell>>& ghost_cells_ref_;
 
-  std::map<uint64_t,uint64_t>& global_cell_id_to_native_id_map;
-  std::map<uint64_t,uint64_t>& global_cell_id_to_foreign_id_map;
+  typedef std::unordered_map<uint64_t,uint64_t> GlobalIDMap;
+
+  GlobalIDMap& global_cell_id_to_native_id_map;
+  GlobalIDMap& global_cell_id_to_foreign_id_map;
 
 
 private:
   explicit GlobalCellHandler(
     std::vector<std::unique_ptr<chi_mesh::Cell>>& in_native_cells,
     std::vector<std::unique_ptr<chi_mesh::Cell>>& in_foreign_cells,
-    std::map<uint64_t,uint64_t>& in_global_cell_id_to_native_id_map,
-    std::map<uint64_t,uint64_t>& in_global_cell_id_to_foreign_id_map) :
+    GlobalIDMap& in_global_cell_id_to_native_id_map,
+    GlobalIDMap& in_global_cell_id_to_foreign_id_map) :
     local_cells_ref_(in_native_cells),
     ghost_cells_ref_(in_foreign_cells),
     global_cell_id_to_native_id_map(in_global_cell_id_to_native_id_map),
@@ -285,6 +285,63 @@ size_t chi_mesh::MeshContinuum::MapCellFace(const chi_mesh::Cell& cur_cell,
   return fmap;
 }
 
+// ###################################################################
+/**Builds, or rebuilds, the face adjacency.*/
+void chi_mesh::MeshContinuum::BuildFaceAdjacency()
+{
+  std::lock_guard<std::mutex> lock(face_adjacency_mutex_);
+  face_adjacency_ =
+    std::make_shared<FaceAdjacency>(*this, Chi::run_time::num_mesh_threads_);
+}
+
+// ###################################################################
+/**Discards the face adjacency.*/
+void chi_mesh::MeshContinuum::InvalidateFaceAdjacency()
+{
+  std::lock_guard<std::mutex> lock(face_adjacency_mutex_);
+  face_adjacency_ = nullptr;
+}
+
+// ###################################################################
+/**Returns the cached face adjacency, computing it if needed.*/
+const chi_mesh::FaceAdjacency&
+chi_mesh::MeshContinuum::GetFaceAdjacency() const
+{
+  std::lock_guard<std::mutex> lock(face_adjacency_mutex_);
+  if (not face_adjacency_)
+    face_adjacency_ = std::make_shared<FaceAdjacency>(
+      *this, Chi::run_time::num_mesh_threads_);
+
+  return *face_adjacency_;
+}
+
+// ###################################################################
+/**Builds, or rebuilds, the flat face view.*/
+void chi_mesh::MeshContinuum::BuildFlatFaceView()
+{
+  std::lock_guard<std::mutex> lock(flat_face_view_mutex_);
+  flat_face_view_ = std::make_shared<FlatFaceView>(*this);
+}
+
+// ###################################################################
+/**Discards the flat face view.*/
+void chi_mesh::MeshContinuum::InvalidateFlatFaceView()
+{
+  std::lock_guard<std::mutex> lock(flat_face_view_mutex_);
+  flat_face_view_ = nullptr;
+}
+
+// ###################################################################
+/**Returns the cached flat face view, building it if needed.*/
+const chi_mesh::FlatFaceView& chi_mesh::MeshContinuum::GetFlatFaceView() const
+{
+  std::lock_guard<std::mutex> lock(flat_face_view_mutex_);
+  if (not flat_face_view_)
+    flat_face_view_ = std::make_shared<FlatFaceView>(*this);
+
+  return *flat_face_view_;
+}
+
 // ###################################################################
 /**Given a global-id of a cell, will return the local-id if the
  * cell is local, otherwise will throw logic_error.*/
@@ -3,51 +3,81 @@
 
 #include "mesh/chi_meshvector.h"
 
-#include <map>
+#include <vector>
+#include <unordered_map>
+#include <stdexcept>
+#include <string>
 
 namespace chi_mesh
 {
 
-/**Manages a vertex map with custom calls.*/
+/**Manages the locally stored vertices with custom calls. Vertices are stored
+ * contiguously, in insertion order, as (global-id, vertex) pairs and
+ * global-ids are resolved via a hash map.*/
 class VertexHandler
 {
-  typedef std::map<uint64_t, chi_mesh::Vector3> GlobalIDMap;
+  typedef std::pair<uint64_t, chi_mesh::Vector3> IDVertexPair;
+  typedef std::vector<IDVertexPair> VertexList;
 private:
-  std::map<uint64_t, chi_mesh::Vector3> m_global_id_vertex_map;
+  VertexList m_vertices;
+  std::unordered_map<uint64_t, size_t> m_global_id_to_index_map;
 
 public:
   // Iterators
-  GlobalIDMap::iterator begin() {return m_global_id_vertex_map.begin();}
-  GlobalIDMap::iterator end() {return m_global_id_vertex_map.end();}
+  VertexList::iterator begin() {return m_vertices.begin();}
+  VertexList::iterator end() {return m_vertices.end();}
 
-  GlobalIDMap::const_iterator begin() const {return m_global_id_vertex_map.begin();}
-  GlobalIDMap::const_iterator end() const {return m_global_id_vertex_map.end();}
+  VertexList::const_iterator begin() const {return m_vertices.begin();}
+  VertexList::const_iterator end() const {return m_vertices.end();}
 
   // Accessors
   chi_mesh::Vector3& operator[](const uint64_t global_id)
   {
-    return m_global_id_vertex_map.at(global_id);
+    return m_vertices[MapGlobalID(global_id)].second;
   }
 
   const chi_mesh::Vector3& operator[](const uint64_t global_id) const
   {
-    return m_global_id_vertex_map.at(global_id);
+    return m_vertices[MapGlobalID(global_id)].second;
   }
 
   // Utilities
+  /**Adds a vertex. If a vertex with the same global-id is already
+   * stored then the call has no effect.*/
   void Insert(const uint64_t global_id, const chi_mesh::Vector3& vec)
   {
-    m_global_id_vertex_map.insert(std::make_pair(global_id, vec));
+    const auto result =
+      m_global_id_to_index_map.insert(std::make_pair(global_id,
+                                                     m_vertices.size()));
+    if (result.second) m_vertices.emplace_back(global_id, vec);
+  }
+
+  void Reserve(const size_t num_vertices)
+  {
+    m_vertices.reserve(num_vertices);
+    m_global_id_to_index_map.reserve(num_vertices);
   }
 
   size_t NumLocallyStored() const
   {
-    return m_global_id_vertex_map.size();
+    return m_vertices.size();
   }
 
   void Clear()
   {
-    m_global_id_vertex_map.clear();
+    m_vertices.clear();
+    m_global_id_to_index_map.clear();
+  }
+
+private:
+  size_t MapGlobalID(const uint64_t global_id) const
+  {
+    const auto it = m_global_id_to_index_map.find(global_id);
+    if (it == m_global_id_to_index_map.end())
+      throw std::out_of_range("VertexHandler: vertex with global-id " +
+                              std::to_string(global_id) +
+                              " is not stored locally.");
+    return it->second;
   }
 };
 
@@ -244,6 +244,10 @@ void chi_mesh::mesh_cutting::
     }//for cell_ptr
   }
 
+  //============================================= Cut cells have new faces
+  mesh.InvalidateFaceAdjacency();
+  mesh.InvalidateFlatFaceView();
+
   Chi::log.Log() << "Done cutting mesh with plane. Num cells = "
                 << mesh.local_cells.size();
 }
\ No newline at end of file
@@ -0,0 +1,349 @@
+#include "DistributedMeshGenerator.h"
+
+#include "data_types/byte_array.h"
+
+#include "mesh/MeshHandler/chi_meshhandler.h"
+#include "mesh/VolumeMesher/chi_volumemesher.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "utils/chi_timer.h"
+
+#include "ChiObjectFactory.h"
+
+#include <algorithm>
+#include <set>
+
+namespace chi_mesh
+{
+
+RegisterChiObject(chi_mesh, DistributedMeshGenerator);
+
+namespace
+{
+/**Parts are sent in messages of at most this many bytes to stay within the
+ * range of an MPI count.*/
+constexpr uint64_t MAX_MESSAGE_SIZE = 1 << 30;
+} // namespace
+
+// ##################################################################
+chi::InputParameters DistributedMeshGenerator::GetInputParameters()
+{
+  chi::InputParameters params = MeshGenerator::GetInputParameters();
+
+  params.SetGeneralDescription(
+    "Generates the mesh only on location 0, thereafter partitions the mesh"
+    " and sends each location only its local cells, ghost cells and their"
+    " vertices.");
+  params.SetDocGroup("doc_MeshGenerators");
+
+  params.AddOptionalParameter(
+    "verbosity_level",
+    1,
+    "Verbosity level. 1 will report each 10% complete. 2 will print each part "
+    "and the number of local cells sent to it.");
+
+  return params;
+}
+
+// ##################################################################
+DistributedMeshGenerator::DistributedMeshGenerator(
+  const chi::InputParameters& params)
+  : MeshGenerator(params),
+    verbosity_level_(params.GetParamValue<int>("verbosity_level"))
+{
+  ChiInvalidArgumentIf(replicated_,
+                       "The DistributedMeshGenerator does not support "
+                       "replicated meshes.");
+}
+
+// ##################################################################
+void DistributedMeshGenerator::Execute()
+{
+  const int num_parts = Chi::mpi.process_count;
+
+  chi_data_types::ByteArray local_part;
+  if (Chi::mpi.location_id == 0)
+  {
+    //======================================== Execute all input generators
+    // Note these could be empty
+    std::unique_ptr<UnpartitionedMesh> current_umesh = nullptr;
+    for (auto mesh_generator_ptr : inputs_)
+    {
+      auto new_umesh =
+        mesh_generator_ptr->GenerateUnpartitionedMesh(std::move(current_umesh));
+      current_umesh = std::move(new_umesh);
+    }
+
+    //======================================== Generate final umesh
+    current_umesh = GenerateUnpartitionedMesh(std::move(current_umesh));
+
+    const auto cell_pids = PartitionMesh(*current_umesh, num_parts);
+
+    //======================================== Sort local cells per part
+    std::vector<std::vector<uint64_t>> part_local_cell_ids(num_parts);
+    for (uint64_t cell_global_id = 0; cell_global_id < cell_pids.size();
+         ++cell_global_id)
+      part_local_cell_ids[cell_pids[cell_global_id]].push_back(cell_global_id);
+
+    //======================================== Sort cells by the last part
+    //                                          needing them
+    // A cell is needed by its own part and, as a ghost, by the parts of all
+    // the cells sharing a vertex with it. Parts are serialized in ascending
+    // order, hence a cell can be freed as soon as the highest of these parts
+    // is serialized.
+    std::vector<std::vector<uint64_t>> part_last_cell_ids(num_parts);
+    {
+      const auto& vertex_subs = current_umesh->GetVertextCellSubscriptions();
+      const auto& raw_cells = current_umesh->GetRawCells();
+      for (uint64_t cell_global_id = 0; cell_global_id < cell_pids.size();
+           ++cell_global_id)
+      {
+        int64_t last_pid = cell_pids[cell_global_id];
+        for (uint64_t vid : raw_cells[cell_global_id]->vertex_ids)
+          for (uint64_t neighbor_gid : vertex_subs[vid])
+            last_pid = std::max(last_pid, cell_pids[neighbor_gid]);
+
+        part_last_cell_ids[last_pid].push_back(cell_global_id);
+      }
+    }
+
+    auto FreeCellsLastNeededBy = [&current_umesh, &part_last_cell_ids](int pid)
+    {
+      auto& raw_cells = current_umesh->GetRawCells();
+      for (uint64_t cell_global_id : part_last_cell_ids[pid])
+      {
+        delete raw_cells[cell_global_id];
+        raw_cells[cell_global_id] = nullptr;
+      }
+      std::vector<uint64_t>().swap(part_last_cell_ids[pid]);
+    };
+
+    //======================================== Serialize the home part
+    local_part =
+      SerializePart(part_local_cell_ids[0], cell_pids, *current_umesh);
+    std::vector<uint64_t>().swap(part_local_cell_ids[0]);
+    FreeCellsLastNeededBy(0);
+
+    //======================================== Send the parts one at a time
+    Chi::log.Log() << "Distributing mesh to " << num_parts << " locations";
+    uint64_t aux_counter = 0;
+    for (int pid = 1; pid < num_parts; ++pid)
+    {
+      if (verbosity_level_ >= 2)
+        Chi::log.Log() << "Sending part " << pid << " num_local_cells="
+                       << part_local_cell_ids[pid].size();
+
+      SendPart(
+        SerializePart(part_local_cell_ids[pid], cell_pids, *current_umesh),
+        pid);
+      std::vector<uint64_t>().swap(part_local_cell_ids[pid]);
+      FreeCellsLastNeededBy(pid);
+
+      const double fraction_complete =
+        static_cast<double>(pid) / static_cast<double>(num_parts);
+      if (fraction_complete >= static_cast<double>(aux_counter + 1) * 0.1)
+      {
+        if (verbosity_level_ >= 1)
+          Chi::log.Log() << Chi::program_timer.GetTimeString()
+                         << " Surpassing part " << pid << " of " << num_parts
+                         << " (" << (aux_counter + 1) * 10 << "%)";
+        ++aux_counter;
+      }
+    } // for pid
+  } // if home location
+  else
+    local_part = ReceivePart(0);
+
+  auto mesh_info = DeserializePart(local_part);
+  local_part.Clear();
+
+  auto grid_ptr = SetupLocalMesh(mesh_info);
+
+  //======================================== Assign the mesh to a VolumeMesher
+  auto new_mesher =
+    std::make_shared<chi_mesh::VolumeMesher>(VolumeMesherType::UNPARTITIONED);
+  new_mesher->SetContinuum(grid_ptr);
+
+  if (Chi::current_mesh_handler < 0) chi_mesh::PushNewHandlerAndGetIndex();
+
+  auto& cur_hndlr = chi_mesh::GetCurrentHandler();
+  cur_hndlr.SetVolumeMesher(new_mesher);
+
+  Chi::log.Log() << "Done distributing mesh";
+
+  Chi::mpi.Barrier();
+}
+
+// ##################################################################
+/**Serializes the local cells of a part, the ghost cells sharing a vertex
+ * with them and the vertices of both.*/
+chi_data_types::ByteArray DistributedMeshGenerator::SerializePart(
+  const std::vector<uint64_t>& local_cell_ids,
+  const std::vector<int64_t>& cell_pids,
+  const UnpartitionedMesh& umesh)
+{
+  const auto& vertex_subs = umesh.GetVertextCellSubscriptions();
+  const auto& raw_cells = umesh.GetRawCells();
+  const auto& raw_vertices = umesh.GetVertices();
+
+  //============================================= Collect cells and vertices
+  std::set<uint64_t> cells_needed;
+  std::set<uint64_t> vertices_needed;
+  for (uint64_t cell_global_id : local_cell_ids)
+  {
+    cells_needed.insert(cell_global_id);
+
+    for (uint64_t vid : raw_cells[cell_global_id]->vertex_ids)
+      for (uint64_t ghost_gid : vertex_subs[vid])
+        cells_needed.insert(ghost_gid);
+  }
+  for (uint64_t cell_global_id : cells_needed)
+    for (uint64_t vid : raw_cells[cell_global_id]->vertex_ids)
+      vertices_needed.insert(vid);
+
+  //============================================= Write mesh attributes
+  //                                              and general info
+  const auto& mesh_options = umesh.GetMeshOptions();
+
+  chi_data_types::ByteArray part;
+  part.Write(static_cast<int>(umesh.GetMeshAttributes()));
+  part.Write(mesh_options.ortho_Nx);
+  part.Write(mesh_options.ortho_Ny);
+  part.Write(mesh_options.ortho_Nz);
+  part.Write(raw_vertices.size());
+
+  //============================================= Write the boundary map
+  part.Write(mesh_options.boundary_id_map.size());
+  for (const auto& [bid, bname] : mesh_options.boundary_id_map)
+  {
+    part.Write(bid);
+    part.Write(bname.size());
+    for (const char c : bname)
+      part.Write(c);
+  }
+
+  //============================================= Write cells
+  part.Write(cells_needed.size());
+  for (uint64_t cell_global_id : cells_needed)
+  {
+    part.Write(static_cast<int>(cell_pids[cell_global_id]));
+    part.Write(cell_global_id);
+    SerializeCell(*raw_cells[cell_global_id], part);
+  }
+
+  //============================================= Write vertices
+  part.Write(vertices_needed.size());
+  for (uint64_t vid : vertices_needed)
+  {
+    part.Write(vid);
+    part.Write(raw_vertices[vid]);
+  }
+
+  return part;
+}
+
+// ##################################################################
+/**Deserializes a part written with SerializePart.*/
+MeshGenerator::LocalMeshInfo
+DistributedMeshGenerator::DeserializePart(chi_data_types::ByteArray& part)
+{
+  LocalMeshInfo info_block;
+
+  //============================================= Read mesh attributes
+  //                                              and general info
+  info_block.mesh_attributes_ = part.Read<int>();
+  info_block.ortho_Nx_ = part.Read<size_t>();
+  info_block.ortho_Ny_ = part.Read<size_t>();
+  info_block.ortho_Nz_ = part.Read<size_t>();
+  info_block.num_global_vertices_ = part.Read<size_t>();
+
+  //============================================= Read the boundary map
+  const size_t num_bndries = part.Read<size_t>();
+  for (size_t b = 0; b < num_bndries; ++b)
+  {
+    const uint64_t bid = part.Read<uint64_t>();
+    const size_t num_chars = part.Read<size_t>();
+    std::string bname(num_chars, ' ');
+    for (size_t c = 0; c < num_chars; ++c)
+      bname[c] = part.Read<char>();
+
+    info_block.boundary_id_map_.insert(std::make_pair(bid, bname));
+  }
+
+  //============================================= Read the cells
+  const size_t num_cells = part.Read<size_t>();
+  for (size_t c = 0; c < num_cells; ++c)
+  {
+    const int cell_pid = part.Read<int>();
+    const uint64_t cell_gid = part.Read<uint64_t>();
+
+    info_block.cells_.insert(
+      std::make_pair(CellPIDGID(cell_pid, cell_gid), DeserializeCell(part)));
+  }
+
+  //============================================= Read the vertices
+  const size_t num_vertices = part.Read<size_t>();
+  for (size_t v = 0; v < num_vertices; ++v)
+  {
+    const uint64_t vid = part.Read<uint64_t>();
+    info_block.vertices_.insert(
+      std::make_pair(vid, part.Read<chi_mesh::Vector3>()));
+  }
+
+  return info_block;
+}
+
+// ##################################################################
+/**Sends a part to a location, splitting it into messages of at most
+ * MAX_MESSAGE_SIZE bytes.*/
+void DistributedMeshGenerator::SendPart(const chi_data_types::ByteArray& part,
+                                        int location_id)
+{
+  const uint64_t num_bytes = part.Size();
+  MPI_Send(&num_bytes, 1, MPI_UINT64_T, location_id, 0, Chi::mpi.comm);
+
+  for (uint64_t offset = 0; offset < num_bytes; offset += MAX_MESSAGE_SIZE)
+  {
+    const uint64_t count = std::min(MAX_MESSAGE_SIZE, num_bytes - offset);
+    MPI_Send(part.Data().data() + offset,
+             static_cast<int>(count),
+             MPI_BYTE,
+             location_id,
+             0,
+             Chi::mpi.comm);
+  }
+}
+
+// ##################################################################
+/**Receives a part sent with SendPart.*/
+chi_data_types::ByteArray
+DistributedMeshGenerator::ReceivePart(int source_location_id)
+{
+  uint64_t num_bytes = 0;
+  MPI_Recv(&num_bytes,
+           1,
+           MPI_UINT64_T,
+           source_location_id,
+           0,
+           Chi::mpi.comm,
+           MPI_STATUS_IGNORE);
+
+  chi_data_types::ByteArray part(num_bytes);
+  for (uint64_t offset = 0; offset < num_bytes; offset += MAX_MESSAGE_SIZE)
+  {
+    const uint64_t count = std::min(MAX_MESSAGE_SIZE, num_bytes - offset);
+    MPI_Recv(part.Data().data() + offset,
+             static_cast<int>(count),
+             MPI_BYTE,
+             source_location_id,
+             0,
+             Chi::mpi.comm,
+             MPI_STATUS_IGNORE);
+  }
+
+  return part;
+}
+
+} // namespace chi_mesh
@@ -0,0 +1,40 @@
+#ifndef CHITECH_DISTRIBUTEDMESHGENERATOR_H
+#define CHITECH_DISTRIBUTEDMESHGENERATOR_H
+
+#include "MeshGenerator.h"
+
+namespace chi_mesh
+{
+
+/**Generates the mesh only on location 0, thereafter partitions the mesh and
+ * sends each location only its local cells, ghost cells and their vertices.
+ * No other location ever holds the full mesh and, unlike the
+ * SplitFileMeshGenerator, no intermediate files are written. Location 0
+ * frees each cell of the full mesh once the last part needing it has been
+ * serialized.*/
+class DistributedMeshGenerator : public MeshGenerator
+{
+public:
+  static chi::InputParameters GetInputParameters();
+  explicit DistributedMeshGenerator(const chi::InputParameters& params);
+
+  void Execute() override;
+
+protected:
+  /**Serializes the part of the mesh required by a single location.*/
+  static chi_data_types::ByteArray
+  SerializePart(const std::vector<uint64_t>& local_cell_ids,
+                const std::vector<int64_t>& cell_pids,
+                const UnpartitionedMesh& umesh);
+  /**Deserializes a part written with SerializePart.*/
+  static LocalMeshInfo DeserializePart(chi_data_types::ByteArray& part);
+
+  static void SendPart(const chi_data_types::ByteArray& part, int location_id);
+  static chi_data_types::ByteArray ReceivePart(int source_location_id);
+
+  const int verbosity_level_;
+};
+
+} // namespace chi_mesh
+
+#endif // CHITECH_DISTRIBUTEDMESHGENERATOR_H
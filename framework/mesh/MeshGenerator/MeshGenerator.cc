@@ -43,13 +43,44 @@ chi::InputParameters MeshGenerator::GetInputParameters()
     false,
     "Flag, when set, makes the mesh appear in full fidelity on each process");
 
+  params.AddOptionalParameter(
+    "partition_weights",
+    "none",
+    "Weights to pass to the partitioner. \"none\" partitions an unweighted "
+    "cell graph. \"cost\" weighs each cell by its estimated sweep cost, "
+    "(number of nodes squared plus number of faces) times its material cost "
+    "factor, and each cell-to-cell edge by the number of vertices on the "
+    "shared face.");
+  using namespace chi_data_types;
+  params.ConstrainParameterRange("partition_weights",
+                                 AllowableRangeList::New({"none", "cost"}));
+
+  params.AddOptionalParameter(
+    "partition_multi_constraint",
+    false,
+    "If true, and \"partition_weights\" is \"cost\", the cell count is "
+    "balanced as a second constraint alongside the cost.");
+
+  params.AddOptionalParameterArray(
+    "material_cost_factors",
+    std::vector<double>{},
+    "Cost factor per material id used with \"partition_weights\"=\"cost\", "
+    "for example the number of groups solved on each material. Materials "
+    "not listed get a factor of 1.0.");
+
   return params;
 }
 
 MeshGenerator::MeshGenerator(const chi::InputParameters& params)
   : ChiObject(params),
     scale_(params.GetParamValue<double>("scale")),
-    replicated_(params.GetParamValue<bool>("replicated_mesh"))
+    replicated_(params.GetParamValue<bool>("replicated_mesh")),
+    cost_weighted_partitioning_(
+      params.GetParamValue<std::string>("partition_weights") == "cost"),
+    partition_multi_constraint_(
+      params.GetParamValue<bool>("partition_multi_constraint")),
+    material_cost_factors_(
+      params.GetParamVectorValue<double>("material_cost_factors"))
 {
   //============================================= Convert input handles
   auto input_handles = params.GetParamVectorValue<size_t>("inputs");
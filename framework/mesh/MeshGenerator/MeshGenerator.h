@@ -9,6 +9,11 @@ namespace chi
 class GraphPartitioner;
 }
 
+namespace chi_data_types
+{
+class ByteArray;
+}
+
 namespace chi_mesh
 {
 
@@ -65,6 +70,10 @@ protected:
    * partition ids based on the supplied number of partitions.*/
   std::vector<int64_t> PartitionMesh(const UnpartitionedMesh& input_umesh,
                                      int num_partitions);
+  /**Estimates the relative sweep cost of a cell, used as its partitioning
+   * weight.*/
+  int64_t ComputeCellCost(const UnpartitionedMesh::LightWeightCell& raw_cell)
+    const;
 
   /**Executes the partitioner and configures the mesh as a real mesh.*/
   std::shared_ptr<MeshContinuum>
@@ -78,12 +87,12 @@ protected:
                             int root,
                             MPI_Comm communicator);
   /**Determines if a cells needs to be included as a ghost or as a local cell.*/
-  bool
-  CellHasLocalScope(int location_id,
-                    const chi_mesh::UnpartitionedMesh::LightWeightCell& lwcell,
-                    uint64_t cell_global_id,
-                    const std::vector<std::set<uint64_t>>& vertex_subscriptions,
-                    const std::vector<int64_t>& cell_partition_ids) const;
+  bool CellHasLocalScope(
+    int location_id,
+    const chi_mesh::UnpartitionedMesh::LightWeightCell& lwcell,
+    uint64_t cell_global_id,
+    const UnpartitionedMesh::VertexCellSubscriptions& vertex_subscriptions,
+    const std::vector<int64_t>& cell_partition_ids) const;
 
   /**Converts a light-weight cell to a real cell.*/
   static std::unique_ptr<chi_mesh::Cell>
@@ -98,8 +107,39 @@ protected:
 
   static void ComputeAndPrintStats(const chi_mesh::MeshContinuum& grid) ;
 
+  // Local meshes
+  typedef std::pair<int, uint64_t> CellPIDGID;
+  /**The part of a mesh required by a single location, i.e., its local
+   * cells, its ghost cells and all of their vertices.*/
+  struct LocalMeshInfo
+  {
+    std::map<CellPIDGID, UnpartitionedMesh::LightWeightCell> cells_;
+    std::map<uint64_t, chi_mesh::Vector3> vertices_;
+    std::map<uint64_t, std::string> boundary_id_map_;
+    int mesh_attributes_;
+    size_t ortho_Nx_;
+    size_t ortho_Ny_;
+    size_t ortho_Nz_;
+    size_t num_global_vertices_;
+  };
+
+  /**Serializes a light-weight cell.*/
+  static void SerializeCell(const UnpartitionedMesh::LightWeightCell& cell,
+                            chi_data_types::ByteArray& serial_buffer);
+  /**Deserializes a light-weight cell written with SerializeCell.*/
+  static UnpartitionedMesh::LightWeightCell
+  DeserializeCell(chi_data_types::ByteArray& serial_buffer);
+
+  /**Configures a real mesh from the cells and vertices of a single
+   * location.*/
+  static std::shared_ptr<MeshContinuum>
+  SetupLocalMesh(LocalMeshInfo& mesh_info);
+
   const double scale_;
   const bool replicated_;
+  const bool cost_weighted_partitioning_;
+  const bool partition_multi_constraint_;
+  const std::vector<double> material_cost_factors_;
   std::vector<MeshGenerator*> inputs_;
   chi::GraphPartitioner* partitioner_ = nullptr;
 };
@@ -6,6 +6,8 @@
 
 #include "chi_log.h"
 
+#include <cmath>
+
 namespace chi_mesh
 {
 /**Builds a cell-graph and executes the partitioner.*/
@@ -23,18 +25,31 @@ MeshGenerator::PartitionMesh(const UnpartitionedMesh& input_umesh,
   typedef std::vector<CellGraphNode> CellGraph;
   CellGraph cell_graph;
   std::vector<chi_mesh::Vector3> cell_centroids;
+  std::vector<int64_t> cell_costs;
+  std::vector<std::vector<int64_t>> edge_weights;
 
   cell_graph.reserve(num_raw_cells);
   cell_centroids.reserve(num_raw_cells);
+  cell_costs.reserve(num_raw_cells);
+  if (cost_weighted_partitioning_) edge_weights.reserve(num_raw_cells);
   {
     for (const auto& raw_cell_ptr : raw_cells)
     {
       CellGraphNode cell_graph_node; // <-- Note A
+      std::vector<int64_t> cell_edge_weights;
       for (auto& face : raw_cell_ptr->faces)
-        if (face.has_neighbor) cell_graph_node.push_back(face.neighbor);
+        if (face.has_neighbor)
+        {
+          cell_graph_node.push_back(face.neighbor);
+          cell_edge_weights.push_back(
+            static_cast<int64_t>(face.vertex_ids.size()));
+        }
 
       cell_graph.push_back(cell_graph_node);
       cell_centroids.push_back(raw_cell_ptr->centroid);
+      cell_costs.push_back(ComputeCellCost(*raw_cell_ptr));
+      if (cost_weighted_partitioning_)
+        edge_weights.push_back(std::move(cell_edge_weights));
     }
   }
 
@@ -42,12 +57,39 @@ MeshGenerator::PartitionMesh(const UnpartitionedMesh& input_umesh,
   // to produce sub-optimal partitions
 
   //============================================= Execute partitioner
-  std::vector<int64_t> cell_pids =
-    partitioner_->Partition(cell_graph, cell_centroids, num_partitions);
+  std::vector<int64_t> cell_pids;
+  if (cost_weighted_partitioning_)
+  {
+    chi::GraphWeights weights;
+    weights.edge_weights = std::move(edge_weights);
+    if (partition_multi_constraint_)
+    {
+      // Constraint 0: cost, constraint 1: cell count
+      weights.num_constraints = 2;
+      weights.vertex_weights.reserve(2 * num_raw_cells);
+      for (const int64_t cost : cell_costs)
+      {
+        weights.vertex_weights.push_back(cost);
+        weights.vertex_weights.push_back(1);
+      }
+    }
+    else
+      weights.vertex_weights = cell_costs;
+
+    cell_pids = partitioner_->WeightedPartition(
+      cell_graph, cell_centroids, num_partitions, weights);
+  }
+  else
+    cell_pids =
+      partitioner_->Partition(cell_graph, cell_centroids, num_partitions);
 
   std::vector<size_t> partI_num_cells(num_partitions, 0);
-  for (int64_t pid : cell_pids)
-    partI_num_cells[pid] += 1;
+  std::vector<double> partI_cost(num_partitions, 0.0);
+  for (size_t c = 0; c < num_raw_cells; ++c)
+  {
+    partI_num_cells[cell_pids[c]] += 1;
+    partI_cost[cell_pids[c]] += static_cast<double>(cell_costs[c]);
+  }
 
   size_t max_num_cells = partI_num_cells.front();
   size_t min_num_cells = partI_num_cells.front();
@@ -63,9 +105,40 @@ MeshGenerator::PartitionMesh(const UnpartitionedMesh& input_umesh,
   Chi::log.Log() << "Partitioner num_cells allocated max,min,avg = "
     << max_num_cells << "," << min_num_cells << "," << avg_num_cells;
 
+  //============================================= Predicted sweep imbalance
+  double max_cost = partI_cost.front();
+  double avg_cost = 0.0;
+  for (double cost : partI_cost)
+  {
+    max_cost = std::max(max_cost, cost);
+    avg_cost += cost;
+  }
+  avg_cost /= num_partitions;
+
+  Chi::log.Log() << "Partitioner predicted cost imbalance max/avg = "
+                 << (avg_cost > 0.0 ? max_cost / avg_cost : 1.0);
+
   return cell_pids;
 }
 
+/**Estimates the relative cost of sweeping a cell as the number of nodes
+ * squared plus the number of faces, scaled by the material cost factor.*/
+int64_t MeshGenerator::ComputeCellCost(
+  const UnpartitionedMesh::LightWeightCell& raw_cell) const
+{
+  const auto num_nodes = static_cast<double>(raw_cell.vertex_ids.size());
+  const auto num_faces = static_cast<double>(raw_cell.faces.size());
+
+  double factor = 1.0;
+  if (raw_cell.material_id >= 0 and
+      static_cast<size_t>(raw_cell.material_id) < material_cost_factors_.size())
+    factor = material_cost_factors_[raw_cell.material_id];
+
+  const double cost = (num_nodes * num_nodes + num_faces) * factor;
+
+  return std::max<int64_t>(1, std::llround(cost));
+}
+
 /**Executes the partitioner and configures the mesh as a real mesh.*/
 std::shared_ptr<MeshContinuum>
 MeshGenerator::SetupMesh(std::unique_ptr<UnpartitionedMesh> input_umesh_ptr,
@@ -115,6 +188,48 @@ MeshGenerator::SetupMesh(std::unique_ptr<UnpartitionedMesh> input_umesh_ptr,
 
   ComputeAndPrintStats(*grid_ptr);
 
+  grid_ptr->BuildFaceAdjacency();
+  grid_ptr->BuildFlatFaceView();
+
+  return grid_ptr;
+}
+
+/**Configures a real mesh from the cells and vertices of a single location.*/
+std::shared_ptr<MeshContinuum>
+MeshGenerator::SetupLocalMesh(LocalMeshInfo& mesh_info)
+{
+  auto grid_ptr = chi_mesh::MeshContinuum::New();
+
+  grid_ptr->GetBoundaryIDMap() = mesh_info.boundary_id_map_;
+
+  auto& cells = mesh_info.cells_;
+  auto& vertices = mesh_info.vertices_;
+
+  grid_ptr->vertices.Reserve(vertices.size());
+  for (const auto& [vid, vertex] : vertices)
+    grid_ptr->vertices.Insert(vid, vertex);
+
+  for (const auto& [pidgid, raw_cell] : cells)
+  {
+    const auto& [cell_pid, cell_global_id] = pidgid;
+    auto cell = SetupCell(
+      raw_cell, cell_global_id, cell_pid, STLVertexListHelper(vertices));
+
+    grid_ptr->cells.push_back(std::move(cell));
+  }
+
+  SetGridAttributes(
+    *grid_ptr,
+    static_cast<MeshAttributes>(mesh_info.mesh_attributes_),
+    {mesh_info.ortho_Nx_, mesh_info.ortho_Ny_, mesh_info.ortho_Nz_});
+
+  grid_ptr->SetGlobalVertexCount(mesh_info.num_global_vertices_);
+
+  ComputeAndPrintStats(*grid_ptr);
+
+  grid_ptr->BuildFaceAdjacency();
+  grid_ptr->BuildFlatFaceView();
+
   return grid_ptr;
 }
 
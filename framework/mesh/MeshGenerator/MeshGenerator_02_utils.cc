@@ -1,5 +1,7 @@
 #include "MeshGenerator.h"
 
+#include "data_types/byte_array.h"
+
 namespace chi_mesh
 {
 
@@ -36,7 +38,7 @@ bool MeshGenerator::CellHasLocalScope(
   int location_id,
   const chi_mesh::UnpartitionedMesh::LightWeightCell& lwcell,
   uint64_t cell_global_id,
-  const std::vector<std::set<uint64_t>>& vertex_subscriptions,
+  const UnpartitionedMesh::VertexCellSubscriptions& vertex_subscriptions,
   const std::vector<int64_t>& cell_partition_ids) const
 {
   if (replicated_) return true;
@@ -146,4 +148,65 @@ MeshGenerator::SetupCell(
   return cell;
 }
 
+// ###################################################################
+/**Serializes a light-weight cell.*/
+void MeshGenerator::SerializeCell(
+  const UnpartitionedMesh::LightWeightCell& cell,
+  chi_data_types::ByteArray& serial_buffer)
+{
+  serial_buffer.Write(cell.type);
+  serial_buffer.Write(cell.sub_type);
+  serial_buffer.Write(cell.centroid);
+  serial_buffer.Write(cell.material_id);
+  serial_buffer.Write(cell.vertex_ids.size());
+  for (uint64_t vid : cell.vertex_ids)
+    serial_buffer.Write(vid);
+  serial_buffer.Write(cell.faces.size());
+  for (const auto& face : cell.faces)
+  {
+    serial_buffer.Write(face.vertex_ids.size());
+    for (uint64_t vid : face.vertex_ids)
+      serial_buffer.Write(vid);
+    serial_buffer.Write(face.has_neighbor);
+    serial_buffer.Write(face.neighbor);
+  }
+}
+
+// ###################################################################
+/**Deserializes a light-weight cell written with SerializeCell.*/
+UnpartitionedMesh::LightWeightCell
+MeshGenerator::DeserializeCell(chi_data_types::ByteArray& serial_buffer)
+{
+  const auto cell_type = serial_buffer.Read<CellType>();
+  const auto cell_sub_type = serial_buffer.Read<CellType>();
+
+  UnpartitionedMesh::LightWeightCell cell(cell_type, cell_sub_type);
+
+  cell.centroid = serial_buffer.Read<chi_mesh::Vector3>();
+  cell.material_id = serial_buffer.Read<int>();
+
+  const size_t num_vids = serial_buffer.Read<size_t>();
+  cell.vertex_ids.reserve(num_vids);
+  for (size_t v = 0; v < num_vids; ++v)
+    cell.vertex_ids.push_back(serial_buffer.Read<uint64_t>());
+
+  const size_t num_faces = serial_buffer.Read<size_t>();
+  cell.faces.reserve(num_faces);
+  for (size_t f = 0; f < num_faces; ++f)
+  {
+    UnpartitionedMesh::LightWeightFace face;
+    const size_t num_face_vids = serial_buffer.Read<size_t>();
+    face.vertex_ids.reserve(num_face_vids);
+    for (size_t v = 0; v < num_face_vids; ++v)
+      face.vertex_ids.push_back(serial_buffer.Read<uint64_t>());
+
+    face.has_neighbor = serial_buffer.Read<bool>();
+    face.neighbor = serial_buffer.Read<uint64_t>();
+
+    cell.faces.push_back(std::move(face));
+  }
+
+  return cell;
+}
+
 } // namespace chi_mesh
\ No newline at end of file
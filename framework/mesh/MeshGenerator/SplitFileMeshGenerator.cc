@@ -324,29 +324,7 @@ void SplitFileMeshGenerator::WriteSplitMesh(
 }
 
 // ##################################################################
-void SplitFileMeshGenerator::SerializeCell(
-  const UnpartitionedMesh::LightWeightCell& cell,
-  chi_data_types::ByteArray& serial_buffer)
-{
-  serial_buffer.Write(cell.type);
-  serial_buffer.Write(cell.sub_type);
-  serial_buffer.Write(cell.centroid);
-  serial_buffer.Write(cell.material_id);
-  serial_buffer.Write(cell.vertex_ids.size());
-  for (uint64_t vid : cell.vertex_ids)
-    serial_buffer.Write(vid);
-  serial_buffer.Write(cell.faces.size());
-  for (const auto& face : cell.faces)
-  {
-    serial_buffer.Write(face.vertex_ids.size());
-    for (uint64_t vid : face.vertex_ids)
-      serial_buffer.Write(vid);
-    serial_buffer.Write(face.has_neighbor);
-    serial_buffer.Write(face.neighbor);
-  }
-}
-
-SplitFileMeshGenerator::SplitMeshInfo SplitFileMeshGenerator::ReadSplitMesh()
+MeshGenerator::LocalMeshInfo SplitFileMeshGenerator::ReadSplitMesh()
 {
   const int pid = Chi::mpi.location_id;
   const std::filesystem::path dir_path =
@@ -355,7 +333,7 @@ SplitFileMeshGenerator::SplitMeshInfo SplitFileMeshGenerator::ReadSplitMesh()
                                           split_file_prefix_ + "_" +
                                           std::to_string(pid) + ".cmesh";
 
-  SplitMeshInfo info_block;
+  LocalMeshInfo info_block;
   auto& cells = info_block.cells_;
   auto& vertices = info_block.vertices_;
   std::ifstream ifile(file_path, std::ios_base::binary | std::ios_base::in);
@@ -447,38 +425,4 @@ SplitFileMeshGenerator::SplitMeshInfo SplitFileMeshGenerator::ReadSplitMesh()
   return info_block;
 }
 
-std::shared_ptr<MeshContinuum>
-SplitFileMeshGenerator::SetupLocalMesh(SplitMeshInfo& mesh_info)
-{
-  auto grid_ptr = chi_mesh::MeshContinuum::New();
-
-  grid_ptr->GetBoundaryIDMap() = mesh_info.boundary_id_map_;
-
-  auto& cells = mesh_info.cells_;
-  auto& vertices = mesh_info.vertices_;
-
-  for (const auto& [vid, vertex] : vertices)
-    grid_ptr->vertices.Insert(vid, vertex);
-
-  for (const auto& [pidgid, raw_cell] : cells)
-  {
-    const auto& [cell_pid, cell_global_id] = pidgid;
-    auto cell = SetupCell(
-      raw_cell, cell_global_id, cell_pid, STLVertexListHelper(vertices));
-
-    grid_ptr->cells.push_back(std::move(cell));
-  }
-
-  SetGridAttributes(
-    *grid_ptr,
-    static_cast<MeshAttributes>(mesh_info.mesh_attributes_),
-    {mesh_info.ortho_Nx_, mesh_info.ortho_Ny_, mesh_info.ortho_Nz_});
-
-  grid_ptr->SetGlobalVertexCount(mesh_info.num_global_vertices_);
-
-  ComputeAndPrintStats(*grid_ptr);
-
-  return grid_ptr;
-}
-
 } // namespace chi_mesh
\ No newline at end of file
@@ -3,11 +3,6 @@
 
 #include "MeshGenerator.h"
 
-namespace chi_data_types
-{
-class ByteArray;
-}
-
 namespace chi_mesh
 {
 
@@ -26,23 +21,7 @@ protected:
   void WriteSplitMesh(const std::vector<int64_t>& cell_pids,
                       const UnpartitionedMesh& umesh,
                       int num_parts);
-  static void SerializeCell(const UnpartitionedMesh::LightWeightCell& cell,
-                            chi_data_types::ByteArray& serial_buffer);
-  typedef std::pair<int, uint64_t> CellPIDGID;
-  struct SplitMeshInfo
-  {
-    std::map<CellPIDGID, UnpartitionedMesh::LightWeightCell> cells_;
-    std::map<uint64_t, chi_mesh::Vector3> vertices_;
-    std::map<uint64_t, std::string> boundary_id_map_;
-    int mesh_attributes_;
-    size_t ortho_Nx_;
-    size_t ortho_Ny_;
-    size_t ortho_Nz_;
-    size_t num_global_vertices_;
-  };
-  SplitMeshInfo ReadSplitMesh();
-
-  static std::shared_ptr<MeshContinuum> SetupLocalMesh(SplitMeshInfo& mesh_info);
+  LocalMeshInfo ReadSplitMesh();
 
   // void
   const int num_parts_;
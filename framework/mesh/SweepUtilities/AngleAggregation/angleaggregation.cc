@@ -6,6 +6,8 @@
 #include "chi_log.h"
 #include "chi_mpi.h"
 
+#include <algorithm>
+
 #define ExceptionReflectedAngleError                                           \
   std::logic_error(                                                            \
     fname + "Reflected angle not found for angle " + std::to_string(n) +       \
@@ -44,11 +46,14 @@ void chi_mesh::sweep_management::AngleAggregation::ZeroOutgoingDelayedPsi()
   for (auto& angsetgrp : angle_set_groups)
     for (auto& angset : angsetgrp.AngleSets())
       for (auto& delayed_data : angset->GetFLUDS().DelayedPrelocIOutgoingPsi())
-        chi_math::Set(delayed_data, 0.0);
+        std::fill(delayed_data.begin(), delayed_data.end(), 0.0);
 
   for (auto& angsetgrp : angle_set_groups)
     for (auto& angset : angsetgrp.AngleSets())
-      chi_math::Set(angset->GetFLUDS().DelayedLocalPsi(), 0.0);
+    {
+      auto& delayed_data = angset->GetFLUDS().DelayedLocalPsi();
+      std::fill(delayed_data.begin(), delayed_data.end(), 0.0);
+    }
 }
 
 // ###################################################################
@@ -77,13 +82,16 @@ void chi_mesh::sweep_management::AngleAggregation::ZeroIncomingDelayedPsi()
   //======================================== Intra-cell cycles
   for (auto& as_group : angle_set_groups)
     for (auto& angle_set : as_group.AngleSets())
-      chi_math::Set(angle_set->GetFLUDS().DelayedLocalPsiOld(), 0.0);
+    {
+      auto& delayed_data = angle_set->GetFLUDS().DelayedLocalPsiOld();
+      std::fill(delayed_data.begin(), delayed_data.end(), 0.0);
+    }
 
   //======================================== Inter location cycles
   for (auto& as_group : angle_set_groups)
     for (auto& angle_set : as_group.AngleSets())
       for (auto& loc_vector : angle_set->GetFLUDS().DelayedPrelocIOutgoingPsiOld())
-        chi_math::Set(loc_vector, 0.0);
+        std::fill(loc_vector.begin(), loc_vector.end(), 0.0);
 }
 
 // ###################################################################
@@ -204,8 +212,9 @@ void chi_mesh::sweep_management::AngleAggregation::InitializeReflectingBCs()
                 (face.normal_.Dot(rbndry.Normal()) > 0.999999))
             {
               cell_vec[c][f].clear();
-              cell_vec[c][f].resize(face.vertex_ids_.size(),
-                                    std::vector<double>(number_of_groups, 0.0));
+              cell_vec[c][f].resize(
+                face.vertex_ids_.size(),
+                std::vector<PsiFloat>(number_of_groups, 0.0));
             }
             ++f;
           }
@@ -71,27 +71,53 @@ AAH_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk,
   else if (status == Status::READY_TO_EXECUTE and
            permission == ExecutionPermission::EXECUTE)
   {
-    async_comm_.InitializeLocalAndDownstreamBuffers();
+    InitializeExecution();
 
     Chi::log.LogEvent(timing_tags[0], chi::ChiLog::EventType::EVENT_BEGIN);
-    sweep_chunk.Sweep(*this); // Execute chunk
+    ExecuteSweepChunk(sweep_chunk);
     Chi::log.LogEvent(timing_tags[0], chi::ChiLog::EventType::EVENT_END);
 
-    // Send outgoing psi and clear local and receive buffers
-    async_comm_.SendDownstreamPsi(static_cast<int>(this->GetID()));
-    async_comm_.ClearLocalAndReceiveBuffers();
+    FinalizeExecution();
 
-    // Update boundary readiness
-    for (auto& [bid, bndry] : ref_boundaries_)
-      bndry->UpdateAnglesReadyStatus(angles_, ref_group_subset_);
-
-    executed_ = true;
     return AngleSetStatus::FINISHED;
   }
   else
     return AngleSetStatus::READY_TO_EXECUTE;
 }
 
+// ###################################################################
+/**Allocates the local and downstream buffers needed by the sweep chunk.
+ * Must be called from the thread doing the communication.*/
+void AAH_AngleSet::InitializeExecution()
+{
+  async_comm_.InitializeLocalAndDownstreamBuffers();
+}
+
+// ###################################################################
+/**Executes the sweep chunk on this angle set. This method does not
+ * communicate and can therefore be called from a worker thread, provided
+ * no other thread is executing an angle set of the same group subset
+ * with the same destination vectors.*/
+void AAH_AngleSet::ExecuteSweepChunk(SweepChunk& sweep_chunk)
+{
+  sweep_chunk.Sweep(*this);
+}
+
+// ###################################################################
+/**Sends outgoing psi, clears the local and receive buffers and updates
+ * the boundary readiness. Must be called from the thread doing the
+ * communication.*/
+void AAH_AngleSet::FinalizeExecution()
+{
+  async_comm_.SendDownstreamPsi(static_cast<int>(this->GetID()));
+  async_comm_.ClearLocalAndReceiveBuffers();
+
+  for (auto& [bid, bndry] : ref_boundaries_)
+    bndry->UpdateAnglesReadyStatus(angles_, ref_group_subset_);
+
+  executed_ = true;
+}
+
 // ###################################################################
 /***/
 AngleSetStatus AAH_AngleSet::FlushSendBuffers()
@@ -134,14 +160,14 @@ bool AAH_AngleSet::ReceiveDelayedData()
 
 // ###################################################################
 /**Returns a pointer to a boundary flux data.*/
-const double* AAH_AngleSet::PsiBndry(uint64_t bndry_map,
-                                     unsigned int angle_num,
-                                     uint64_t cell_local_id,
-                                     unsigned int face_num,
-                                     unsigned int fi,
-                                     int g,
-                                     size_t gs_ss_begin,
-                                     bool surface_source_active)
+const PsiFloat* AAH_AngleSet::PsiBndry(uint64_t bndry_map,
+                                       unsigned int angle_num,
+                                       uint64_t cell_local_id,
+                                       unsigned int face_num,
+                                       unsigned int fi,
+                                       int g,
+                                       size_t gs_ss_begin,
+                                       bool surface_source_active)
 {
   if (ref_boundaries_[bndry_map]->IsReflecting())
     return ref_boundaries_[bndry_map]->HeterogeneousPsiIncoming(
@@ -155,12 +181,12 @@ const double* AAH_AngleSet::PsiBndry(uint64_t bndry_map,
 
 // ###################################################################
 /**Returns a pointer to outbound boundary flux data.*/
-double* AAH_AngleSet::ReflectingPsiOutBoundBndry(uint64_t bndry_map,
-                                                 unsigned int angle_num,
-                                                 uint64_t cell_local_id,
-                                                 unsigned int face_num,
-                                                 unsigned int fi,
-                                                 size_t gs_ss_begin)
+PsiFloat* AAH_AngleSet::ReflectingPsiOutBoundBndry(uint64_t bndry_map,
+                                                   unsigned int angle_num,
+                                                   uint64_t cell_local_id,
+                                                   unsigned int face_num,
+                                                   unsigned int fi,
+                                                   size_t gs_ss_begin)
 {
   return ref_boundaries_[bndry_map]->HeterogeneousPsiOutgoing(
     cell_local_id, face_num, fi, angle_num, gs_ss_begin);
@@ -32,23 +32,31 @@ public:
     const std::vector<size_t>& timing_tags,
     ExecutionPermission permission) override;
   AngleSetStatus FlushSendBuffers() override;
+
+  // The following three methods split the execution stage of
+  // AngleSetAdvance so that the sweep chunk can be executed on a thread
+  // other than the one doing the communication.
+  void InitializeExecution();
+  void ExecuteSweepChunk(SweepChunk& sweep_chunk);
+  void FinalizeExecution();
+
   void ResetSweepBuffers() override;
   bool ReceiveDelayedData() override;
 
-  const double* PsiBndry(uint64_t bndry_map,
-                         unsigned int angle_num,
-                         uint64_t cell_local_id,
-                         unsigned int face_num,
-                         unsigned int fi,
-                         int g,
-                         size_t gs_ss_begin,
-                         bool surface_source_active) override;
-  double* ReflectingPsiOutBoundBndry(uint64_t bndry_map,
-                                     unsigned int angle_num,
-                                     uint64_t cell_local_id,
-                                     unsigned int face_num,
-                                     unsigned int fi,
-                                     size_t gs_ss_begin) override;
+  const PsiFloat* PsiBndry(uint64_t bndry_map,
+                           unsigned int angle_num,
+                           uint64_t cell_local_id,
+                           unsigned int face_num,
+                           unsigned int fi,
+                           int g,
+                           size_t gs_ss_begin,
+                           bool surface_source_active) override;
+  PsiFloat* ReflectingPsiOutBoundBndry(uint64_t bndry_map,
+                                       unsigned int angle_num,
+                                       uint64_t cell_local_id,
+                                       unsigned int face_num,
+                                       unsigned int fi,
+                                       size_t gs_ss_begin) override;
 
 protected:
   chi_mesh::sweep_management::AAH_ASynchronousCommunicator async_comm_;
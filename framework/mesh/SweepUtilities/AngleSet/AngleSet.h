@@ -12,6 +12,11 @@ typedef chi_mesh::sweep_management::SweepBoundary SweepBndry;
 
 #include <memory>
 
+namespace chi
+{
+class ThreadPool;
+}
+
 namespace chi_mesh::sweep_management
 {
 
@@ -50,24 +55,36 @@ public:
     SweepChunk& sweep_chunk,
     const std::vector<size_t>& timing_tags,
     ExecutionPermission permission) = 0;
+  /**Advances the angle set with its local cell tasks executed by several
+   * threads, each thread using its own sweep chunk. Communication remains
+   * on the calling thread. Angle sets that do not support this advance
+   * serially with the first sweep chunk.*/
+  virtual AngleSetStatus
+  AngleSetAdvanceThreaded(const std::vector<SweepChunk*>& sweep_chunks,
+                          chi::ThreadPool& thread_pool,
+                          const std::vector<size_t>& timing_tags)
+  {
+    return AngleSetAdvance(
+      *sweep_chunks.front(), timing_tags, ExecutionPermission::EXECUTE);
+  }
   virtual AngleSetStatus FlushSendBuffers() = 0;
   virtual void ResetSweepBuffers() = 0;
   virtual bool ReceiveDelayedData() = 0;
 
-  virtual const double* PsiBndry(uint64_t bndry_map,
-                                 unsigned int angle_num,
-                                 uint64_t cell_local_id,
-                                 unsigned int face_num,
-                                 unsigned int fi,
-                                 int g,
-                                 size_t gs_ss_begin,
-                                 bool surface_source_active) = 0;
-  virtual double* ReflectingPsiOutBoundBndry(uint64_t bndry_map,
-                                             unsigned int angle_num,
-                                             uint64_t cell_local_id,
-                                             unsigned int face_num,
-                                             unsigned int fi,
-                                             size_t gs_ss_begin) = 0;
+  virtual const PsiFloat* PsiBndry(uint64_t bndry_map,
+                                   unsigned int angle_num,
+                                   uint64_t cell_local_id,
+                                   unsigned int face_num,
+                                   unsigned int fi,
+                                   int g,
+                                   size_t gs_ss_begin,
+                                   bool surface_source_active) = 0;
+  virtual PsiFloat* ReflectingPsiOutBoundBndry(uint64_t bndry_map,
+                                               unsigned int angle_num,
+                                               uint64_t cell_local_id,
+                                               unsigned int face_num,
+                                               unsigned int fi,
+                                               size_t gs_ss_begin) = 0;
 
   virtual ~AngleSet() = default;
 
@@ -18,6 +18,12 @@ namespace chi_mesh::sweep_management
 
 class FLUDS;
 
+/**MPI datatype of the angular fluxes exchanged between locations.*/
+inline MPI_Datatype PsiFloatMPIType()
+{
+  return sizeof(PsiFloat) == sizeof(float) ? MPI_FLOAT : MPI_DOUBLE;
+}
+
 // ###################################################################
 /**Handles the swift communication of interprocess communication
  * related to sweeping.*/
@@ -33,14 +33,15 @@ void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::BuildMessageStruc
 
     u_ll_int message_size;
     int      message_count;
-    if ((num_unknowns*8)<=EAGER_LIMIT)
+    if ((num_unknowns*sizeof(PsiFloat))<=EAGER_LIMIT)
     {
       message_count = static_cast<int>(num_angles_);
       message_size  = ceil((double)num_unknowns/(double)message_count);
     }
     else
     {
-      message_count = ceil((double)num_unknowns*8/(double)(double)EAGER_LIMIT);
+      message_count = ceil((double)(num_unknowns*sizeof(PsiFloat))/
+                           (double)EAGER_LIMIT);
       message_size  = ceil((double)num_unknowns/(double)message_count);
     }
 
@@ -78,14 +79,15 @@ void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::BuildMessageStruc
 
     u_ll_int message_size;
     int      message_count;
-    if ((num_unknowns*8)<=EAGER_LIMIT)
+    if ((num_unknowns*sizeof(PsiFloat))<=EAGER_LIMIT)
     {
       message_count = static_cast<int>(num_angles_);
       message_size  = ceil((double)num_unknowns/(double)message_count);
     }
     else
     {
-      message_count = ceil((double)num_unknowns*8/(double)(double)EAGER_LIMIT);
+      message_count = ceil((double)(num_unknowns*sizeof(PsiFloat))/
+                           (double)EAGER_LIMIT);
       message_size  = ceil((double)num_unknowns/(double)message_count);
     }
 
@@ -125,14 +127,15 @@ void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::BuildMessageStruc
 
     u_ll_int message_size;
     int      message_count;
-    if ((num_unknowns*8)<=EAGER_LIMIT)
+    if ((num_unknowns*sizeof(PsiFloat))<=EAGER_LIMIT)
     {
       message_count = static_cast<int>(num_angles_);
       message_size  = ceil((double)num_unknowns/(double)message_count);
     }
     else
     {
-      message_count = ceil((double)num_unknowns*8/(double)(double)EAGER_LIMIT);
+      message_count = ceil((double)(num_unknowns*sizeof(PsiFloat))/
+                           (double)EAGER_LIMIT);
       message_size  = ceil((double)num_unknowns/(double)message_count);
     }
 
@@ -54,7 +54,7 @@ bool chi_mesh::sweep_management::AAH_ASynchronousCommunicator::ReceiveDelayedDat
         int error_code =
           MPI_Recv(&upstream_psi[block_addr],
                    static_cast<int>(message_size),
-                   MPI_DOUBLE,
+                   PsiFloatMPIType(),
                    comm_set_.MapIonJ(locJ, Chi::mpi.location_id),
                    max_num_mess * angle_set_num + m, // tag
                    comm_set_.LocICommunicator(Chi::mpi.location_id),
@@ -60,7 +60,7 @@ chi_mesh::sweep_management::AAH_ASynchronousCommunicator::ReceiveUpstreamPsi(int
         int error_code =
           MPI_Recv(&upstream_psi[block_addr],
                    static_cast<int>(message_size),
-                   MPI_DOUBLE,
+                   PsiFloatMPIType(),
                    comm_set_.MapIonJ(locJ, Chi::mpi.location_id),
                    max_num_mess * angle_set_num + m, // tag
                    comm_set_.LocICommunicator(Chi::mpi.location_id),
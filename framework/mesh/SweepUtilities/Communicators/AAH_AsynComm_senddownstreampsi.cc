@@ -30,7 +30,7 @@ SendDownstreamPsi(int angle_set_num)
 
       MPI_Isend(&outgoing_psi[block_addr],
                 static_cast<int>(message_size),
-                MPI_DOUBLE,
+                PsiFloatMPIType(),
                 comm_set_.MapIonJ(locJ,locJ),
                 max_num_mess*angle_set_num + m, //tag
                 comm_set_.LocICommunicator(locJ),
@@ -11,7 +11,7 @@ AsynchronousCommunicator::AsynchronousCommunicator(
 {
 }
 
-std::vector<double>&
+std::vector<PsiFloat>&
 AsynchronousCommunicator::InitGetDownwindMessageData(int location_id,
                                                  uint64_t cell_global_id,
                                                  unsigned int face_id,
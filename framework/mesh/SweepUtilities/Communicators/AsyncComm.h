@@ -1,6 +1,8 @@
 #ifndef CHITECH_ASYNCCOMM_H
 #define CHITECH_ASYNCCOMM_H
 
+#include "mesh/SweepUtilities/sweep_namespace.h"
+
 #include <cstddef>
 #include <cstdint>
 #include <vector>
@@ -24,7 +26,7 @@ public:
 
   /**Obtains a data vector holding a spot into which outgoing data can be
    * written.*/
-  virtual std::vector<double>&
+  virtual std::vector<PsiFloat>&
   InitGetDownwindMessageData(int location_id,
                                                       uint64_t cell_global_id,
                                                       unsigned int face_id,
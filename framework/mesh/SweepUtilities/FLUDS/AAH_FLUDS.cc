@@ -31,10 +31,10 @@ AAH_FLUDS::AAH_FLUDS(size_t num_groups,
  * the outgoing face dof, this function computes the location
  * of this position's upwind psi in the local upwind psi vector
  * and returns a reference to it.*/
-double* AAH_FLUDS::OutgoingPsi(int cell_so_index,
-                               int outb_face_counter,
-                               int face_dof,
-                               int n)
+PsiFloat* AAH_FLUDS::OutgoingPsi(int cell_so_index,
+                                 int outb_face_counter,
+                                 int face_dof,
+                                 int n)
 {
   // Face category
   int fc = common_data_
@@ -67,7 +67,7 @@ double* AAH_FLUDS::OutgoingPsi(int cell_so_index,
 // ###################################################################
 /**Given a outbound face counter this method returns a pointer
  * to the location*/
-double* AAH_FLUDS::NLOutgoingPsi(int outb_face_counter, int face_dof, int n)
+PsiFloat* AAH_FLUDS::NLOutgoingPsi(int outb_face_counter, int face_dof, int n)
 {
   if (outb_face_counter > common_data_.nonlocal_outb_face_deplocI_slot.size())
   {
@@ -104,7 +104,7 @@ double* AAH_FLUDS::NLOutgoingPsi(int outb_face_counter, int face_dof, int n)
  * the incoming face dof, this function computes the location
  * where to store this position's outgoing psi and returns a reference
  * to it.*/
-double* AAH_FLUDS::UpwindPsi(
+PsiFloat* AAH_FLUDS::UpwindPsi(
   int cell_so_index, int inc_face_counter, int face_dof, int g, int n)
 {
   // Face category
@@ -149,7 +149,7 @@ double* AAH_FLUDS::UpwindPsi(
 /**Given a sweep ordering index, the incoming face counter,
  * the incoming face dof, this function computes the location
  * where to obtain the position's upwind psi.*/
-double*
+PsiFloat*
 AAH_FLUDS::NLUpwindPsi(int nonl_inc_face_counter, int face_dof, int g, int n)
 {
   int prelocI =
@@ -214,10 +214,10 @@ size_t AAH_FLUDS::GetDeplocIFaceDOFCount(int deplocI) const
 
 void AAH_FLUDS::ClearLocalAndReceivePsi()
 {
-  auto empty_vector = std::vector<std::vector<double>>(0);
+  auto empty_vector = std::vector<std::vector<PsiFloat>>(0);
   local_psi_.swap(empty_vector);
 
-  empty_vector = std::vector<std::vector<double>>(0);
+  empty_vector = std::vector<std::vector<PsiFloat>>(0);
   prelocI_outgoing_psi_.swap(empty_vector);
 }
 
@@ -240,7 +240,7 @@ void AAH_FLUDS::AllocateOutgoingPsi(size_t num_grps,
                                     size_t num_angles,
                                     size_t num_loc_sucs)
 {
-  deplocI_outgoing_psi_.resize(num_loc_sucs, std::vector<double>());
+  deplocI_outgoing_psi_.resize(num_loc_sucs, std::vector<PsiFloat>());
   for (size_t deplocI = 0; deplocI < num_loc_sucs; deplocI++)
   {
     deplocI_outgoing_psi_[deplocI].resize(
@@ -266,7 +266,7 @@ void AAH_FLUDS::AllocatePrelocIOutgoingPsi(size_t num_grps,
                                            size_t num_angles,
                                            size_t num_loc_deps)
 {
-  prelocI_outgoing_psi_.resize(num_loc_deps, std::vector<double>());
+  prelocI_outgoing_psi_.resize(num_loc_deps, std::vector<PsiFloat>());
   for (size_t prelocI = 0; prelocI < num_loc_deps; prelocI++)
   {
     prelocI_outgoing_psi_[prelocI].resize(
@@ -296,28 +296,31 @@ void AAH_FLUDS::AllocateDelayedPrelocIOutgoingPsi(size_t num_grps,
   }
 }
 
-std::vector<double>& AAH_FLUDS::DelayedLocalPsi() { return delayed_local_psi_; }
+std::vector<PsiFloat>& AAH_FLUDS::DelayedLocalPsi()
+{
+  return delayed_local_psi_;
+}
 
-std::vector<double>& AAH_FLUDS::DelayedLocalPsiOld()
+std::vector<PsiFloat>& AAH_FLUDS::DelayedLocalPsiOld()
 {
   return delayed_local_psi_old_;
 }
 
-std::vector<std::vector<double>>& AAH_FLUDS::DeplocIOutgoingPsi()
+std::vector<std::vector<PsiFloat>>& AAH_FLUDS::DeplocIOutgoingPsi()
 {
   return deplocI_outgoing_psi_;
 }
 
-std::vector<std::vector<double>>& AAH_FLUDS::PrelocIOutgoingPsi()
+std::vector<std::vector<PsiFloat>>& AAH_FLUDS::PrelocIOutgoingPsi()
 {
   return prelocI_outgoing_psi_;
 }
 
-std::vector<std::vector<double>>& AAH_FLUDS::DelayedPrelocIOutgoingPsi()
+std::vector<std::vector<PsiFloat>>& AAH_FLUDS::DelayedPrelocIOutgoingPsi()
 {
   return delayed_prelocI_outgoing_psi_;
 }
-std::vector<std::vector<double>>& AAH_FLUDS::DelayedPrelocIOutgoingPsiOld()
+std::vector<std::vector<PsiFloat>>& AAH_FLUDS::DelayedPrelocIOutgoingPsiOld()
 {
   return delayed_prelocI_outgoing_psi_old_;
 }
@@ -26,30 +26,30 @@ private:
 
   size_t delayed_local_psi_Gn_block_strideG; // Custom G
 
-  std::vector<std::vector<double>> local_psi_;
-  std::vector<double> delayed_local_psi_;
-  std::vector<double> delayed_local_psi_old_;
-  std::vector<std::vector<double>> deplocI_outgoing_psi_;
-  std::vector<std::vector<double>> prelocI_outgoing_psi_;
-  std::vector<std::vector<double>> boundryI_incoming_psi_;
+  std::vector<std::vector<PsiFloat>> local_psi_;
+  std::vector<PsiFloat> delayed_local_psi_;
+  std::vector<PsiFloat> delayed_local_psi_old_;
+  std::vector<std::vector<PsiFloat>> deplocI_outgoing_psi_;
+  std::vector<std::vector<PsiFloat>> prelocI_outgoing_psi_;
+  std::vector<std::vector<PsiFloat>> boundryI_incoming_psi_;
 
-  std::vector<std::vector<double>> delayed_prelocI_outgoing_psi_;
-  std::vector<std::vector<double>> delayed_prelocI_outgoing_psi_old_;
+  std::vector<std::vector<PsiFloat>> delayed_prelocI_outgoing_psi_;
+  std::vector<std::vector<PsiFloat>> delayed_prelocI_outgoing_psi_old_;
 
 public:
-  double* OutgoingPsi(int cell_so_index,
-                      int outb_face_counter,
+  PsiFloat* OutgoingPsi(int cell_so_index,
+                        int outb_face_counter,
+                        int face_dof,
+                        int n);
+  PsiFloat* UpwindPsi(int cell_so_index,
+                      int inc_face_counter,
                       int face_dof,
+                      int g,
                       int n);
-  double* UpwindPsi(int cell_so_index,
-                    int inc_face_counter,
-                    int face_dof,
-                    int g,
-                    int n);
 
-  double* NLOutgoingPsi(int outb_face_count, int face_dof, int n);
+  PsiFloat* NLOutgoingPsi(int outb_face_count, int face_dof, int n);
 
-  double*
+  PsiFloat*
   NLUpwindPsi(int nonl_inc_face_counter, int face_dof, int g, int n);
 
   size_t GetPrelocIFaceDOFCount(int prelocI) const;
@@ -71,15 +71,15 @@ public:
                                          size_t num_angles,
                                          size_t num_loc_deps) override;
 
-  std::vector<double>& DelayedLocalPsi() override;
-  std::vector<double>& DelayedLocalPsiOld() override;
+  std::vector<PsiFloat>& DelayedLocalPsi() override;
+  std::vector<PsiFloat>& DelayedLocalPsiOld() override;
 
-  std::vector<std::vector<double>>& DeplocIOutgoingPsi() override;
+  std::vector<std::vector<PsiFloat>>& DeplocIOutgoingPsi() override;
 
-  std::vector<std::vector<double>>& PrelocIOutgoingPsi() override;
+  std::vector<std::vector<PsiFloat>>& PrelocIOutgoingPsi() override;
 
-  std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsi() override;
-  std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsiOld() override;
+  std::vector<std::vector<PsiFloat>>& DelayedPrelocIOutgoingPsi() override;
+  std::vector<std::vector<PsiFloat>>& DelayedPrelocIOutgoingPsiOld() override;
 };
 
 } // namespace chi_mesh::sweep_management
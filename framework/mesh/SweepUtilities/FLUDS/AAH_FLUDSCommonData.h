@@ -46,6 +46,14 @@ public:
     const std::vector<CellFaceNodalMapping>& grid_nodal_mappings,
     const SPDS& spds,
     const chi_mesh::GridFaceHistogram& grid_face_histogram);
+  /**Restores the common data written with Serialize. No communication is
+   * performed.*/
+  AAH_FLUDSCommonData(
+    const std::vector<CellFaceNodalMapping>& grid_nodal_mappings,
+    const SPDS& spds,
+    chi_data_types::ByteArray& raw);
+
+  void Serialize(chi_data_types::ByteArray& raw) const override;
 
 protected:
   friend class AAH_FLUDS;
@@ -163,6 +171,8 @@ private:
                            int& num_face_dofs);
   // 01b
   void NonLocalIncidentMapping(const chi_mesh::Cell& cell, const SPDS& spds);
+  // 02
+  void DeSerialize(chi_data_types::ByteArray& raw);
 };
 
 } // namespace chi_mesh::sweep_management
@@ -77,7 +77,8 @@ void AAH_FLUDSCommonData::SlotDynamics(
 
         //======================================== Find associated face for
         //                                         dof mapping and lock box
-        auto ass_face = (short)face.GetNeighborAssociatedFace(grid);
+        auto ass_face =
+          (short)grid.GetFaceAdjacency().AssociatedFace(cell.local_id_, f);
 
         //Now find the cell (index,face) pair in the lock box and empty slot
         bool found = false;
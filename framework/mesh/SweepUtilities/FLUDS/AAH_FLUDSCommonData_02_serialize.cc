@@ -0,0 +1,192 @@
+#include "AAH_FLUDSCommonData.h"
+
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+#include "mesh/SweepUtilities/SPDS/SPDS.h"
+
+#include "data_types/byte_array.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+namespace chi_mesh::sweep_management
+{
+
+typedef std::pair<int, std::pair<int, std::vector<int>>> PrelocISlotDof;
+
+//###################################################################
+/**Restores the common data written with Serialize.*/
+AAH_FLUDSCommonData::AAH_FLUDSCommonData(
+  const std::vector<CellFaceNodalMapping>& grid_nodal_mappings,
+  const SPDS& spds,
+  chi_data_types::ByteArray& raw)
+  : FLUDSCommonData(spds, grid_nodal_mappings)
+{
+  this->DeSerialize(raw);
+}
+
+//###################################################################
+/**Writes the slot data of the alpha- and beta-passes to a byte array.
+ * The per-cell raw arrays are written with their lengths, which are
+ * recovered here from the face orientations in the same way the
+ * alpha-pass built them.*/
+void AAH_FLUDSCommonData::Serialize(chi_data_types::ByteArray& raw) const
+{
+  const auto& grid = spds_.Grid();
+  const auto& spls = spds_.GetSPLS();
+  const auto& face_orientations = spds_.CellFaceOrientations();
+
+  raw.Write<int>(largest_face);
+  raw.Write<size_t>(num_face_categories);
+  raw.WriteVector(local_psi_stride);
+  raw.WriteVector(local_psi_max_elements);
+  raw.Write<size_t>(delayed_local_psi_stride);
+  raw.Write<size_t>(delayed_local_psi_max_elements);
+
+  raw.WriteVector(local_psi_n_block_stride);
+  raw.WriteVector(local_psi_Gn_block_strideG);
+  raw.Write<size_t>(delayed_local_psi_Gn_block_stride);
+  raw.Write<size_t>(delayed_local_psi_Gn_block_strideG);
+
+  raw.WriteVector(boundary_dependencies);
+  raw.WriteVector(deplocI_face_dof_count);
+
+  //================================================== Per-cell data
+  raw.Write<size_t>(spls.item_id.size());
+  for (size_t csoi = 0; csoi < spls.item_id.size(); ++csoi)
+  {
+    const auto& cell = grid.local_cells[spls.item_id[csoi]];
+    const auto& orientations = face_orientations[cell.local_id_];
+
+    std::vector<size_t> local_inco_faces;
+    size_t num_outb_faces = 0;
+    for (size_t f = 0; f < cell.faces_.size(); ++f)
+    {
+      if (orientations[f] == FaceOrientation::OUTGOING) ++num_outb_faces;
+      else if (orientations[f] == FaceOrientation::INCOMING and
+               cell.faces_[f].IsNeighborLocal(grid))
+        local_inco_faces.push_back(f);
+    }
+
+    raw.Write<size_t>(num_outb_faces);
+    for (size_t i = 0; i < num_outb_faces; ++i)
+    {
+      raw.Write<int>(so_cell_outb_face_slot_indices[csoi][i]);
+      raw.Write<short>(so_cell_outb_face_face_category[csoi][i]);
+    }
+
+    raw.Write<size_t>(local_inco_faces.size());
+    for (size_t i = 0; i < local_inco_faces.size(); ++i)
+    {
+      const auto& inco_face_info = so_cell_inco_face_dof_indices[csoi][i];
+      const size_t num_face_nodes =
+        grid_nodal_mappings_[cell.local_id_][local_inco_faces[i]]
+          .face_node_mapping_.size();
+
+      raw.Write<short>(so_cell_inco_face_face_category[csoi][i]);
+      raw.Write<int>(inco_face_info.slot_address);
+      raw.Write<size_t>(num_face_nodes);
+      for (size_t fi = 0; fi < num_face_nodes; ++fi)
+        raw.Write<short>(inco_face_info.upwind_dof_mapping[fi]);
+    }
+  } // for csoi
+
+  raw.WriteVector(nonlocal_outb_face_deplocI_slot);
+
+  //================================================== Beta-pass data
+  raw.WriteVector(prelocI_face_dof_count);
+  raw.WriteVector(delayed_prelocI_face_dof_count);
+
+  for (const auto* slot_dofs : {&nonlocal_inc_face_prelocI_slot_dof,
+                                &delayed_nonlocal_inc_face_prelocI_slot_dof})
+  {
+    raw.Write<size_t>(slot_dofs->size());
+    for (const auto& [prelocI, slot_dof] : *slot_dofs)
+    {
+      raw.Write<int>(prelocI);
+      raw.Write<int>(slot_dof.first);
+      raw.WriteVector(slot_dof.second);
+    }
+  }
+}
+
+//###################################################################
+/**Reads the data written by Serialize.*/
+void AAH_FLUDSCommonData::DeSerialize(chi_data_types::ByteArray& raw)
+{
+  largest_face = raw.Read<int>();
+  num_face_categories = raw.Read<size_t>();
+  local_psi_stride = raw.ReadVector<size_t>();
+  local_psi_max_elements = raw.ReadVector<size_t>();
+  delayed_local_psi_stride = raw.Read<size_t>();
+  delayed_local_psi_max_elements = raw.Read<size_t>();
+
+  local_psi_n_block_stride = raw.ReadVector<size_t>();
+  local_psi_Gn_block_strideG = raw.ReadVector<size_t>();
+  delayed_local_psi_Gn_block_stride = raw.Read<size_t>();
+  delayed_local_psi_Gn_block_strideG = raw.Read<size_t>();
+
+  boundary_dependencies = raw.ReadVector<int>();
+  deplocI_face_dof_count = raw.ReadVector<int>();
+
+  //================================================== Per-cell data
+  const size_t num_cells = raw.Read<size_t>();
+  ChiLogicalErrorIf(num_cells != spds_.GetSPLS().item_id.size(),
+                    "Serialized FLUDS data does not match the SPDS.");
+
+  so_cell_outb_face_slot_indices.reserve(num_cells);
+  so_cell_outb_face_face_category.reserve(num_cells);
+  so_cell_inco_face_face_category.reserve(num_cells);
+  so_cell_inco_face_dof_indices.reserve(num_cells);
+  for (size_t csoi = 0; csoi < num_cells; ++csoi)
+  {
+    const size_t num_outb_faces = raw.Read<size_t>();
+    auto outb_face_slot_indices = new int[num_outb_faces];
+    auto outb_face_face_category = new short[num_outb_faces];
+    for (size_t i = 0; i < num_outb_faces; ++i)
+    {
+      outb_face_slot_indices[i] = raw.Read<int>();
+      outb_face_face_category[i] = raw.Read<short>();
+    }
+    so_cell_outb_face_slot_indices.push_back(outb_face_slot_indices);
+    so_cell_outb_face_face_category.push_back(outb_face_face_category);
+
+    const size_t num_inco_faces = raw.Read<size_t>();
+    auto inco_face_face_category = new short[num_inco_faces];
+    auto inco_face_info_array = new INCOMING_FACE_INFO[num_inco_faces];
+    for (size_t i = 0; i < num_inco_faces; ++i)
+    {
+      inco_face_face_category[i] = raw.Read<short>();
+
+      std::pair<int, std::vector<short>> dof_mapping;
+      dof_mapping.first = raw.Read<int>();
+      dof_mapping.second = raw.ReadVector<short>();
+      inco_face_info_array[i].Setup(dof_mapping);
+    }
+    so_cell_inco_face_face_category.push_back(inco_face_face_category);
+    so_cell_inco_face_dof_indices.push_back(inco_face_info_array);
+  } // for csoi
+
+  nonlocal_outb_face_deplocI_slot = raw.ReadVector<std::pair<int, int>>();
+
+  //================================================== Beta-pass data
+  prelocI_face_dof_count = raw.ReadVector<int>();
+  delayed_prelocI_face_dof_count = raw.ReadVector<int>();
+
+  for (auto* slot_dofs : {&nonlocal_inc_face_prelocI_slot_dof,
+                          &delayed_nonlocal_inc_face_prelocI_slot_dof})
+  {
+    const size_t num_faces = raw.Read<size_t>();
+    slot_dofs->clear();
+    slot_dofs->reserve(num_faces);
+    for (size_t i = 0; i < num_faces; ++i)
+    {
+      PrelocISlotDof slot_dof;
+      slot_dof.first = raw.Read<int>();
+      slot_dof.second.first = raw.Read<int>();
+      slot_dof.second.second = raw.ReadVector<int>();
+      slot_dofs->push_back(std::move(slot_dof));
+    }
+  }
+}
+
+} // namespace chi_mesh::sweep_management
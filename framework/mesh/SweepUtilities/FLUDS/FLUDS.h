@@ -7,6 +7,7 @@
 #include <cstdint>
 
 #include "FLUDSCommonData.h"
+#include "mesh/SweepUtilities/sweep_namespace.h"
 
 namespace chi_mesh
 {
@@ -50,16 +51,17 @@ public:
   {
   }
 
-  virtual std::vector<double>& DelayedLocalPsi() = 0;
-  virtual std::vector<double>& DelayedLocalPsiOld() = 0;
+  virtual std::vector<PsiFloat>& DelayedLocalPsi() = 0;
+  virtual std::vector<PsiFloat>& DelayedLocalPsiOld() = 0;
 
-  virtual std::vector<std::vector<double>>& DeplocIOutgoingPsi() = 0;
+  virtual std::vector<std::vector<PsiFloat>>& DeplocIOutgoingPsi() = 0;
 
-  virtual std::vector<std::vector<double>>& PrelocIOutgoingPsi() = 0;
+  virtual std::vector<std::vector<PsiFloat>>& PrelocIOutgoingPsi() = 0;
 
-  virtual std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsi() = 0;
+  virtual std::vector<std::vector<PsiFloat>>& DelayedPrelocIOutgoingPsi() = 0;
 
-  virtual std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsiOld() = 0;
+  virtual std::vector<std::vector<PsiFloat>>&
+  DelayedPrelocIOutgoingPsiOld() = 0;
 
   virtual ~FLUDS() = default;
 
@@ -4,6 +4,11 @@
 #include <vector>
 #include <cstdint>
 
+namespace chi_data_types
+{
+class ByteArray;
+}
+
 namespace chi_mesh::sweep_management
 {
 class SPDS;
@@ -36,6 +41,10 @@ public:
 
   virtual ~FLUDSCommonData() = default;
 
+  /**Writes the data that is expensive to rebuild to a byte array. The
+   * default writes nothing.*/
+  virtual void Serialize(chi_data_types::ByteArray& raw) const {}
+
   const SPDS& GetSPDS() const;
   const FaceNodalMapping& GetFaceNodalMapping(uint64_t cell_local_id,
                                               unsigned int face_id) const;
@@ -60,6 +60,9 @@ void chi_mesh::sweep_management::SPDS::PopulateCellRelationships(
   constexpr auto FOINCOMING = FaceOrientation::INCOMING;
   constexpr auto FOOUTGOING = FaceOrientation::OUTGOING;
 
+  const auto& face_adjacency = grid_.GetFaceAdjacency();
+  const auto& face_view = grid_.GetFlatFaceView();
+
   cell_face_orientations_.assign(grid_.local_cells.size(), {});
   for (auto& cell : grid_.local_cells)
     cell_face_orientations_[cell.local_id_].assign(cell.faces_.size(),
@@ -67,16 +70,22 @@ void chi_mesh::sweep_management::SPDS::PopulateCellRelationships(
 
   for (auto& cell : grid_.local_cells)
   {
-    size_t f = 0;
-    for (auto& face : cell.faces_)
+    const size_t face0 = face_view.CellFaceOffset(cell.local_id_);
+    const size_t num_faces = face_view.NumFaces(cell.local_id_);
+    for (size_t f = 0; f < num_faces; ++f)
     {
+      const size_t fi = face0 + f;
+      const bool has_neighbor = face_view.HasNeighbor(fi);
+      const uint64_t neighbor_id = face_view.NeighborID(fi);
+      const int64_t neighbor_local_id = face_view.NeighborLocalID(fi);
+
       //======================================= Determine if the face
       //                                        is incident
       FaceOrientation orientation = FOPARALLEL;
-      const double mu = omega.Dot(face.normal_);
+      const double mu = omega.Dot(face_view.Normal(fi));
 
       bool owns_face = true;
-      if (face.has_neighbor_ and cell.global_id_ > face.neighbor_id_)
+      if (has_neighbor and cell.global_id_ > neighbor_id)
         owns_face = false;
 
       if (owns_face)
@@ -87,12 +96,12 @@ void chi_mesh::sweep_management::SPDS::PopulateCellRelationships(
 
         cell_face_orientations_[cell.local_id_][f] = orientation;
 
-        if (face.has_neighbor_ and grid_.IsCellLocal(face.neighbor_id_))
+        if (neighbor_local_id >= 0)
         {
-          const auto& adj_cell = grid_.cells[face.neighbor_id_];
-          const auto ass_face = face.GetNeighborAssociatedFace(grid_);
+          const auto ass_face =
+            face_adjacency.AssociatedFace(cell.local_id_, f);
           auto& adj_face_ori =
-            cell_face_orientations_[adj_cell.local_id_][ass_face];
+            cell_face_orientations_[neighbor_local_id][ass_face];
 
           switch (orientation)
           {
@@ -103,10 +112,10 @@ void chi_mesh::sweep_management::SPDS::PopulateCellRelationships(
         }
         // clang-format on
       } // if face owned
-      else if (face.has_neighbor_ and not grid_.IsCellLocal(face.neighbor_id_))
+      else if (has_neighbor and neighbor_local_id < 0)
       {
-        const auto& adj_cell = grid_.cells[face.neighbor_id_];
-        const auto ass_face = face.GetNeighborAssociatedFace(grid_);
+        const auto& adj_cell = grid_.cells[neighbor_id];
+        const auto ass_face = face_adjacency.AssociatedFace(cell.local_id_, f);
         const auto& adj_face = adj_cell.faces_[ass_face];
 
         auto& cur_face_ori = cell_face_orientations_[cell.local_id_][f];
@@ -129,8 +138,6 @@ void chi_mesh::sweep_management::SPDS::PopulateCellRelationships(
             break;
         }
       } // if not face owned locally at all
-
-      ++f;
     } // for face
   }
 
@@ -138,26 +145,30 @@ void chi_mesh::sweep_management::SPDS::PopulateCellRelationships(
   for (auto& cell : grid_.local_cells)
   {
     const uint64_t c = cell.local_id_;
-    size_t f = 0;
-    for (auto& face : cell.faces_)
+    const size_t face0 = face_view.CellFaceOffset(c);
+    const size_t num_faces = face_view.NumFaces(c);
+    for (size_t f = 0; f < num_faces; ++f)
     {
-      const double mu = omega.Dot(face.normal_);
+      const size_t fi = face0 + f;
+      const int64_t neighbor_local_id = face_view.NeighborLocalID(fi);
       //======================================= If outgoing determine if
       //                                        it is to a local cell
-      if (cell_face_orientations_[cell.local_id_][f] == FOOUTGOING)
+      if (cell_face_orientations_[c][f] == FOOUTGOING)
       {
         //================================ If it is a cell and not bndry
-        if (face.has_neighbor_)
+        if (face_view.HasNeighbor(fi))
         {
           //========================= If it is in the current location
-          if (face.IsNeighborLocal(grid_))
+          if (neighbor_local_id >= 0)
           {
-            double weight = mu * face.ComputeFaceArea(grid_);
+            const double mu = omega.Dot(face_view.Normal(fi));
+            double weight = mu * cell.faces_[f].ComputeFaceArea(grid_);
             cell_successors[c].insert(
-              std::make_pair(face.GetNeighborLocalID(grid_), weight));
+              std::make_pair(static_cast<int>(neighbor_local_id), weight));
           }
           else
-            location_successors.insert(face.GetNeighborPartitionID(grid_));
+            location_successors.insert(
+              cell.faces_[f].GetNeighborPartitionID(grid_));
         }
       }
       //======================================= If not outgoing determine
@@ -165,10 +176,10 @@ void chi_mesh::sweep_management::SPDS::PopulateCellRelationships(
       else
       {
         //================================if it is a cell and not bndry
-        if (face.has_neighbor_ and not face.IsNeighborLocal(grid_))
-          location_dependencies.insert(face.GetNeighborPartitionID(grid_));
+        if (face_view.HasNeighbor(fi) and neighbor_local_id < 0)
+          location_dependencies.insert(
+            cell.faces_[f].GetNeighborPartitionID(grid_));
       }
-      ++f;
     } // for face
   }   // for cell
 }
@@ -245,4 +256,48 @@ void chi_mesh::sweep_management::SPDS::PrintedGhostedGraph() const
     } // if current location
     Chi::mpi.Barrier();
   } // for p
-}
\ No newline at end of file
+}
+// ###################################################################
+/**Writes the sweep ordering to a byte array.*/
+void chi_mesh::sweep_management::SPDS::Serialize(
+  chi_data_types::ByteArray& raw) const
+{
+  raw.Write<chi_mesh::Vector3>(omega_);
+  raw.WriteVector(spls_.item_id);
+
+  raw.WriteVector(location_dependencies_);
+  raw.WriteVector(location_successors_);
+  raw.WriteVector(delayed_location_dependencies_);
+  raw.WriteVector(delayed_location_successors_);
+  raw.WriteVector(local_cyclic_dependencies_);
+
+  raw.Write<size_t>(cell_face_orientations_.size());
+  for (const auto& face_orientations : cell_face_orientations_)
+    raw.WriteVector(face_orientations);
+}
+
+// ###################################################################
+/**Reads the data written by SPDS::Serialize.*/
+void chi_mesh::sweep_management::SPDS::DeSerialize(
+  chi_data_types::ByteArray& raw)
+{
+  const auto omega = raw.Read<chi_mesh::Vector3>();
+  ChiLogicalErrorIf((omega - omega_).Norm() > 1.0e-12,
+                    "Serialized sweep ordering is for a different direction.");
+
+  spls_.item_id = raw.ReadVector<int>();
+
+  location_dependencies_ = raw.ReadVector<int>();
+  location_successors_ = raw.ReadVector<int>();
+  delayed_location_dependencies_ = raw.ReadVector<int>();
+  delayed_location_successors_ = raw.ReadVector<int>();
+  local_cyclic_dependencies_ = raw.ReadVector<std::pair<int, int>>();
+
+  const size_t num_cells = raw.Read<size_t>();
+  ChiLogicalErrorIf(num_cells != grid_.local_cells.size(),
+                    "Serialized sweep ordering is for a different grid.");
+  cell_face_orientations_.clear();
+  cell_face_orientations_.reserve(num_cells);
+  for (size_t c = 0; c < num_cells; ++c)
+    cell_face_orientations_.push_back(raw.ReadVector<FaceOrientation>());
+}
@@ -4,6 +4,8 @@
 #include "mesh/SweepUtilities/SPLS/SPLS.h"
 #include "mesh/chi_mesh.h"
 
+#include "data_types/byte_array.h"
+
 #include <memory>
 
 namespace chi_mesh::sweep_management
@@ -51,6 +53,10 @@ public:
   int MapLocJToPrelocI(int locJ) const;
   int MapLocJToDeplocI(int locJ) const;
 
+  /**Writes the sweep ordering to a byte array. The derived classes can
+   * be restored from it without any communication.*/
+  virtual void Serialize(chi_data_types::ByteArray& raw) const;
+
   virtual ~SPDS() = default;
 
 protected:
@@ -79,6 +85,8 @@ protected:
     std::vector<std::set<std::pair<int, double>>>& cell_successors);
 
 
+  /**Reads the data written by SPDS::Serialize.*/
+  void DeSerialize(chi_data_types::ByteArray& raw);
 
   void PrintedGhostedGraph() const;
 };
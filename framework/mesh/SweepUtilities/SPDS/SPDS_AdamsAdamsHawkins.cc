@@ -17,7 +17,8 @@ SPDS_AdamsAdamsHawkins::SPDS_AdamsAdamsHawkins(
   const chi_mesh::Vector3& omega,
   const chi_mesh::MeshContinuum& grid,
   bool cycle_allowance_flag,
-  bool verbose)
+  bool verbose,
+  bool defer_task_dependency_graph /*=false*/)
   : SPDS(omega, grid, verbose)
 {
   Chi::log.Log0Verbose1() << Chi::program_timer.GetTimeString()
@@ -94,24 +95,15 @@ SPDS_AdamsAdamsHawkins::SPDS_AdamsAdamsHawkins(
     Chi::Exit(EXIT_FAILURE);
   }
 
-  //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%% Create Task
-  //                                                        Dependency Graphs
-  // All locations will gather other locations' dependencies
-  // so that each location has the ability to build
-  // the global task graph.
-
-  Chi::log.Log0Verbose1() << Chi::program_timer.GetTimeString()
-                          << " Communicating sweep dependencies.";
-
-  // auto& global_dependencies = sweep_order->global_dependencies;
-  std::vector<std::vector<int>> global_dependencies;
-  global_dependencies.resize(Chi::mpi.process_count);
-
-  CommunicateLocationDependencies(location_dependencies_, global_dependencies);
-
   //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%% Build task
   //                                                        dependency graph
-  BuildTaskDependencyGraph(global_dependencies, cycle_allowance_flag);
+  // Location 0 gathers the location dependencies and builds the graph
+  // unless it is deferred to a call of BuildTaskDependencyGraphs with
+  // multiple sweep orderings.
+  cycle_allowance_flag_ = cycle_allowance_flag;
+  if (defer_task_dependency_graph) return;
+
+  BuildTaskDependencyGraphs({this});
 
   Chi::mpi.Barrier();
 
@@ -120,170 +112,181 @@ SPDS_AdamsAdamsHawkins::SPDS_AdamsAdamsHawkins(
 }
 
 // ###################################################################
-/**Builds the task dependency graph.*/
-void chi_mesh::sweep_management::SPDS_AdamsAdamsHawkins::
-  BuildTaskDependencyGraph(
-  const std::vector<std::vector<int>>& global_dependencies,
-  bool cycle_allowance_flag)
+SPDS_AdamsAdamsHawkins::SPDS_AdamsAdamsHawkins(
+  const chi_mesh::Vector3& omega,
+  const chi_mesh::MeshContinuum& grid,
+  chi_data_types::ByteArray& raw,
+  bool verbose)
+  : SPDS(omega, grid, verbose)
 {
+  DeSerialize(raw);
 
-  std::vector<std::pair<int, int>> edges_to_remove;
-  std::vector<int> raw_edges_to_remove;
-  chi::DirectedGraph TDG;
-
-  //============================================= Build graph on home location
-  if (Chi::mpi.location_id == 0)
-  {
-    Chi::log.Log0Verbose1() << Chi::program_timer.GetTimeString()
-                            << " Building Task Dependency Graphs.";
-
-    //====================================== Add vertices to the graph
-    for (int loc = 0; loc < Chi::mpi.process_count; loc++)
-      TDG.AddVertex();
-
-    //====================================== Add dependencies
-    for (int loc = 0; loc < Chi::mpi.process_count; loc++)
-      for (int dep = 0; dep < global_dependencies[loc].size(); dep++)
-        TDG.AddEdge(global_dependencies[loc][dep], loc);
+  const size_t num_sweep_planes = raw.Read<size_t>();
+  global_sweep_planes_.resize(num_sweep_planes);
+  for (auto& sweep_plane : global_sweep_planes_)
+    sweep_plane.item_id = raw.ReadVector<int>();
 
-    //====================================== Remove cyclic dependencies
-    if (cycle_allowance_flag)
-    {
-      Chi::log.Log0Verbose1() << Chi::program_timer.GetTimeString()
-                              << " Removing intra-cellset cycles.";
-      auto edges_to_remove_temp = TDG.RemoveCyclicDependencies();
-      for (const auto& [v0, v1] : edges_to_remove_temp)
-        edges_to_remove.emplace_back(v0, v1);
-    }
+  if (verbose_) PrintedGhostedGraph();
+}
 
-    //====================================== Serialize edges to be removed
-    raw_edges_to_remove.resize(edges_to_remove.size() * 2, 0);
-    int i = 0;
-    for (const auto& edge : edges_to_remove)
-    {
-      raw_edges_to_remove[i++] = edge.first;
-      raw_edges_to_remove[i++] = edge.second;
-    }
-  } // if home
+// ###################################################################
+/**Writes the sweep ordering, including the global sweep planes, to a
+ * byte array.*/
+void SPDS_AdamsAdamsHawkins::Serialize(chi_data_types::ByteArray& raw) const
+{
+  SPDS::Serialize(raw);
 
-  //============================================= Broadcast edge buffer size
-  int edge_buffer_size = 0;
+  raw.Write<size_t>(global_sweep_planes_.size());
+  for (const auto& sweep_plane : global_sweep_planes_)
+    raw.WriteVector(sweep_plane.item_id);
+}
 
-  if (Chi::mpi.location_id == 0)
-    edge_buffer_size = static_cast<int>(raw_edges_to_remove.size());
+// ###################################################################
+/**Builds the task dependency graphs of multiple sweep orderings that
+ * were constructed with a deferred task dependency graph. The location
+ * dependencies of the i-th sweep ordering are gathered on location
+ * `i % process_count`, which performs the serial step: building the graph,
+ * removing its cycles, sorting it and ranking the locations. The sweep
+ * orderings are processed in batches of `process_count`, so the serial
+ * steps of a batch run concurrently on different locations while each
+ * location holds the gathered dependencies of at most one sweep ordering
+ * at a time. The resulting sweep orders are identical to those built on
+ * location 0.
+ *
+ * This is a collective call and every location must pass the sweep
+ * orderings in the same order.*/
+void SPDS_AdamsAdamsHawkins::BuildTaskDependencyGraphs(
+  const std::vector<SPDS_AdamsAdamsHawkins*>& spds_list)
+{
+  const size_t num_spds = spds_list.size();
+  const size_t P = Chi::mpi.process_count;
 
-  MPI_Bcast(&edge_buffer_size, // Buffer
-            1,
-            MPI_INT,        // Count and datatype
-            0,              // Root location
-            Chi::mpi.comm); // Communicator
+  Chi::log.Log0Verbose1() << Chi::program_timer.GetTimeString()
+                          << " Building " << num_spds
+                          << " Task Dependency Graph(s).";
 
-  //============================================= Broadcast edges
-  if (Chi::mpi.location_id != 0)
-    raw_edges_to_remove.resize(edge_buffer_size, -1);
+  for (size_t batch_begin = 0; batch_begin < num_spds; batch_begin += P)
+  {
+    const size_t batch_end = std::min(batch_begin + P, num_spds);
 
-  MPI_Bcast(raw_edges_to_remove.data(), // Buffer
-            edge_buffer_size,
-            MPI_INT,        // Count and datatype
-            0,              // Root location
-            Chi::mpi.comm); // Communicator
+    //=========================================== Gather on the roots
+    // Each location is the root of at most one sweep ordering of the batch.
+    std::vector<std::vector<int>> global_dependencies;
+    size_t rooted_spds = num_spds;
+    for (size_t i = batch_begin; i < batch_end; ++i)
+    {
+      const int root = static_cast<int>(i % P);
+      GatherLocationDependencies(
+        spds_list[i]->location_dependencies_, root, global_dependencies);
+      if (root == Chi::mpi.location_id) rooted_spds = i;
+    }
 
-  //============================================= De-serialize edges
-  if (Chi::mpi.location_id != 0)
-  {
-    edges_to_remove.resize(edge_buffer_size / 2, std::pair<int, int>(0, 0));
-    int i = 0;
-    for (auto& edge : edges_to_remove)
+    //=========================================== Serial step on the roots
+    // Each buffer holds the number of edges to remove, the edges, the
+    // global linear sweep order and the sweep order ranks.
+    std::vector<int> rooted_tdg_buffer;
+    if (rooted_spds < num_spds)
+      rooted_tdg_buffer = GenerateTaskDependencyGraph(
+        global_dependencies, spds_list[rooted_spds]->cycle_allowance_flag_);
+    global_dependencies = std::vector<std::vector<int>>();
+
+    //=========================================== Broadcast and apply
+    for (size_t i = batch_begin; i < batch_end; ++i)
     {
-      edge.first = raw_edges_to_remove[i++];
-      edge.second = raw_edges_to_remove[i++];
+      const int root = static_cast<int>(i % P);
+      std::vector<int> tdg_buffer;
+      if (i == rooted_spds) tdg_buffer = std::move(rooted_tdg_buffer);
+
+      int buffer_size = static_cast<int>(tdg_buffer.size());
+      MPI_Bcast(&buffer_size, // Buffer
+                1,
+                MPI_INT,        // Count and datatype
+                root,           // Root location
+                Chi::mpi.comm); // Communicator
+
+      tdg_buffer.resize(buffer_size, -1);
+      MPI_Bcast(tdg_buffer.data(), // Buffer
+                buffer_size,
+                MPI_INT,        // Count and datatype
+                root,           // Root location
+                Chi::mpi.comm); // Communicator
+
+      spds_list[i]->ApplyTaskDependencyGraph(tdg_buffer);
     }
   }
+}
 
-  //============================================= Remove edges
-  for (auto& edge_to_remove : edges_to_remove)
-  {
-    int rlocI = edge_to_remove.first;
-    int locI = edge_to_remove.second;
+// ###################################################################
+/**Builds the task dependency graph from the location dependencies of all
+ * locations, removes its cycles, if allowed, generates its topological
+ * sort and ranks the locations in that order. Returns a buffer with the
+ * number of edges removed, the removed edges, the global linear sweep
+ * order and the sweep order rank of each entry of that order.*/
+std::vector<int> SPDS_AdamsAdamsHawkins::GenerateTaskDependencyGraph(
+  const std::vector<std::vector<int>>& global_dependencies,
+  bool cycle_allowance_flag)
+{
+  const int P = static_cast<int>(global_dependencies.size());
+  std::vector<std::pair<int, int>> edges_to_remove;
+  chi::DirectedGraph TDG;
 
-    if (Chi::mpi.location_id == 0) TDG.RemoveEdge(rlocI, locI);
+  //====================================== Add vertices to the graph
+  for (int loc = 0; loc < P; loc++)
+    TDG.AddVertex();
 
-    if (locI == Chi::mpi.location_id)
-    {
-      auto dependent_location = std::find(
-        location_dependencies_.begin(), location_dependencies_.end(), rlocI);
-      location_dependencies_.erase(dependent_location);
-      delayed_location_dependencies_.push_back(rlocI);
-    }
-
-    if (rlocI == Chi::mpi.location_id)
-      delayed_location_successors_.push_back(locI);
-  }
+  //====================================== Add dependencies
+  for (int loc = 0; loc < P; loc++)
+    for (int dep = 0; dep < global_dependencies[loc].size(); dep++)
+      TDG.AddEdge(global_dependencies[loc][dep], loc);
 
-  //============================================= Generate topological sort
-  std::vector<int> glob_linear_sweep_order;
-  if (Chi::mpi.location_id == 0)
+  //====================================== Remove cyclic dependencies
+  if (cycle_allowance_flag)
   {
     Chi::log.LogAllVerbose2() << Chi::program_timer.GetTimeString()
-                              << "   - Generating topological sort.";
-    auto so_temp = TDG.GenerateTopologicalSort();
-    for (auto v : so_temp)
-      glob_linear_sweep_order.emplace_back(v);
-
-    if (glob_linear_sweep_order.empty())
-    {
-      Chi::log.LogAllError()
-        << "Topological sorting for global sweep-ordering failed. "
-        << "Cyclic dependencies detected. Cycles need to be allowed"
-        << " by calling application.";
-      Chi::Exit(EXIT_FAILURE);
-    }
+                              << "   - Removing intra-cellset cycles.";
+    auto edges_to_remove_temp = TDG.RemoveCyclicDependencies();
+    for (const auto& [v0, v1] : edges_to_remove_temp)
+      edges_to_remove.emplace_back(v0, v1);
   }
 
-  //============================================= Broadcasting topsort size
-  int topsort_buffer_size = 0;
+  for (const auto& [rlocI, locI] : edges_to_remove)
+    TDG.RemoveEdge(rlocI, locI);
 
-  if (Chi::mpi.location_id == 0)
-    topsort_buffer_size = glob_linear_sweep_order.size();
+  //====================================== Generate topological sort
+  Chi::log.LogAllVerbose2() << Chi::program_timer.GetTimeString()
+                            << "   - Generating topological sort.";
+  auto so_temp = TDG.GenerateTopologicalSort();
 
-  MPI_Bcast(&topsort_buffer_size, // Buffer
-            1,
-            MPI_INT,        // Count and datatype
-            0,              // Root location
-            Chi::mpi.comm); // Communicator
-
-  //============================================= Broadcast topological sort
-  if (Chi::mpi.location_id != 0)
-    glob_linear_sweep_order.resize(topsort_buffer_size, -1);
-
-  MPI_Bcast(glob_linear_sweep_order.data(), // Buffer
-            topsort_buffer_size,
-            MPI_INT,        // Count and datatype
-            0,              // Root location
-            Chi::mpi.comm); // Communicator
+  if (so_temp.empty())
+  {
+    Chi::log.LogAllError()
+      << "Topological sorting for global sweep-ordering failed. "
+      << "Cyclic dependencies detected. Cycles need to be allowed"
+      << " by calling application.";
+    Chi::Exit(EXIT_FAILURE);
+  }
 
-  //============================================= Compute reorder mapping
+  //====================================== Compute reorder mapping
   // This mapping allows us to punch in
   // the location id and find what its
   // id is in the TDG
-  std::vector<int> glob_order_mapping(Chi::mpi.process_count, -1);
+  std::vector<int> glob_order_mapping(P, -1);
 
-  for (int k = 0; k < Chi::mpi.process_count; k++)
+  for (int k = 0; k < P; k++)
   {
-    int loc = glob_linear_sweep_order[k];
+    int loc = static_cast<int>(so_temp[k]);
     glob_order_mapping[loc] = k;
   }
 
-  //============================================= Determine sweep order ranks
-  Chi::log.Log0Verbose1() << Chi::program_timer.GetTimeString()
-                          << " Determining sweep order ranks.";
+  //====================================== Determine sweep order ranks
+  Chi::log.LogAllVerbose2() << Chi::program_timer.GetTimeString()
+                            << "   - Determining sweep order ranks.";
 
-  std::vector<int> glob_sweep_order_rank(Chi::mpi.process_count, -1);
+  std::vector<int> glob_sweep_order_rank(P, -1);
 
-  int abs_max_rank = 0;
-  for (int k = 0; k < Chi::mpi.process_count; k++)
+  for (int k = 0; k < P; k++)
   {
-    int loc = glob_linear_sweep_order[k];
+    int loc = static_cast<int>(so_temp[k]);
     if (global_dependencies[loc].empty()) glob_sweep_order_rank[k] = 0;
     else
     {
@@ -297,18 +300,71 @@ void chi_mesh::sweep_management::SPDS_AdamsAdamsHawkins::
           max_rank = glob_sweep_order_rank[dep_mapped_index];
       }
       glob_sweep_order_rank[k] = max_rank + 1;
-      if ((max_rank + 1) > abs_max_rank) abs_max_rank = max_rank + 1;
     }
   }
 
+  //====================================== Serialize
+  std::vector<int> tdg_buffer;
+  tdg_buffer.reserve(1 + 2 * edges_to_remove.size() + 2 * so_temp.size());
+  tdg_buffer.push_back(static_cast<int>(edges_to_remove.size()));
+  for (const auto& [rlocI, locI] : edges_to_remove)
+  {
+    tdg_buffer.push_back(rlocI);
+    tdg_buffer.push_back(locI);
+  }
+  for (auto v : so_temp)
+    tdg_buffer.push_back(static_cast<int>(v));
+  for (int rank : glob_sweep_order_rank)
+    tdg_buffer.push_back(rank);
+
+  return tdg_buffer;
+}
+
+// ###################################################################
+/**Applies a task dependency graph, built by GenerateTaskDependencyGraph,
+ * to this location: delays the dependencies on the removed edges and
+ * generates the global sweep planes.*/
+void SPDS_AdamsAdamsHawkins::ApplyTaskDependencyGraph(
+  const std::vector<int>& tdg_buffer)
+{
+  const int P = Chi::mpi.process_count;
+
+  //============================================= De-serialize
+  const int num_edges_to_remove = tdg_buffer[0];
+  const auto sort_begin = tdg_buffer.begin() + 1 + 2 * num_edges_to_remove;
+  const std::vector<int> glob_linear_sweep_order(sort_begin, sort_begin + P);
+  const std::vector<int> glob_sweep_order_rank(sort_begin + P,
+                                               sort_begin + 2 * P);
+
+  //============================================= Remove edges
+  for (int e = 0; e < num_edges_to_remove; ++e)
+  {
+    int rlocI = tdg_buffer[1 + 2 * e];
+    int locI = tdg_buffer[2 + 2 * e];
+
+    if (locI == Chi::mpi.location_id)
+    {
+      auto dependent_location = std::find(
+        location_dependencies_.begin(), location_dependencies_.end(), rlocI);
+      location_dependencies_.erase(dependent_location);
+      delayed_location_dependencies_.push_back(rlocI);
+    }
+
+    if (rlocI == Chi::mpi.location_id)
+      delayed_location_successors_.push_back(locI);
+  }
+
   //============================================= Generate TDG structure
   Chi::log.Log0Verbose1() << Chi::program_timer.GetTimeString()
                           << " Generating TDG structure.";
+  const int abs_max_rank =
+    *std::max_element(glob_sweep_order_rank.begin(),
+                      glob_sweep_order_rank.end());
   for (int r = 0; r <= abs_max_rank; r++)
   {
     chi_mesh::sweep_management::STDG new_stdg;
 
-    for (int k = 0; k < Chi::mpi.process_count; k++)
+    for (int k = 0; k < P; k++)
     {
       if (glob_sweep_order_rank[k] == r)
         new_stdg.item_id.push_back(glob_linear_sweep_order[k]);
@@ -9,21 +9,40 @@ namespace chi_mesh::sweep_management
 class SPDS_AdamsAdamsHawkins : public SPDS
 {
 public:
+  /**Builds the sweep ordering. With `defer_task_dependency_graph` the
+   * global sweep planes are only built by a later, collective, call to
+   * BuildTaskDependencyGraphs.*/
   SPDS_AdamsAdamsHawkins(const chi_mesh::Vector3& omega,
                          const chi_mesh::MeshContinuum& grid,
                          bool cycle_allowance_flag,
+                         bool verbose,
+                         bool defer_task_dependency_graph = false);
+  /**Restores a sweep ordering written with Serialize. No communication is
+   * performed.*/
+  SPDS_AdamsAdamsHawkins(const chi_mesh::Vector3& omega,
+                         const chi_mesh::MeshContinuum& grid,
+                         chi_data_types::ByteArray& raw,
                          bool verbose);
+
+  void Serialize(chi_data_types::ByteArray& raw) const override;
+
   const std::vector<STDG>& GetGlobalSweepPlanes() const
   {
     return global_sweep_planes_;
   }
 
+  static void BuildTaskDependencyGraphs(
+    const std::vector<SPDS_AdamsAdamsHawkins*>& spds_list);
+
 private:
-  void BuildTaskDependencyGraph(
+  static std::vector<int> GenerateTaskDependencyGraph(
     const std::vector<std::vector<int>>& global_dependencies,
     bool cycle_allowance_flag);
+  void ApplyTaskDependencyGraph(const std::vector<int>& tdg_buffer);
 
   std::vector<STDG> global_sweep_planes_; ///< Processor sweep planes
+
+  bool cycle_allowance_flag_ = false;
 };
 
 }
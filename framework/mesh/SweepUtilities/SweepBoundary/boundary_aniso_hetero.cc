@@ -6,9 +6,11 @@
 #include "chi_runtime.h"
 #include "chi_log.h"
 
+using chi_mesh::sweep_management::PsiFloat;
+
 //###################################################################
 /**Returns a pointer to a heterogeneous flux storage location.*/
-double* chi_mesh::sweep_management::BoundaryIncidentHeterogeneous::
+PsiFloat* chi_mesh::sweep_management::BoundaryIncidentHeterogeneous::
 HeterogeneousPsiIncoming(uint64_t cell_local_id,
                            unsigned int face_num,
                            unsigned int fi,
@@ -108,7 +110,8 @@ Setup(const chi_mesh::MeshContinuum &grid,
                                            group_indices,
                                            eval_time);
 
-            face_data.push_back(std::move(face_node_data));
+            face_data.emplace_back(face_node_data.begin(),
+                                   face_node_data.end());
           }//for face node-i
         }//bndry face
 
@@ -1,8 +1,10 @@
 #include "sweep_boundaries.h"
 
+using chi_mesh::sweep_management::PsiFloat;
+
 //###################################################################
 /**Returns a pointer to a homogenous flux storage location.*/
-double* chi_mesh::sweep_management::BoundaryIsotropicHomogenous::
+PsiFloat* chi_mesh::sweep_management::BoundaryIsotropicHomogenous::
 HeterogeneousPsiIncoming(uint64_t cell_local_id,
                            unsigned int face_num,
                            unsigned int fi,
@@ -3,9 +3,11 @@
 #include "chi_log.h"
 #include "chi_mpi.h"
 
+using chi_mesh::sweep_management::PsiFloat;
+
 //###################################################################
 /**Returns a pointer to a reflected flux storage location.*/
-double* chi_mesh::sweep_management::BoundaryReflecting::
+PsiFloat* chi_mesh::sweep_management::BoundaryReflecting::
 HeterogeneousPsiIncoming(uint64_t cell_local_id,
   unsigned int face_num,
   unsigned int fi,
@@ -13,7 +15,7 @@ HeterogeneousPsiIncoming(uint64_t cell_local_id,
                          int group_num,
   size_t gs_ss_begin)
 {
-  double* Psi;
+  PsiFloat* Psi;
 
   int reflected_angle_num = reflected_anglenum_[angle_num];
 
@@ -37,7 +39,7 @@ HeterogeneousPsiIncoming(uint64_t cell_local_id,
 
 //###################################################################
 /**Returns a pointer to a heterogeneous flux storage location.*/
-double* chi_mesh::sweep_management::BoundaryReflecting::
+PsiFloat* chi_mesh::sweep_management::BoundaryReflecting::
 HeterogeneousPsiOutgoing(uint64_t cell_local_id,
   unsigned int face_num,
   unsigned int fi,
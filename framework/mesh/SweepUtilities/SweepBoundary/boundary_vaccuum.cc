@@ -1,8 +1,11 @@
 #include "sweep_boundaries.h"
 
+using chi_mesh::sweep_management::PsiFloat;
+
 // ###################################################################
 /**Returns a pointer to a heterogeneous flux storage location.*/
-double* chi_mesh::sweep_management::BoundaryVaccuum::HeterogeneousPsiIncoming(
+PsiFloat*
+chi_mesh::sweep_management::BoundaryVaccuum::HeterogeneousPsiIncoming(
   uint64_t cell_local_id,
   unsigned int face_num,
   unsigned int fi,
@@ -2,6 +2,7 @@
 #define CHI_SWEEP_BOUNDARY_BASE_H
 
 #include "mesh/chi_mesh.h"
+#include "mesh/SweepUtilities/sweep_namespace.h"
 #include "math/chi_math.h"
 
 #include <vector>
@@ -27,7 +28,7 @@ private:
   const chi_math::CoordinateSystemType coord_type_;
   double evaluation_time_ = 0.0; ///< Time value passed to boundary functions
 protected:
-  std::vector<double>  zero_boundary_flux_;
+  std::vector<PsiFloat> zero_boundary_flux_;
   size_t num_groups_;
 
 public:
@@ -51,18 +52,18 @@ public:
   void SetEvaluationTime(double time) { evaluation_time_ = time;}
 
 
-  virtual double* HeterogeneousPsiIncoming(uint64_t cell_local_id,
-                                           unsigned int face_num,
-                                           unsigned int fi,
-                                           unsigned int angle_num,
-                                           int group_num,
-                                           size_t gs_ss_begin);
+  virtual PsiFloat* HeterogeneousPsiIncoming(uint64_t cell_local_id,
+                                             unsigned int face_num,
+                                             unsigned int fi,
+                                             unsigned int angle_num,
+                                             int group_num,
+                                             size_t gs_ss_begin);
 
-  virtual double* HeterogeneousPsiOutgoing(uint64_t cell_local_id,
-                                           unsigned int face_num,
-                                           unsigned int fi,
-                                           unsigned int angle_num,
-                                           size_t gs_ss_begin);
+  virtual PsiFloat* HeterogeneousPsiOutgoing(uint64_t cell_local_id,
+                                             unsigned int face_num,
+                                             unsigned int fi,
+                                             unsigned int angle_num,
+                                             size_t gs_ss_begin);
 
   virtual void UpdateAnglesReadyStatus(const std::vector<size_t>& angles,
                                        size_t gs_ss)
@@ -73,7 +74,7 @@ public:
   virtual void Setup(const chi_mesh::MeshContinuum& grid,
                      const chi_math::AngularQuadrature& quadrature) {}
 
-  double* ZeroFlux(int group_num) {return &zero_boundary_flux_[group_num];}
+  PsiFloat* ZeroFlux(int group_num) {return &zero_boundary_flux_[group_num];}
 };
 
 //###################################################################
@@ -81,7 +82,7 @@ public:
 class BoundaryVaccuum : public SweepBoundary
 {
 private:
-  std::vector<double> boundary_flux_;
+  std::vector<PsiFloat> boundary_flux_;
 public:
   explicit
   BoundaryVaccuum(size_t in_num_groups,
@@ -91,7 +92,7 @@ public:
     boundary_flux_(in_num_groups, 0.0)
   {}
 
-  double* HeterogeneousPsiIncoming(
+  PsiFloat* HeterogeneousPsiIncoming(
     uint64_t cell_local_id,
                                    unsigned int face_num,
                                    unsigned int fi,
@@ -106,7 +107,7 @@ public:
 class BoundaryIsotropicHomogenous : public SweepBoundary
 {
 private:
-  std::vector<double> boundary_flux;
+  std::vector<PsiFloat> boundary_flux;
 public:
   explicit
   BoundaryIsotropicHomogenous(size_t in_num_groups,
@@ -115,10 +116,10 @@ public:
                               chi_math::CoordinateSystemType::CARTESIAN) :
     SweepBoundary(BoundaryType::INCIDENT_ISOTROPIC_HOMOGENOUS, in_num_groups,
                   coord_type),
-    boundary_flux(std::move(ref_boundary_flux))
+    boundary_flux(ref_boundary_flux.begin(), ref_boundary_flux.end())
   {}
 
-  double* HeterogeneousPsiIncoming(
+  PsiFloat* HeterogeneousPsiIncoming(
     uint64_t cell_local_id,
                                    unsigned int face_num,
                                    unsigned int fi,
@@ -135,7 +136,7 @@ protected:
   const chi_mesh::Normal normal_;
   bool  opposing_reflected_ = false;
 
-  typedef std::vector<double> DOFVec;   //Groups per DOF
+  typedef std::vector<PsiFloat> DOFVec; //Groups per DOF
   typedef std::vector<DOFVec> FaceVec;  //DOFs per face
   typedef std::vector<FaceVec> CellVec; //Faces per cell
   typedef std::vector<CellVec> AngVec;  //Cell per angle
@@ -168,17 +169,17 @@ public:
   std::vector<std::vector<bool>>&
   GetAngleReadyFlags() {return angle_readyflags_;}
 
-  double* HeterogeneousPsiIncoming(uint64_t cell_local_id,
-                                   unsigned int face_num,
-                                   unsigned int fi,
-                                   unsigned int angle_num,
-                                   int group_num,
-                                   size_t gs_ss_begin) override;
-  double* HeterogeneousPsiOutgoing(uint64_t cell_local_id,
-                                   unsigned int face_num,
-                                   unsigned int fi,
-                                   unsigned int angle_num,
-                                   size_t gs_ss_begin) override;
+  PsiFloat* HeterogeneousPsiIncoming(uint64_t cell_local_id,
+                                     unsigned int face_num,
+                                     unsigned int fi,
+                                     unsigned int angle_num,
+                                     int group_num,
+                                     size_t gs_ss_begin) override;
+  PsiFloat* HeterogeneousPsiOutgoing(uint64_t cell_local_id,
+                                     unsigned int face_num,
+                                     unsigned int fi,
+                                     unsigned int angle_num,
+                                     size_t gs_ss_begin) override;
 
   void UpdateAnglesReadyStatus(const std::vector<size_t>& angles,
                                size_t gs_ss) override;
@@ -217,7 +218,7 @@ private:
   std::unique_ptr<BoundaryFunction> boundary_function_;
   const uint64_t ref_boundary_id_;
 
-  typedef std::vector<double>       FaceNodeData;
+  typedef std::vector<PsiFloat>     FaceNodeData;
   typedef std::vector<FaceNodeData> FaceData;
   typedef std::vector<FaceData>     CellData;
 
@@ -235,12 +236,12 @@ public:
     ref_boundary_id_(in_ref_boundary_id)
   {}
 
-  double* HeterogeneousPsiIncoming(uint64_t cell_local_id,
-                                   unsigned int face_num,
-                                   unsigned int fi,
-                                   unsigned int angle_num,
-                                   int group_num,
-                                   size_t gs_ss_begin) override;
+  PsiFloat* HeterogeneousPsiIncoming(uint64_t cell_local_id,
+                                     unsigned int face_num,
+                                     unsigned int fi,
+                                     unsigned int angle_num,
+                                     int group_num,
+                                     size_t gs_ss_begin) override;
 
   void Setup(const chi_mesh::MeshContinuum &grid,
              const chi_math::AngularQuadrature &quadrature) override;
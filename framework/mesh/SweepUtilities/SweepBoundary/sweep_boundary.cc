@@ -4,9 +4,11 @@
 #include "chi_log.h"
 #include "chi_mpi.h"
 
+using chi_mesh::sweep_management::PsiFloat;
+
 //###################################################################
 /**Returns a pointer to a heterogeneous flux storage location.*/
-double* chi_mesh::sweep_management::SweepBoundary::
+PsiFloat* chi_mesh::sweep_management::SweepBoundary::
 HeterogeneousPsiIncoming(uint64_t cell_local_id,
   unsigned int face_num,
   unsigned int fi,
@@ -23,7 +25,7 @@ HeterogeneousPsiIncoming(uint64_t cell_local_id,
 
 //###################################################################
 /**Returns a pointer to a heterogeneous flux storage location.*/
-double* chi_mesh::sweep_management::SweepBoundary::
+PsiFloat* chi_mesh::sweep_management::SweepBoundary::
 HeterogeneousPsiOutgoing(uint64_t cell_local_id,
   unsigned int face_num,
   unsigned int fi,
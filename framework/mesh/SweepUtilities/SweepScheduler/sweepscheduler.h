@@ -4,6 +4,10 @@
 #include "mesh/SweepUtilities/AngleAggregation/angleaggregation.h"
 #include "mesh/SweepUtilities/sweepchunk_base.h"
 
+namespace chi
+{
+class ThreadPool;
+}
 
 namespace chi_mesh::sweep_management
 {
@@ -51,11 +55,21 @@ private:
   const size_t sweep_event_tag_;
   const std::vector<size_t> sweep_timing_events_tag_;
 
+  /**Sweep chunks owned by the worker slots when angle sets are executed
+   * on threads. Slot 0 is always `sweep_chunk_`. Empty when serial.*/
+  std::vector<SweepChunk*> worker_sweep_chunks_;
+  std::vector<std::shared_ptr<SweepChunk>> additional_sweep_chunks_;
+  std::unique_ptr<chi::ThreadPool> thread_pool_;
+  bool threaded_within_angle_sets_ = false;
+
 
 public:
   SweepScheduler(SchedulingAlgorithm in_scheduler_type,
                  AngleAggregation& in_angle_agg,
-                 SweepChunk& in_sweep_chunk);
+                 SweepChunk& in_sweep_chunk,
+                 const std::vector<std::shared_ptr<SweepChunk>>&
+                   additional_worker_sweep_chunks = {});
+  ~SweepScheduler();
 
   AngleAggregation& AngleAgg() {return angle_agg_;}
 
@@ -73,6 +87,13 @@ private:
   void InitializeAlgoDOG();
   void ScheduleAlgoDOG(SweepChunk& sweep_chunk);
 
+  //04 threaded
+  void InitializeThreadedExecution(
+    const std::vector<std::shared_ptr<SweepChunk>>& additional_sweep_chunks);
+  void ScheduleAlgoThreaded();
+  void ScheduleAlgoFIFOThreaded();
+  void ReceiveDelayedDataAndReset();
+
   //03 utils
 public:
   //phi
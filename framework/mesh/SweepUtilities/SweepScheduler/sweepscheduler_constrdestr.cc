@@ -2,13 +2,16 @@
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "utils/chi_thread_pool.h"
 
 // ###################################################################
 /**Sweep scheduler constructor*/
 chi_mesh::sweep_management::SweepScheduler::SweepScheduler(
   SchedulingAlgorithm in_scheduler_type,
   chi_mesh::sweep_management::AngleAggregation& in_angle_agg,
-  SweepChunk& in_sweep_chunk)
+  SweepChunk& in_sweep_chunk,
+  const std::vector<std::shared_ptr<SweepChunk>>&
+    additional_worker_sweep_chunks)
   : scheduler_type_(in_scheduler_type),
     angle_agg_(in_angle_agg),
     sweep_chunk_(in_sweep_chunk),
@@ -49,8 +52,16 @@ chi_mesh::sweep_management::SweepScheduler::SweepScheduler(
   for (auto& angsetgrp : in_angle_agg.angle_set_groups)
     for (auto& angset : angsetgrp.AngleSets())
       angset->SetMaxBufferMessages(global_max_num_messages);
+
+  if (not additional_worker_sweep_chunks.empty())
+    InitializeThreadedExecution(additional_worker_sweep_chunks);
 }
 
+// ###################################################################
+/**Default destructor. Defined here because the thread pool is
+ * an incomplete type in the header.*/
+chi_mesh::sweep_management::SweepScheduler::~SweepScheduler() = default;
+
 // ###################################################################
 /**Returns the referenced sweep chunk.*/
 chi_mesh::sweep_management::SweepChunk&
@@ -3,15 +3,26 @@
 #include "chi_runtime.h"
 #include "chi_log.h"
 
+#include <algorithm>
+
 //###################################################################
 /**This is the entry point for sweeping.*/
 void chi_mesh::sweep_management::SweepScheduler::
      Sweep()
 {
-  if (scheduler_type_ == SchedulingAlgorithm::FIRST_IN_FIRST_OUT)
+  auto& t_sweep = Chi::log.CreateOrGetTimingBlock("SweepScheduler::Sweep");
+  t_sweep.TimeSectionBegin();
+
+  if (thread_pool_ and threaded_within_angle_sets_)
+    ScheduleAlgoFIFOThreaded();
+  else if (thread_pool_)
+    ScheduleAlgoThreaded();
+  else if (scheduler_type_ == SchedulingAlgorithm::FIRST_IN_FIRST_OUT)
     ScheduleAlgoFIFO(sweep_chunk_);
   else if (scheduler_type_ == SchedulingAlgorithm::DEPTH_OF_GRAPH)
     ScheduleAlgoDOG(sweep_chunk_);
+
+  t_sweep.TimeSectionEnd();
 }
 
 //###################################################################
@@ -28,6 +39,9 @@ double chi_mesh::sweep_management::SweepScheduler::GetAverageSweepTime() const
  * [0] Total sweep time
  * [1] Total chunk time
  * [2] Total chunk time / total sweep time
+ *
+ * For threaded sweeps the chunk time is summed over the worker threads,
+ * hence [2] is divided by the number of worker slots.
  * */
 std::vector<double>
   chi_mesh::sweep_management::SweepScheduler::GetAngleSetTimings()
@@ -41,7 +55,11 @@ std::vector<double>
     Chi::log.ProcessEvent(
     sweep_timing_events_tag_[0], chi::ChiLog::EventOperation::TOTAL_DURATION);
 
-  double ratio_sweep_to_chunk = total_chunk_time/total_sweep_time;
+  const double num_worker_slots =
+    std::max<double>(1.0, static_cast<double>(worker_sweep_chunks_.size()));
+
+  double ratio_sweep_to_chunk =
+    total_chunk_time / (total_sweep_time * num_worker_slots);
 
   info.push_back(total_sweep_time);
   info.push_back(total_chunk_time);
@@ -0,0 +1,269 @@
+#include "sweepscheduler.h"
+
+#include "mesh/SweepUtilities/AngleSet/AAH_AngleSet.h"
+
+#include "utils/chi_thread_pool.h"
+#include "utils/chi_timer.h"
+
+#include "chi_runtime.h"
+#include "chi_mpi.h"
+#include "chi_log.h"
+
+#include <future>
+#include <thread>
+
+// ###################################################################
+/**Sets up the worker slots used for threaded sweeps. Slot 0 uses the
+ * scheduler's own sweep chunk, every additional sweep chunk adds a slot.
+ * Only the calling thread communicates, the workers only execute sweep
+ * chunks.
+ *
+ * When all anglesets are AAH anglesets, whole anglesets execute
+ * concurrently. Otherwise the cells of one angleset are swept
+ * concurrently, see AngleSet::AngleSetAdvanceThreaded.*/
+void chi_mesh::sweep_management::SweepScheduler::InitializeThreadedExecution(
+  const std::vector<std::shared_ptr<SweepChunk>>& additional_sweep_chunks)
+{
+  size_t num_angle_sets = 0;
+  size_t num_aah_angle_sets = 0;
+  for (auto& angsetgrp : angle_agg_.angle_set_groups)
+    for (auto& angset : angsetgrp.AngleSets())
+    {
+      ++num_angle_sets;
+      if (dynamic_cast<AAH_AngleSet*>(angset.get())) ++num_aah_angle_sets;
+    }
+
+  ChiLogicalErrorIf(num_aah_angle_sets != 0 and
+                      num_aah_angle_sets != num_angle_sets,
+                    "Threaded sweeps do not support mixing AAH anglesets "
+                    "with other angleset types.");
+
+  threaded_within_angle_sets_ = num_aah_angle_sets == 0;
+
+  ChiLogicalErrorIf(Chi::mpi.thread_support < MPI_THREAD_FUNNELED,
+                    "Threaded sweeps require an MPI library providing at "
+                    "least MPI_THREAD_FUNNELED.");
+
+  worker_sweep_chunks_.push_back(&sweep_chunk_);
+  for (const auto& sweep_chunk : additional_sweep_chunks)
+  {
+    ChiLogicalErrorIf(not sweep_chunk, "Null worker sweep chunk supplied.");
+    additional_sweep_chunks_.push_back(sweep_chunk);
+    worker_sweep_chunks_.push_back(sweep_chunk.get());
+  }
+
+  thread_pool_ = std::make_unique<chi::ThreadPool>(worker_sweep_chunks_.size());
+}
+
+// ###################################################################
+/**Executes anglesets concurrently on the worker slots. The anglesets are
+ * visited in the order of the scheduling algorithm, i.e. Depth-Of-Graph
+ * order or First-In-First-Out order. Communication (receiving upstream psi,
+ * sending downstream psi and boundary bookkeeping) stays on the calling
+ * thread.
+ *
+ * Two anglesets that refer to the same group subset write to the same
+ * entries of the destination phi/psi vectors and are therefore never
+ * executed at the same time. Anglesets of different group subsets write to
+ * disjoint entries which makes the concurrent updates safe without
+ * locking. The attainable concurrency is therefore bounded by the number of
+ * group subsets of the groupset.*/
+void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoThreaded()
+{
+  typedef ExecutionPermission ExePerm;
+  typedef AngleSetStatus Status;
+
+  Chi::log.LogEvent(sweep_event_tag_, chi::ChiLog::EventType::EVENT_BEGIN);
+
+  auto ev_info =
+    std::make_shared<chi::ChiLog::EventInfo>(std::string("Sweep initiated"));
+
+  Chi::log.LogEvent(
+    sweep_event_tag_, chi::ChiLog::EventType::SINGLE_OCCURRENCE, ev_info);
+
+  //================================================== Order anglesets
+  std::vector<AAH_AngleSet*> angle_sets;
+  if (scheduler_type_ == SchedulingAlgorithm::DEPTH_OF_GRAPH)
+    for (auto& rule_value : rule_values_)
+      angle_sets.push_back(
+        static_cast<AAH_AngleSet*>(rule_value.angle_set.get()));
+  else
+    for (auto& angle_set_group : angle_agg_.angle_set_groups)
+      for (auto& angle_set : angle_set_group.AngleSets())
+        angle_sets.push_back(static_cast<AAH_AngleSet*>(angle_set.get()));
+
+  const size_t num_angle_sets = angle_sets.size();
+
+  // The workers must not log events, they time their sweep chunk and the
+  // chunk event is logged on retirement.
+  struct WorkerSlot
+  {
+    bool occupied = false;
+    size_t angle_set_index = 0;
+    std::future<void> future;
+    double chunk_begin_time = 0.0;
+    double chunk_end_time = 0.0;
+  };
+  std::vector<WorkerSlot> slots(worker_sweep_chunks_.size());
+  std::vector<bool> in_flight(num_angle_sets, false);
+  std::vector<bool> group_subset_busy(angle_agg_.number_of_group_subsets,
+                                      false);
+
+  //==================================================== Loop till done
+  bool finished = false;
+  while (not finished)
+  {
+    finished = true;
+    bool progress = false;
+
+    //=============================== Retire completed sweep chunks
+    for (auto& slot : slots)
+    {
+      if (not slot.occupied) continue;
+      if (slot.future.wait_for(std::chrono::seconds(0)) !=
+          std::future_status::ready)
+        continue;
+
+      slot.future.get(); // Rethrows exceptions from the worker
+
+      Chi::log.LogEventInterval(sweep_timing_events_tag_[0],
+                                slot.chunk_begin_time,
+                                slot.chunk_end_time);
+
+      auto& angle_set = *angle_sets[slot.angle_set_index];
+      angle_set.FinalizeExecution();
+
+      group_subset_busy[angle_set.GetRefGroupSubset()] = false;
+      in_flight[slot.angle_set_index] = false;
+      slot.occupied = false;
+      progress = true;
+    }
+
+    //=============================== Advance and dispatch anglesets
+    for (size_t as = 0; as < num_angle_sets; ++as)
+    {
+      if (in_flight[as])
+      {
+        finished = false;
+        continue;
+      }
+
+      auto& angle_set = *angle_sets[as];
+
+      // Status will here be one of RECEIVING, READY_TO_EXECUTE or FINISHED
+      const Status status = angle_set.AngleSetAdvance(
+        sweep_chunk_, sweep_timing_events_tag_, ExePerm::NO_EXEC_IF_READY);
+
+      if (status != Status::FINISHED) finished = false;
+      if (status != Status::READY_TO_EXECUTE) continue;
+
+      const size_t gs_ss = angle_set.GetRefGroupSubset();
+      if (group_subset_busy[gs_ss]) continue;
+
+      size_t s = 0;
+      while (s < slots.size() and slots[s].occupied)
+        ++s;
+      if (s == slots.size()) continue;
+
+      angle_set.InitializeExecution();
+
+      SweepChunk& sweep_chunk = *worker_sweep_chunks_[s];
+      WorkerSlot& slot = slots[s];
+      slot.future = thread_pool_->Enqueue(
+        [&angle_set, &sweep_chunk, &slot]()
+        {
+          slot.chunk_begin_time = Chi::program_timer.GetTime();
+          angle_set.ExecuteSweepChunk(sweep_chunk);
+          slot.chunk_end_time = Chi::program_timer.GetTime();
+        });
+      slot.occupied = true;
+      slot.angle_set_index = as;
+
+      group_subset_busy[gs_ss] = true;
+      in_flight[as] = true;
+      progress = true;
+    } // for angleset
+
+    if (not progress and not finished) std::this_thread::yield();
+  } // while not finished
+
+  ReceiveDelayedDataAndReset();
+
+  Chi::log.LogEvent(sweep_event_tag_, chi::ChiLog::EventType::EVENT_END);
+}
+
+// ###################################################################
+/**Applies a First-In-First-Out sweep scheduling where each angleset
+ * sweeps its cells with all the worker slots.*/
+void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoFIFOThreaded()
+{
+  Chi::log.LogEvent(sweep_event_tag_, chi::ChiLog::EventType::EVENT_BEGIN);
+
+  auto ev_info =
+    std::make_shared<chi::ChiLog::EventInfo>(std::string("Sweep initiated"));
+
+  Chi::log.LogEvent(
+    sweep_event_tag_, chi::ChiLog::EventType::SINGLE_OCCURRENCE, ev_info);
+
+  //================================================== Loop over AngleSetGroups
+  AngleSetStatus completion_status = AngleSetStatus::NOT_FINISHED;
+  while (completion_status == AngleSetStatus::NOT_FINISHED)
+  {
+    completion_status = AngleSetStatus::FINISHED;
+
+    for (auto& angle_set_group : angle_agg_.angle_set_groups)
+      for (auto& angle_set : angle_set_group.AngleSets())
+      {
+        const auto angle_set_status = angle_set->AngleSetAdvanceThreaded(
+          worker_sweep_chunks_, *thread_pool_, sweep_timing_events_tag_);
+        if (angle_set_status == AngleSetStatus::NOT_FINISHED)
+          completion_status = AngleSetStatus::NOT_FINISHED;
+      } // for angleset
+  }   // while not finished
+
+  ReceiveDelayedDataAndReset();
+
+  Chi::log.LogEvent(sweep_event_tag_, chi::ChiLog::EventType::EVENT_END);
+}
+
+// ###################################################################
+/**Flushes the send buffers and receives delayed data of all the
+ * anglesets after which the sweep buffers and reflecting boundaries are
+ * reset.*/
+void chi_mesh::sweep_management::SweepScheduler::ReceiveDelayedDataAndReset()
+{
+  typedef AngleSetStatus Status;
+
+  //================================================== Receive delayed data
+  Chi::mpi.Barrier();
+  bool received_delayed_data = false;
+  while (not received_delayed_data)
+  {
+    received_delayed_data = true;
+
+    for (auto& angle_set_group : angle_agg_.angle_set_groups)
+      for (auto& angle_set : angle_set_group.AngleSets())
+      {
+        if (angle_set->FlushSendBuffers() == Status::MESSAGES_PENDING)
+          received_delayed_data = false;
+
+        if (not angle_set->ReceiveDelayedData())
+          received_delayed_data = false;
+      }
+  }
+
+  //================================================== Reset all
+  for (auto& angle_set_group : angle_agg_.angle_set_groups)
+    for (auto& angle_set : angle_set_group.AngleSets())
+      angle_set->ResetSweepBuffers();
+
+  for (auto& [bid, bndry] : angle_agg_.sim_boundaries)
+  {
+    if (bndry->Type() == chi_mesh::sweep_management::BoundaryType::REFLECTING)
+    {
+      auto rbndry = std::static_pointer_cast<
+        chi_mesh::sweep_management::BoundaryReflecting>(bndry);
+      rbndry->ResetAnglesReadyStatus();
+    }
+  }
+}
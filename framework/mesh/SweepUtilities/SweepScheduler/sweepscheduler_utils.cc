@@ -7,6 +7,8 @@ using namespace chi_mesh::sweep_management;
 void SweepScheduler::SetDestinationPhi(std::vector<double> &in_destination_phi)
 {
   sweep_chunk_.SetDestinationPhi(in_destination_phi);
+  for (auto& sweep_chunk : additional_sweep_chunks_)
+    sweep_chunk->SetDestinationPhi(in_destination_phi);
 }
 
 /**Sets all elements of the output vector to zero.*/
@@ -26,6 +28,8 @@ std::vector<double>& SweepScheduler::GetDestinationPhi()
 void SweepScheduler::SetDestinationPsi(std::vector<double>& in_destination_psi)
 {
   sweep_chunk_.SetDestinationPsi(in_destination_psi);
+  for (auto& sweep_chunk : additional_sweep_chunks_)
+    sweep_chunk->SetDestinationPsi(in_destination_psi);
 }
 
 /**Sets all elements of the output angular flux vector to zero.*/
@@ -68,4 +72,6 @@ void SweepScheduler::ZeroOutputFluxDataStructures()
 void SweepScheduler::SetBoundarySourceActiveFlag(bool flag_value)
 {
   sweep_chunk_.SetBoundarySourceActiveFlag(flag_value);
+  for (auto& sweep_chunk : additional_sweep_chunks_)
+    sweep_chunk->SetBoundarySourceActiveFlag(flag_value);
 }
@@ -51,4 +51,62 @@ void chi_mesh::sweep_management::
       global_dependencies[locI][c] = raw_dependencies[addr];
     }
   }
-}
\ No newline at end of file
+}
+//###################################################################
+/**Gathers location by location dependencies on a single root location.
+ * Only the root's `global_dependencies` is populated, the other locations'
+ * is left untouched.*/
+void chi_mesh::sweep_management::
+  GatherLocationDependencies(
+    const std::vector<int> &location_dependencies,
+    int root,
+    std::vector<std::vector<int>> &global_dependencies)
+{
+  const int P = Chi::mpi.process_count;
+  const bool is_root = Chi::mpi.location_id == root;
+
+  //============================================= Gather location dep counts
+  std::vector<int> depcount_per_loc(is_root ? P : 0, 0);
+  int current_loc_dep_count = location_dependencies.size();
+  MPI_Gather(&current_loc_dep_count,                  //Send Buffer
+             1, MPI_INT,                              //Send count and type
+             depcount_per_loc.data(),                 //Recv Buffer
+             1, MPI_INT,                              //Recv count and type
+             root,                                    //Root location
+             Chi::mpi.comm);                         //Communicator
+
+  //============================================= Gather dependencies
+  std::vector<int> raw_depvec_displs(is_root ? P : 0, 0);
+  int recv_buf_size = is_root ? depcount_per_loc[0] : 0;
+  if (is_root)
+    for (int locI=1; locI<P; ++locI)
+    {
+      raw_depvec_displs[locI] = raw_depvec_displs[locI-1] + depcount_per_loc[locI-1];
+      recv_buf_size += depcount_per_loc[locI];
+    }
+
+  std::vector<int> raw_dependencies(recv_buf_size,0);
+
+  MPI_Gatherv(location_dependencies.data(),     //Send buffer
+              int(location_dependencies.size()),     //Send count
+              MPI_INT,                                       //Send type
+              raw_dependencies.data(),                       //Recv buffer
+              depcount_per_loc.data(),                       //Recv counts array
+              raw_depvec_displs.data(),                      //Recv displs
+              MPI_INT,                                       //Recv type
+              root,                                          //Root location
+              Chi::mpi.comm);                               //Communicator
+
+  if (not is_root) return;
+
+  global_dependencies.resize(P);
+  for (int locI=0; locI<P; ++locI)
+  {
+    global_dependencies[locI].resize(depcount_per_loc[locI], 0);
+    for (int c=0; c < depcount_per_loc[locI]; ++c)
+    {
+      int addr = raw_depvec_displs[locI] + c;
+      global_dependencies[locI][c] = raw_dependencies[addr];
+    }
+  }
+}
@@ -17,6 +17,17 @@ namespace chi_mesh
 namespace sweep_management
 {
 
+/**Floating point type of the angular fluxes held by the sweep data
+ * structures, i.e., the FLUDS, the boundaries and the messages between
+ * locations. Building with `CHI_SWEEP_SINGLE_PRECISION_PSI` halves the
+ * memory and communication volume of the sweep. Cell solves and the
+ * accumulation of flux moments remain in double precision.*/
+#ifdef CHI_SWEEP_SINGLE_PRECISION_PSI
+typedef float PsiFloat;
+#else
+typedef double PsiFloat;
+#endif
+
 enum class FaceOrientation : short
 {
   PARALLEL = -1,
@@ -50,6 +61,10 @@ class SweepScheduler;
 void CommunicateLocationDependencies(
   const std::vector<int>& location_dependencies,
   std::vector<std::vector<int>>& global_dependencies);
+void GatherLocationDependencies(
+  const std::vector<int>& location_dependencies,
+  int root,
+  std::vector<std::vector<int>>& global_dependencies);
 
 void PrintSweepOrdering(SPDS* sweep_order, MeshContinuumPtr vol_continuum);
 
@@ -65,11 +65,46 @@ public:
            zmax = 0.0;
   };
 
+  /**Compressed (CSR) storage of the ids of the cells subscribing to each
+   * vertex. The cell ids of a vertex are sorted in ascending order.*/
+  class VertexCellSubscriptions
+  {
+  public:
+    /**Contiguous range of the cell ids subscribing to a single vertex.*/
+    struct Range
+    {
+      const uint64_t* begin_;
+      const uint64_t* end_;
+
+      const uint64_t* begin() const { return begin_; }
+      const uint64_t* end() const { return end_; }
+      size_t size() const { return end_ - begin_; }
+      bool empty() const { return begin_ == end_; }
+    };
+
+    Range operator[](uint64_t vertex_id) const
+    {
+      return {cell_ids_.data() + offsets_[vertex_id],
+              cell_ids_.data() + offsets_[vertex_id + 1]};
+    }
+
+    /**Returns the number of vertices.*/
+    size_t size() const { return offsets_.empty() ? 0 : offsets_.size() - 1; }
+
+    void Build(const std::vector<LightWeightCell*>& cells,
+               size_t num_vertices);
+    void Clear();
+
+  private:
+    std::vector<uint64_t> offsets_;
+    std::vector<uint64_t> cell_ids_;
+  };
+
 protected:
   std::vector<chi_mesh::Vertex> vertices_;
   std::vector<LightWeightCell*> raw_cells_;
   std::vector<LightWeightCell*> raw_boundary_cells_;
-  std::vector<std::set<uint64_t>> vertex_cell_subscriptions_;
+  VertexCellSubscriptions vertex_cell_subscriptions_;
 
   MeshAttributes attributes_ = NONE;
   Options mesh_options_;
@@ -101,7 +136,7 @@ public:
   MeshAttributes& GetMeshAttributes() { return attributes_; }
   const MeshAttributes& GetMeshAttributes() const { return attributes_; }
 
-  const std::vector<std::set<uint64_t>>& GetVertextCellSubscriptions() const
+  const VertexCellSubscriptions& GetVertextCellSubscriptions() const
   {
     return vertex_cell_subscriptions_;
   }
@@ -153,8 +188,7 @@ public:
     raw_cells_.shrink_to_fit();
     raw_boundary_cells_.clear();
     raw_boundary_cells_.shrink_to_fit();
-    vertex_cell_subscriptions_.clear();
-    vertex_cell_subscriptions_.shrink_to_fit();
+    vertex_cell_subscriptions_.Clear();
   }
 };
 
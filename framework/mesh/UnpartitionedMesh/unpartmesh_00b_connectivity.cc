@@ -4,11 +4,92 @@
 #include "chi_log.h"
 
 #include "utils/chi_timer.h"
+#include "utils/chi_thread_pool.h"
 
 #include "chi_mpi.h"
 
+#include <algorithm>
+#include <unordered_map>
+
+namespace
+{
+/**Identifies a single face of a cell together with the hash of its sorted
+ * vertex ids.*/
+struct FaceKey
+{
+  uint64_t hash;
+  uint64_t cell_id;
+  uint32_t face_index;
+};
+
+/**Hashes a sorted list of vertex ids.*/
+uint64_t HashSortedVertexIDs(const std::vector<uint64_t>& sorted_vids)
+{
+  uint64_t hash = sorted_vids.size();
+  for (uint64_t vid : sorted_vids)
+  {
+    // splitmix64 finalizer on each id, combined order-dependently
+    uint64_t z = vid + 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    z = z ^ (z >> 31);
+    hash = (hash ^ z) * 0x100000001b3ULL + (hash << 6) + (hash >> 2);
+  }
+  return hash;
+}
+
+std::vector<uint64_t> SortedCopy(const std::vector<uint64_t>& vids)
+{
+  std::vector<uint64_t> sorted_vids(vids);
+  std::sort(sorted_vids.begin(), sorted_vids.end());
+  return sorted_vids;
+}
+} // namespace
+
+//###################################################################
+/**Builds the compressed vertex-to-cell subscriptions.*/
+void chi_mesh::UnpartitionedMesh::VertexCellSubscriptions::Build(
+  const std::vector<LightWeightCell*>& cells, size_t num_vertices)
+{
+  offsets_.assign(num_vertices + 1, 0);
+  for (const auto& cell : cells)
+    for (uint64_t vid : cell->vertex_ids)
+      ++offsets_.at(vid + 1);
+
+  for (size_t v = 0; v < num_vertices; ++v)
+    offsets_[v + 1] += offsets_[v];
+
+  // Cells are visited in ascending order so each vertex's list is sorted
+  cell_ids_.resize(offsets_.back());
+  std::vector<uint64_t> fill_position(offsets_.begin(), offsets_.end() - 1);
+  uint64_t cell_id = 0;
+  for (const auto& cell : cells)
+  {
+    for (uint64_t vid : cell->vertex_ids)
+      cell_ids_[fill_position[vid]++] = cell_id;
+    ++cell_id;
+  }
+}
+
 //###################################################################
-/**Establishes neighbor connectivity for the light-weight mesh.*/
+/**Releases the subscriptions' memory.*/
+void chi_mesh::UnpartitionedMesh::VertexCellSubscriptions::Clear()
+{
+  offsets_.clear();
+  offsets_.shrink_to_fit();
+  cell_ids_.clear();
+  cell_ids_.shrink_to_fit();
+}
+
+//###################################################################
+/**Establishes neighbor connectivity for the light-weight mesh.
+ *
+ * Every unconnected face is keyed by a hash of its sorted vertex ids. The
+ * keys are scattered into one bucket per thread and each bucket is sorted
+ * and matched independently, therefore every face is written by exactly one
+ * thread and the result does not depend on the number of threads. The
+ * number of threads is set with the `--mesh_threads` command line
+ * argument.*/
 void chi_mesh::UnpartitionedMesh::BuildMeshConnectivity()
 {
   const size_t num_raw_cells = raw_cells_.size();
@@ -27,134 +108,195 @@ void chi_mesh::UnpartitionedMesh::BuildMeshConnectivity()
   Chi::log.Log() << Chi::program_timer.GetTimeString()
                 << " Establishing cell connectivity.";
 
-  //======================================== Establish internal connectivity
-  // Populate vertex subscriptions to internal cells
-  vertex_cell_subscriptions_.resize(num_raw_vertices);
+  chi::ThreadPool thread_pool(Chi::run_time::num_mesh_threads_);
+  const size_t num_buckets = thread_pool.NumThreads();
+
+  //======================================== Populate vertex subscriptions
+  vertex_cell_subscriptions_.Build(raw_cells_, num_raw_vertices);
+
+  Chi::log.Log() << Chi::program_timer.GetTimeString()
+                << " Vertex cell subscriptions complete.";
+
+  //======================================== Hash unconnected faces
+  // Face keys are stored contiguously in cell order
+  std::vector<uint64_t> cell_key_offsets(num_raw_cells + 1, 0);
+  for (size_t c = 0; c < num_raw_cells; ++c)
   {
-    uint64_t cur_cell_id=0;
-    for (const auto& cell : raw_cells_)
+    size_t num_unconnected = 0;
+    for (const auto& face : raw_cells_[c]->faces)
+      if (not face.has_neighbor) ++num_unconnected;
+    cell_key_offsets[c + 1] = cell_key_offsets[c] + num_unconnected;
+  }
+
+  std::vector<FaceKey> face_keys(cell_key_offsets.back());
+  thread_pool.ParallelFor(
+    num_raw_cells,
+    [&](size_t begin, size_t end, size_t)
     {
-      for (auto vid : cell->vertex_ids)
-        vertex_cell_subscriptions_.at(vid).insert(cur_cell_id);
-      ++cur_cell_id;
+      for (size_t c = begin; c < end; ++c)
+      {
+        size_t k = cell_key_offsets[c];
+        const auto& faces = raw_cells_[c]->faces;
+        for (size_t f = 0; f < faces.size(); ++f)
+        {
+          if (faces[f].has_neighbor) continue;
+          face_keys[k++] = {HashSortedVertexIDs(
+                              SortedCopy(faces[f].vertex_ids)),
+                            c,
+                            static_cast<uint32_t>(f)};
+        }
+      }
+    });
+
+  //======================================== Scatter keys into buckets
+  // Two faces that match share a hash, hence also a bucket.
+  std::vector<std::vector<uint64_t>> chunk_bucket_counts(
+    num_buckets, std::vector<uint64_t>(num_buckets, 0));
+  thread_pool.ParallelFor(
+    face_keys.size(),
+    [&](size_t begin, size_t end, size_t chunk_id)
+    {
+      auto& counts = chunk_bucket_counts[chunk_id];
+      for (size_t k = begin; k < end; ++k)
+        ++counts[face_keys[k].hash % num_buckets];
+    });
+
+  std::vector<uint64_t> bucket_offsets(num_buckets + 1, 0);
+  std::vector<std::vector<uint64_t>> chunk_bucket_positions(
+    num_buckets, std::vector<uint64_t>(num_buckets, 0));
+  {
+    uint64_t position = 0;
+    for (size_t b = 0; b < num_buckets; ++b)
+    {
+      bucket_offsets[b] = position;
+      for (size_t chunk = 0; chunk < num_buckets; ++chunk)
+      {
+        chunk_bucket_positions[chunk][b] = position;
+        position += chunk_bucket_counts[chunk][b];
+      }
     }
+    bucket_offsets[num_buckets] = position;
   }
 
+  std::vector<FaceKey> bucketed_keys(face_keys.size());
+  thread_pool.ParallelFor(
+    face_keys.size(),
+    [&](size_t begin, size_t end, size_t chunk_id)
+    {
+      auto& positions = chunk_bucket_positions[chunk_id];
+      for (size_t k = begin; k < end; ++k)
+        bucketed_keys[positions[face_keys[k].hash % num_buckets]++] =
+          face_keys[k];
+    });
+  face_keys.clear();
+  face_keys.shrink_to_fit();
+
   Chi::log.Log() << Chi::program_timer.GetTimeString()
-                << " Vertex cell subscriptions complete.";
+                << " Hashed " << bucketed_keys.size() << " faces.";
 
-  // Process raw cells
-  {
-    uint64_t aux_counter = 0;
-    uint64_t cur_cell_id=0;
-    for (auto& cell : raw_cells_)
+  //======================================== Match faces within each bucket
+  // Keys are ordered by hash and then by cell/face, so that, within a run of
+  // equal hashes, each face is paired with the first later face, of another
+  // cell, that has the same vertices.
+  thread_pool.ParallelFor(
+    num_buckets,
+    [&](size_t begin, size_t end, size_t)
     {
-      for (auto& cur_cell_face : cell->faces)
+      for (size_t b = begin; b < end; ++b)
       {
-        if (cur_cell_face.has_neighbor) {continue;}
-        const std::set<uint64_t> cfvids(cur_cell_face.vertex_ids.begin(),
-                                        cur_cell_face.vertex_ids.end());
+        auto bucket_begin = bucketed_keys.begin() + bucket_offsets[b];
+        auto bucket_end = bucketed_keys.begin() + bucket_offsets[b + 1];
+        std::sort(bucket_begin,
+                  bucket_end,
+                  [](const FaceKey& lhs, const FaceKey& rhs)
+                  {
+                    if (lhs.hash != rhs.hash) return lhs.hash < rhs.hash;
+                    if (lhs.cell_id != rhs.cell_id)
+                      return lhs.cell_id < rhs.cell_id;
+                    return lhs.face_index < rhs.face_index;
+                  });
 
-        std::set<size_t> cells_to_search;
-        for (uint64_t vid : cfvids)
-          for (uint64_t cell_id : vertex_cell_subscriptions_.at(vid))
-            if (cell_id != cur_cell_id)
-              cells_to_search.insert(cell_id);
-
-        for (uint64_t adj_cell_id : cells_to_search)
+        for (auto run_begin = bucket_begin; run_begin != bucket_end;)
         {
-          auto adj_cell = raw_cells_.at(adj_cell_id);
+          auto run_end = run_begin + 1;
+          while (run_end != bucket_end and run_end->hash == run_begin->hash)
+            ++run_end;
 
-          for (auto& adj_cell_face : adj_cell->faces)
+          for (auto cur = run_begin; cur != run_end; ++cur)
           {
-            if (adj_cell_face.has_neighbor) {continue;}
-            const std::set<uint64_t> afvids(adj_cell_face.vertex_ids.begin(),
-                                            adj_cell_face.vertex_ids.end());
+            auto& cur_face = raw_cells_[cur->cell_id]->faces[cur->face_index];
+            if (cur_face.has_neighbor) continue;
+            const auto cur_vids = SortedCopy(cur_face.vertex_ids);
 
-            if (cfvids == afvids)
+            for (auto adj = cur + 1; adj != run_end; ++adj)
             {
-              cur_cell_face.neighbor = adj_cell_id;
-              adj_cell_face.neighbor = cur_cell_id;
+              if (adj->cell_id == cur->cell_id) continue;
+              auto& adj_face =
+                raw_cells_[adj->cell_id]->faces[adj->face_index];
+              if (adj_face.has_neighbor) continue;
+              if (SortedCopy(adj_face.vertex_ids) != cur_vids) continue;
 
-              cur_cell_face.has_neighbor = true;
-              adj_cell_face.has_neighbor = true;
+              cur_face.neighbor = adj->cell_id;
+              adj_face.neighbor = cur->cell_id;
 
-              goto face_neighbor_found;
+              cur_face.has_neighbor = true;
+              adj_face.has_neighbor = true;
+              break;
             }
-          }//for adjacent cell face
-        }
-        face_neighbor_found:;
-      }//for face
+          }
 
-      ++cur_cell_id;
-      const double fraction_complete = static_cast<double>(cur_cell_id)/
-                                       static_cast<double>(num_raw_cells);
-      if (fraction_complete >= static_cast<double>(aux_counter+1)*0.1)
-      {
-        Chi::log.Log() << Chi::program_timer.GetTimeString()
-                      << " Surpassing cell " << cur_cell_id
-                      << " of " << num_raw_cells
-                      << " (" << (aux_counter+1)*10 << "%)";
-        ++aux_counter;
-      }
-    }//for cell
-  }
+          run_begin = run_end;
+        } // for run
+      }   // for bucket
+    });
+
+  bucketed_keys.clear();
+  bucketed_keys.shrink_to_fit();
 
   Chi::log.Log() << Chi::program_timer.GetTimeString()
                 << " Establishing cell boundary connectivity.";
 
   //======================================== Establish boundary connectivity
-  // Make list of internal cells on the boundary
-  std::vector<LightWeightCell*> internal_cells_on_boundary;
-  for (auto& cell : raw_cells_)
-  {
-    bool cell_on_boundary = false;
-    for (auto& face : cell->faces)
-      if (not face.has_neighbor)
-      { cell_on_boundary = true; break; }
-
-    if (cell_on_boundary) internal_cells_on_boundary.push_back(cell);
-  }
-
-  // Populate vertex subscriptions to boundary cells
-  std::vector<std::set<uint64_t>> vertex_bndry_cell_subscriptions(vertices_.size());
+  // Hash boundary cells by their sorted vertex ids. Entries with the same
+  // hash are stored in ascending boundary cell order.
+  std::unordered_map<uint64_t, std::vector<uint64_t>> bndry_cell_hash_map;
+  bndry_cell_hash_map.reserve(raw_boundary_cells_.size());
   {
-    uint64_t cur_cell_id=0;
+    uint64_t cur_cell_id = 0;
     for (auto& cell : raw_boundary_cells_)
     {
-      for (auto vid : cell->vertex_ids)
-        vertex_bndry_cell_subscriptions.at(vid).insert(cur_cell_id);
+      bndry_cell_hash_map[HashSortedVertexIDs(SortedCopy(cell->vertex_ids))]
+        .push_back(cur_cell_id);
       ++cur_cell_id;
     }
   }
 
-  // Process boundary cells
-  for (auto& cell : internal_cells_on_boundary)
-    for (auto& face : cell->faces)
-    {
-      if (face.has_neighbor) continue;
-      std::set<uint64_t> cfvids(face.vertex_ids.begin(),
-                                face.vertex_ids.end());
-
-      std::set<size_t> cells_to_search;
-      for (uint64_t vid : face.vertex_ids)
-        for (uint64_t cell_id : vertex_bndry_cell_subscriptions[vid])
-          cells_to_search.insert(cell_id);
-
-      for (uint64_t adj_cell_id : cells_to_search)
+  if (not bndry_cell_hash_map.empty())
+    thread_pool.ParallelFor(
+      num_raw_cells,
+      [&](size_t begin, size_t end, size_t)
       {
-        auto& adj_cell = raw_boundary_cells_[adj_cell_id];
+        for (size_t c = begin; c < end; ++c)
+          for (auto& face : raw_cells_[c]->faces)
+          {
+            if (face.has_neighbor) continue;
+            const auto cfvids = SortedCopy(face.vertex_ids);
 
-        std::set<uint64_t> afvids(adj_cell->vertex_ids.begin(),
-                                  adj_cell->vertex_ids.end());
+            const auto it =
+              bndry_cell_hash_map.find(HashSortedVertexIDs(cfvids));
+            if (it == bndry_cell_hash_map.end()) continue;
 
-        if (cfvids == afvids)
-        {
-          face.neighbor = adj_cell->material_id;
-          break;
-        }
-      }//for adj_cell_id
-    }//for face
+            for (uint64_t adj_cell_id : it->second)
+            {
+              const auto& adj_cell = raw_boundary_cells_[adj_cell_id];
+              if (SortedCopy(adj_cell->vertex_ids) == cfvids)
+              {
+                face.neighbor = adj_cell->material_id;
+                break;
+              }
+            }
+          } // for face
+      });
 
   num_bndry_faces = 0;
   for (auto cell : raw_cells_)
@@ -168,4 +310,4 @@ void chi_mesh::UnpartitionedMesh::BuildMeshConnectivity()
   Chi::log.Log() << Chi::program_timer.GetTimeString()
                 << " Done establishing cell connectivity.";
 
-}
\ No newline at end of file
+}
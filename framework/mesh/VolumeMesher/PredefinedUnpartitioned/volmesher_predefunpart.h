@@ -25,7 +25,7 @@ public:
   bool CellHasLocalScope(
     const chi_mesh::UnpartitionedMesh::LightWeightCell& lwcell,
     uint64_t cell_global_id,
-    const std::vector<std::set<uint64_t>>& vertex_subscriptions,
+    const UnpartitionedMesh::VertexCellSubscriptions& vertex_subscriptions,
     const std::vector<int64_t>& cell_partition_ids);
 
   static
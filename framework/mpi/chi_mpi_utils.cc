@@ -3,6 +3,62 @@
 namespace chi_mpi_utils
 {
 
+namespace
+{
+AllToAllAlgorithm map_all_to_all_algorithm_ = AllToAllAlgorithm::DENSE;
+/**Attribute key of the number of NBX exchanges done on a communicator.*/
+int nbx_exchange_count_keyval_ = MPI_KEYVAL_INVALID;
+/**Tags of NBX exchanges. Well below the guaranteed minimum of MPI_TAG_UB.*/
+constexpr int NBX_TAG_BASE = 32000;
+
+/**Frees the exchange count when its communicator is freed.*/
+int DeleteNBXExchangeCount(MPI_Comm, int, void* attribute_val, void*)
+{
+  delete static_cast<unsigned int*>(attribute_val);
+  return MPI_SUCCESS;
+}
+} // namespace
+
+/**Sets the algorithm used by MapAllToAll. All the processes must use the
+ * same algorithm.*/
+void SetMapAllToAllAlgorithm(AllToAllAlgorithm algorithm)
+{
+  map_all_to_all_algorithm_ = algorithm;
+}
+
+/**Returns the algorithm used by MapAllToAll.*/
+AllToAllAlgorithm GetMapAllToAllAlgorithm()
+{
+  return map_all_to_all_algorithm_;
+}
+
+/**Returns the message tag of the next NBX exchange on the given
+ * communicator. The exchange count is stored as an attribute of the
+ * communicator, rather than keyed by its handle, because a freed handle can
+ * be reused on some processes and not on others. Duplicated communicators
+ * start counting from zero.*/
+int MapAllToAllNBXTag(MPI_Comm communicator)
+{
+  if (nbx_exchange_count_keyval_ == MPI_KEYVAL_INVALID)
+    MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN,
+                           DeleteNBXExchangeCount,
+                           &nbx_exchange_count_keyval_,
+                           nullptr);
+
+  unsigned int* exchange_count = nullptr;
+  int found = 0;
+  MPI_Comm_get_attr(
+    communicator, nbx_exchange_count_keyval_, &exchange_count, &found);
+  if (not found)
+  {
+    exchange_count = new unsigned int(0);
+    MPI_Comm_set_attr(communicator, nbx_exchange_count_keyval_, exchange_count);
+  }
+
+  const unsigned int count = (*exchange_count)++;
+  return NBX_TAG_BASE + static_cast<int>(count % 2);
+}
+
 /**Returns the current rank on the specified communicator.*/
 int GetLocationID(MPI_Comm mpi_comm)
 {
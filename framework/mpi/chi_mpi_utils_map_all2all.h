@@ -2,6 +2,7 @@
 #define CHI_MPI_MAP_ALL2ALL_H
 
 #include <map>
+#include <set>
 #include <vector>
 
 #include <type_traits>
@@ -12,26 +13,45 @@
 namespace chi_mpi_utils
 {
 
-/**Given a map with keys indicating the destination process-ids and the
- * values for each key a list of values of type T (T must have an MPI_Datatype).
- * Returns a map with the keys indicating the source process-ids and the
- * values for each key a list of values of type T (sent by the respective
- * process).
- *
- * The keys must be "castable" to `int`.
- *
- * Also expects the MPI_Datatype of T.*/
+/**Algorithms available to MapAllToAll.*/
+enum class AllToAllAlgorithm
+{
+  /**`MPI_Alltoall` of the counts followed by `MPI_Alltoallv`.*/
+  DENSE = 0,
+  /**Sparse dynamic exchange with non-blocking consensus.*/
+  NBX = 1
+};
+
+/**Sets the algorithm used by MapAllToAll. All the processes must use the
+ * same algorithm.*/
+void SetMapAllToAllAlgorithm(AllToAllAlgorithm algorithm);
+/**Returns the algorithm used by MapAllToAll.*/
+AllToAllAlgorithm GetMapAllToAllAlgorithm();
+
+/**Returns the message tag of the next NBX exchange on the given
+ * communicator. The tag alternates between consecutive exchanges so that a
+ * process that already completed an exchange cannot have its messages of
+ * the next exchange matched by a process still completing the previous one.*/
+int MapAllToAllNBXTag(MPI_Comm communicator);
+
+//###################################################################
+/**Dense implementation of MapAllToAll. The counts are exchanged with
+ * `MPI_Alltoall` followed by the data with `MPI_Alltoallv`, hence every
+ * process allocates and communicates arrays the size of the communicator.*/
 template<typename K, class T> std::map<K, std::vector<T>>
-  MapAllToAll(const std::map<K, std::vector<T>>& pid_data_pairs,
+  MapAllToAllDense(const std::map<K, std::vector<T>>& pid_data_pairs,
               const MPI_Datatype data_mpi_type,
-              const MPI_Comm communicator=Chi::mpi.comm)
+              const MPI_Comm communicator)
 {
   static_assert(std::is_integral<K>::value, "Integral datatype required.");
 
+  int process_count;
+  MPI_Comm_size(communicator, &process_count);
+
   //============================================= Make sendcounts and
   //                                              senddispls
-  std::vector<int> sendcounts(Chi::mpi.process_count, 0);
-  std::vector<int> senddispls(Chi::mpi.process_count, 0);
+  std::vector<int> sendcounts(process_count, 0);
+  std::vector<int> senddispls(process_count, 0);
   {
     size_t accumulated_displ = 0;
     for (const auto& [pid, data] : pid_data_pairs)
@@ -44,7 +64,7 @@ template<typename K, class T> std::map<K, std::vector<T>>
 
   //============================================= Communicate sendcounts to
   //                                              get recvcounts
-  std::vector<int> recvcounts(Chi::mpi.process_count, 0);
+  std::vector<int> recvcounts(process_count, 0);
 
   MPI_Alltoall(sendcounts.data(), //sendbuf
                1, MPI_INT,        //sendcount, sendtype
@@ -57,12 +77,12 @@ template<typename K, class T> std::map<K, std::vector<T>>
   //                                              total_recv_count
   // All three these quantities are constructed
   // from recvcounts.
-  std::vector<int>   recvdispls(Chi::mpi.process_count, 0);
+  std::vector<int>   recvdispls(process_count, 0);
   std::set<K>        sender_pids_set; //set of neighbor-partitions sending data
   size_t total_recv_count;
   {
     int displacement=0;
-    for (int pid=0; pid < Chi::mpi.process_count; ++pid)
+    for (int pid=0; pid < process_count; ++pid)
     {
       recvdispls[pid] = displacement;
       displacement += recvcounts[pid];
@@ -114,6 +134,113 @@ template<typename K, class T> std::map<K, std::vector<T>>
   return output_data;
 }
 
+//###################################################################
+/**Sparse implementation of MapAllToAll using the non-blocking consensus
+ * algorithm (NBX) of Hoefler et al. Each message is sent with a synchronous
+ * send and received as it is probed. A process enters a non-blocking barrier
+ * once all its sends have been matched and the exchange is complete when the
+ * barrier completes. Memory and the number of messages only depend on the
+ * number of processes actually communicating.*/
+template<typename K, class T> std::map<K, std::vector<T>>
+  MapAllToAllNBX(const std::map<K, std::vector<T>>& pid_data_pairs,
+                 const MPI_Datatype data_mpi_type,
+                 const MPI_Comm communicator)
+{
+  static_assert(std::is_integral<K>::value, "Integral datatype required.");
+
+  const int tag = MapAllToAllNBXTag(communicator);
+
+  //============================================= Post synchronous sends
+  // Empty lists are not sent, consistent with the dense version that does
+  // not report processes that sent nothing.
+  std::vector<MPI_Request> send_requests;
+  send_requests.reserve(pid_data_pairs.size());
+  for (const auto& [pid, data] : pid_data_pairs)
+  {
+    if (data.empty()) continue;
+
+    send_requests.emplace_back();
+    MPI_Issend(data.data(),                   //buf
+               static_cast<int>(data.size()), //count
+               data_mpi_type,                 //datatype
+               static_cast<int>(pid),         //dest
+               tag,                           //tag
+               communicator,                  //comm
+               &send_requests.back());        //request
+  }
+
+  //============================================= Receive until consensus
+  std::map<K, std::vector<T>> output_data;
+  MPI_Request barrier_request = MPI_REQUEST_NULL;
+  bool barrier_active = false;
+  int done = 0;
+  while (not done)
+  {
+    int message_available = 0;
+    MPI_Status status;
+    MPI_Iprobe(MPI_ANY_SOURCE, tag, communicator, &message_available, &status);
+
+    if (message_available)
+    {
+      int data_count = 0;
+      MPI_Get_count(&status, data_mpi_type, &data_count);
+
+      auto& data = output_data[static_cast<K>(status.MPI_SOURCE)];
+      data.resize(data_count);
+
+      MPI_Recv(data.data(),         //buf
+               data_count,          //count
+               data_mpi_type,       //datatype
+               status.MPI_SOURCE,   //source
+               tag,                 //tag
+               communicator,        //comm
+               MPI_STATUS_IGNORE);  //status
+    }
+
+    if (barrier_active)
+      MPI_Test(&barrier_request, &done, MPI_STATUS_IGNORE);
+    else
+    {
+      int all_sent = 0;
+      MPI_Testall(static_cast<int>(send_requests.size()),
+                  send_requests.data(),
+                  &all_sent,
+                  MPI_STATUSES_IGNORE);
+      if (all_sent)
+      {
+        MPI_Ibarrier(communicator, &barrier_request);
+        barrier_active = true;
+      }
+    }
+  }//while not done
+
+  return output_data;
+}
+
+//###################################################################
+/**Given a map with keys indicating the destination process-ids and the
+ * values for each key a list of values of type T (T must have an MPI_Datatype).
+ * Returns a map with the keys indicating the source process-ids and the
+ * values for each key a list of values of type T (sent by the respective
+ * process).
+ *
+ * The keys must be "castable" to `int`.
+ *
+ * Also expects the MPI_Datatype of T.
+ *
+ * The exchange is done with the algorithm selected with
+ * SetMapAllToAllAlgorithm, i.e., MapAllToAllDense or MapAllToAllNBX.*/
+template<typename K, class T> std::map<K, std::vector<T>>
+  MapAllToAll(const std::map<K, std::vector<T>>& pid_data_pairs,
+              const MPI_Datatype data_mpi_type,
+              const MPI_Comm communicator=Chi::mpi.comm)
+{
+  if (GetMapAllToAllAlgorithm() == AllToAllAlgorithm::NBX)
+    return MapAllToAllNBX(pid_data_pairs, data_mpi_type, communicator);
+
+  return MapAllToAllDense(pid_data_pairs, data_mpi_type, communicator);
+}
+
 }//namespace chi_mpi_utils
 
 #endif//CHI_MPI_MAP_ALL2ALL_H
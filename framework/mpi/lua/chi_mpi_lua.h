@@ -8,6 +8,7 @@ namespace chi_mpi_utils
 {
 
 int chiMPIBarrier(lua_State *L);
+int chiMPISetMapAllToAllAlgorithm(lua_State *L);
 
 }//namespace chi_mesh
 
@@ -0,0 +1,46 @@
+#include "chi_lua.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi_lua.h"
+#include "mpi/chi_mpi_utils.h"
+#include "console/chi_console.h"
+
+namespace chi_mpi_utils
+{
+
+RegisterLuaFunctionAsIs(chiMPISetMapAllToAllAlgorithm);
+
+// #############################################################################
+/** Sets the algorithm used for the all-to-all exchanges of variable sized
+lists, e.g., during mesh setup and the construction of ghost communicators.
+Must be called by all processes with the same algorithm.
+
+\param algorithm string Required. Either `"DENSE"` (default), which exchanges
+                        the counts of all the processes with MPI_Alltoall, or
+                        `"NBX"`, a sparse exchange using non-blocking
+                        consensus whose cost only depends on the number of
+                        processes that communicate.
+
+\ingroup chiMPI*/
+int chiMPISetMapAllToAllAlgorithm(lua_State* L)
+{
+  const std::string fname = __FUNCTION__;
+  const int num_args = lua_gettop(L);
+  if (num_args != 1) LuaPostArgAmountError(fname, 1, num_args);
+
+  LuaCheckStringValue(fname, L, 1);
+  const std::string algorithm = lua_tostring(L, 1);
+
+  if (algorithm == "DENSE")
+    SetMapAllToAllAlgorithm(AllToAllAlgorithm::DENSE);
+  else if (algorithm == "NBX")
+    SetMapAllToAllAlgorithm(AllToAllAlgorithm::NBX);
+  else
+    ChiInvalidArgument("Unknown algorithm \"" + algorithm +
+                       "\". Must be \"DENSE\" or \"NBX\".");
+
+  return 0;
+}
+
+} // namespace chi_mpi_utils
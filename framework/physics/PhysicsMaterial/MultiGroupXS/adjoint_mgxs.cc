@@ -33,4 +33,6 @@ AdjointMGXS(const MultiGroupXS& xs) : xs_(xs)
       transposed_production_matrices_.push_back(F_g_transpose);
     }
   }
+
+  UpdateFlatStorage();
 }
@@ -78,7 +78,7 @@ public:
   const chi_math::SparseMatrix& TransferMatrix(unsigned int ell) const override
   { return transposed_transfer_matrices_.at(ell); }
 
-  const std::vector<std::vector<double>> ProductionMatrix() const override
+  const std::vector<std::vector<double>>& ProductionMatrix() const override
   { return transposed_production_matrices_; }
 
   const std::vector<Precursor>& Precursors() const override
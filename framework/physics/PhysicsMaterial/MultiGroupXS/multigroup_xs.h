@@ -22,6 +22,19 @@ public:
     std::vector<double> emission_spectrum;
   };
 
+  /**
+   * A transfer matrix in compressed sparse row format. The entries of row
+   * `g`, i.e., the transfers into group `g`, are stored contiguously in
+   * `column_indices` and `values` from `row_offsets[g]` up to
+   * `row_offsets[g+1]`.
+   */
+  struct FlatTransferMatrix
+  {
+    std::vector<size_t> row_offsets;
+    std::vector<unsigned int> column_indices;
+    std::vector<double> values;
+  };
+
   MultiGroupXS()
       : MaterialProperty(PropertyType::TRANSPORT_XSECTIONS)
   {}
@@ -62,7 +75,8 @@ public:
   virtual const chi_math::SparseMatrix&
   TransferMatrix(unsigned int ell) const = 0;
 
-  virtual const std::vector <std::vector<double>> ProductionMatrix() const = 0;
+  virtual const std::vector <std::vector<double>>&
+  ProductionMatrix() const = 0;
 
   virtual const std::vector <Precursor>& Precursors() const = 0;
 
@@ -73,6 +87,26 @@ public:
   virtual const std::vector<double>& SigmaRemoval() const = 0;
 
   virtual const std::vector<double>& SigmaSGtoG() const = 0;
+
+  /**Returns the transfer matrices, one per Legendre order, in compressed
+   * sparse row format.*/
+  const std::vector<FlatTransferMatrix>& FlatTransferMatrices() const
+  { return flat_transfer_matrices_; }
+
+  /**Returns the production matrix stored contiguously in row-major order,
+   * i.e., entry `[g][gp]` is at `g*NumGroups() + gp`. Empty when the
+   * material is not fissionable.*/
+  const std::vector<double>& FlatProductionMatrix() const
+  { return flat_production_matrix_; }
+
+protected:
+  /**Rebuilds the flat storage from TransferMatrices() and ProductionMatrix().
+   * Derived classes must call this whenever these change.*/
+  void UpdateFlatStorage();
+
+private:
+  std::vector<FlatTransferMatrix> flat_transfer_matrices_;
+  std::vector<double> flat_production_matrix_;
 };
 
 }//namespace chi_physics
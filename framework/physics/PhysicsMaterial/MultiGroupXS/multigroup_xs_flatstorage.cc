@@ -0,0 +1,41 @@
+#include "multigroup_xs.h"
+
+//###################################################################
+/**Builds the compressed sparse row transfer matrices and the contiguous
+ * production matrix.*/
+void chi_physics::MultiGroupXS::UpdateFlatStorage()
+{
+  const size_t num_groups = NumGroups();
+
+  flat_transfer_matrices_.clear();
+  flat_transfer_matrices_.reserve(TransferMatrices().size());
+  for (const auto& S_ell : TransferMatrices())
+  {
+    FlatTransferMatrix flat_S_ell;
+    auto& row_offsets = flat_S_ell.row_offsets;
+    row_offsets.reserve(num_groups + 1);
+    row_offsets.push_back(0);
+    for (size_t g = 0; g < num_groups; ++g)
+    {
+      const auto& cols = S_ell.rowI_indices_[g];
+      const auto& vals = S_ell.rowI_values_[g];
+      for (size_t t = 0; t < cols.size(); ++t)
+      {
+        flat_S_ell.column_indices.push_back(static_cast<unsigned int>(cols[t]));
+        flat_S_ell.values.push_back(vals[t]);
+      }
+      row_offsets.push_back(flat_S_ell.values.size());
+    }
+    flat_transfer_matrices_.push_back(std::move(flat_S_ell));
+  }
+
+  flat_production_matrix_.clear();
+  const auto& F = ProductionMatrix();
+  if (IsFissionable() and not F.empty())
+  {
+    flat_production_matrix_.reserve(num_groups * num_groups);
+    for (size_t g = 0; g < num_groups; ++g)
+      flat_production_matrix_.insert(
+        flat_production_matrix_.end(), F[g].begin(), F[g].end());
+  }
+}
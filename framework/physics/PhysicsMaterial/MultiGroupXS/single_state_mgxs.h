@@ -116,7 +116,7 @@ public:
   const chi_math::SparseMatrix& TransferMatrix(unsigned int ell) const override
   { return transfer_matrices_.at(ell); }
 
-  const std::vector<std::vector<double>> ProductionMatrix() const override
+  const std::vector<std::vector<double>>& ProductionMatrix() const override
   { return production_matrix_; }
 
   const std::vector<Precursor>& Precursors() const override
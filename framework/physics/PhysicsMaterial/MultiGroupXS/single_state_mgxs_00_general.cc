@@ -54,6 +54,7 @@ MakeSimple0(unsigned int num_groups, double sigma_t)
   sigma_a_.resize(num_groups, sigma_t);
 
   ComputeDiffusionParameters();
+  UpdateFlatStorage();
 }
 
 
@@ -112,6 +113,7 @@ MakeSimple1(unsigned int num_groups, double sigma_t, double c)
 
   ComputeAbsorption();
   ComputeDiffusionParameters();
+  UpdateFlatStorage();
 }
 
 
@@ -333,4 +335,5 @@ MakeCombined(std::vector<std::pair<int, double> > &combinations)
   }//for cross sections
 
   ComputeDiffusionParameters();
+  UpdateFlatStorage();
 }
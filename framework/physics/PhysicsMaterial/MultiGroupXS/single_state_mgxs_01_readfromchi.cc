@@ -872,4 +872,6 @@ void chi_physics::SingleStateMGXS::
     ChiLogicalErrorIf(sigma_f_.empty(), "After reading xs, a fissionable "
                                         "material's sigma_f is not defined");
   }//if fissionable
+
+  UpdateFlatStorage();
 }
@@ -0,0 +1,88 @@
+#include "chi_thread_pool.h"
+
+#include "chi_utils.h"
+
+#include <algorithm>
+
+namespace chi
+{
+
+ThreadPool::ThreadPool(size_t num_threads)
+{
+  const size_t num_workers = std::max<size_t>(num_threads, 1);
+  workers_.reserve(num_workers);
+  for (size_t t = 0; t < num_workers; ++t)
+    workers_.emplace_back([this]() { WorkerLoop(); });
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  condition_.notify_all();
+  for (auto& worker : workers_)
+    worker.join();
+}
+
+std::future<void> ThreadPool::Enqueue(std::function<void()> task)
+{
+  std::packaged_task<void()> packaged_task(std::move(task));
+  auto future = packaged_task.get_future();
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    tasks_.push(std::move(packaged_task));
+  }
+  condition_.notify_one();
+
+  return future;
+}
+
+void ThreadPool::ParallelFor(
+  size_t num_items,
+  const std::function<void(size_t, size_t, size_t)>& function)
+{
+  if (num_items == 0) return;
+
+  const size_t num_chunks = std::min(num_items, NumThreads());
+  if (num_chunks == 1)
+  {
+    function(0, num_items, 0);
+    return;
+  }
+
+  const auto chunks = MakeSubSets(num_items, num_chunks);
+
+  std::vector<std::future<void>> futures;
+  futures.reserve(num_chunks);
+  for (size_t c = 0; c < num_chunks; ++c)
+  {
+    const size_t begin = chunks[c].ss_begin;
+    const size_t end = chunks[c].ss_end + 1;
+    futures.push_back(
+      Enqueue([&function, begin, end, c]() { function(begin, end, c); }));
+  }
+
+  for (auto& future : futures)
+    future.get();
+}
+
+void ThreadPool::WorkerLoop()
+{
+  while (true)
+  {
+    std::packaged_task<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this]() { return stopping_ or not tasks_.empty(); });
+      if (stopping_ and tasks_.empty()) return;
+
+      task = std::move(tasks_.front());
+      tasks_.pop();
+    }
+    task();
+  }
+}
+
+} // namespace chi
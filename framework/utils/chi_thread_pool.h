@@ -0,0 +1,68 @@
+#ifndef CHITECH_CHI_THREAD_POOL_H
+#define CHITECH_CHI_THREAD_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace chi
+{
+
+/**Fixed-size pool of worker threads executing queued tasks.
+ *
+ * Tasks are executed in the order in which they are enqueued. The pool does
+ * not call MPI itself and tasks submitted to it should not either, i.e.,
+ * all communication remains on the thread that owns the pool. This means
+ * ChiTech only needs `MPI_THREAD_FUNNELED` support from the MPI library.
+ *
+ * \code
+ * chi::ThreadPool pool(4);
+ * auto future = pool.Enqueue([]() { DoSomething(); });
+ * future.get(); // Waits and rethrows any exception thrown by the task
+ * \endcode*/
+class ThreadPool
+{
+public:
+  /**Creates the pool with the given number of threads. A value of zero
+   * is treated as one.*/
+  explicit ThreadPool(size_t num_threads);
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  /**Waits for all queued tasks to finish and joins the threads.*/
+  ~ThreadPool();
+
+  /**Returns the number of worker threads.*/
+  size_t NumThreads() const { return workers_.size(); }
+
+  /**Queues a task for execution. The returned future becomes ready when the
+   * task has completed and rethrows, on `get()`, any exception the task
+   * threw.*/
+  std::future<void> Enqueue(std::function<void()> task);
+
+  /**Splits the range [0,num_items) into at most `NumThreads()` contiguous
+   * chunks and calls `function(begin, end, chunk_id)` for each chunk on the
+   * pool. Blocks until all chunks have completed. This must not be called
+   * from within a task executing on the same pool.*/
+  void ParallelFor(
+    size_t num_items,
+    const std::function<void(size_t begin, size_t end, size_t chunk_id)>&
+      function);
+
+private:
+  void WorkerLoop();
+
+  std::vector<std::thread> workers_;
+  std::queue<std::packaged_task<void()>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool stopping_ = false;
+};
+
+} // namespace chi
+
+#endif // CHITECH_CHI_THREAD_POOL_H
@@ -43,9 +43,19 @@ DiffusionSolver::~DiffusionSolver()
 {
   MatDestroy(&A_);
   VecDestroy(&rhs_);
+  VecDestroy(&rhs_operators_.fixed_rhs_);
   KSPDestroy(&ksp_);
 }
 
+// ###################################################################
+/**Creates the shell matrix used when `options.matrix_free` is set. Not
+ * supported by default.*/
+Mat DiffusionSolver::CreateMatrixFreeOperator()
+{
+  ChiLogicalError(text_name_ + ": Matrix-free operators are not supported "
+                               "by this diffusion solver.");
+}
+
 // ###################################################################
 /**Returns the assigned text name.*/
 std::string DiffusionSolver::TextName() const { return text_name_; }
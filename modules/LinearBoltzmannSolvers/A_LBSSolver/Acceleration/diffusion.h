@@ -54,6 +54,26 @@ protected:
 
   const bool requires_ghosts_;
 
+  /**Cell-local operators of the right-hand side. The right-hand side is
+   * linear in the source moments, i.e., b = B q + b_fixed, where B is
+   * made of one block per cell (the same for every group) and b_fixed
+   * contains the contributions of the boundary conditions.*/
+  struct RHSOperators
+  {
+    std::vector<size_t> cell_num_nodes_;
+    /**Offsets of the cells into the dof lists, ordered [cell][group][node].*/
+    std::vector<size_t> cell_dof_offsets_;
+    std::vector<int64_t> local_dofs_;
+    std::vector<PetscInt> global_dofs_;
+    /**Offsets of the cells into the row-major blocks.*/
+    std::vector<size_t> cell_block_offsets_;
+    std::vector<double> blocks_;
+
+    Vec fixed_rhs_ = nullptr;
+  };
+
+  RHSOperators rhs_operators_;
+
 public:
   struct Options
   {
@@ -66,6 +86,9 @@ public:
     std::string ref_solution_lua_function; ///< for mms
     std::string additional_options_string;
     double penalty_factor = 4.0;
+    /**Applies the operator from cached cell matrices instead of assembling
+     * it, see CreateMatrixFreeOperator.*/
+    bool matrix_free = false;
   } options;
 
 public:
@@ -96,6 +119,25 @@ public:
   virtual void Assemble_b(Vec petsc_q_vector) = 0;
   void AddToRHS(const std::vector<double>& values);
 
+protected:
+  /**Creates the shell matrix used when `options.matrix_free` is set. Not
+   * supported by default.*/
+  virtual Mat CreateMatrixFreeOperator();
+
+  /**Builds the right-hand side operators with calls to
+   * AddCellRHSOperator for every local cell.*/
+  virtual void BuildRHSOperators() = 0;
+
+  //02
+  void InitializeRHSOperators();
+  void AddCellRHSOperator(const chi_mesh::Cell& cell,
+                          const std::vector<double>& block,
+                          const std::vector<double>& fixed_values);
+  void FinalizeRHSOperators();
+  void AssembleRHS(const double* q_vector);
+
+public:
+
   void Solve(std::vector<double>& solution, bool use_initial_guess=false);
   void Solve(Vec petsc_solution, bool use_initial_guess=false);
 };
@@ -10,7 +10,9 @@
 
 // ###################################################################
 /**Initializes the diffusion solver. This involves creating the
- * sparse matrix with the appropriate sparsity pattern. Creating the
+ * sparse matrix with the appropriate sparsity pattern, or the shell matrix
+ * when `options.matrix_free` is set (which uses Jacobi preconditioning
+ * instead of BoomerAMG). Creating the
  * RHS vector. Creating the KSP solver. Setting the very specialized parameters
  * for Hypre's BooomerAMG. Note: `PCSetFromOptions` and
  * `KSPSetFromOptions` are called at the end. Therefore, any number of
@@ -24,23 +26,28 @@ void lbs::acceleration::DiffusionSolver::Initialize()
     Chi::log.Log() << text_name_
                    << ": Global number of DOFs=" << num_global_dofs_;
 
-  Chi::mpi.Barrier();
-  Chi::log.Log() << "Sparsity pattern";
-  Chi::mpi.Barrier();
   //============================================= Create Matrix
-  std::vector<int64_t> nodal_nnz_in_diag;
-  std::vector<int64_t> nodal_nnz_off_diag;
-  sdm_.BuildSparsityPattern(nodal_nnz_in_diag, nodal_nnz_off_diag, uk_man_);
-  Chi::mpi.Barrier();
-  Chi::log.Log() << "Done Sparsity pattern";
-  Chi::mpi.Barrier();
-  A_ =
-    chi_math::PETScUtils::CreateSquareMatrix(num_local_dofs_, num_global_dofs_);
-  chi_math::PETScUtils::InitMatrixSparsity(
-    A_, nodal_nnz_in_diag, nodal_nnz_off_diag);
-  Chi::mpi.Barrier();
-  Chi::log.Log() << "Done matrix creation";
-  Chi::mpi.Barrier();
+  if (options.matrix_free)
+    A_ = CreateMatrixFreeOperator();
+  else
+  {
+    Chi::mpi.Barrier();
+    Chi::log.Log() << "Sparsity pattern";
+    Chi::mpi.Barrier();
+    std::vector<int64_t> nodal_nnz_in_diag;
+    std::vector<int64_t> nodal_nnz_off_diag;
+    sdm_.BuildSparsityPattern(nodal_nnz_in_diag, nodal_nnz_off_diag, uk_man_);
+    Chi::mpi.Barrier();
+    Chi::log.Log() << "Done Sparsity pattern";
+    Chi::mpi.Barrier();
+    A_ = chi_math::PETScUtils::CreateSquareMatrix(num_local_dofs_,
+                                                  num_global_dofs_);
+    chi_math::PETScUtils::InitMatrixSparsity(
+      A_, nodal_nnz_in_diag, nodal_nnz_off_diag);
+    Chi::mpi.Barrier();
+    Chi::log.Log() << "Done matrix creation";
+    Chi::mpi.Barrier();
+  }
 
   //============================================= Create RHS
   if (not requires_ghosts_)
@@ -68,6 +75,20 @@ void lbs::acceleration::DiffusionSolver::Initialize()
   //============================================= Set Pre-conditioner
   PC pc;
   KSPGetPC(ksp_, &pc);
+
+  // Without an assembled matrix only the diagonal is available
+  if (options.matrix_free)
+  {
+    PCSetType(pc, PCJACOBI);
+
+    PetscOptionsInsertString(nullptr,
+                             options.additional_options_string.c_str());
+
+    PCSetFromOptions(pc);
+    KSPSetFromOptions(ksp_);
+    return;
+  }
+
   //  PCSetType(pc, PCGAMG);
   PCSetType(pc, PCHYPRE);
 
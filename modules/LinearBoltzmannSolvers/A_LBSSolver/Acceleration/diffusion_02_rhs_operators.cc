@@ -0,0 +1,163 @@
+#include "diffusion.h"
+
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+#include "math/SpatialDiscretization/SpatialDiscretization.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "utils/chi_timer.h"
+
+namespace lbs::acceleration
+{
+
+// ###################################################################
+/**Clears the right-hand side operators and creates the vector of fixed
+ * contributions.*/
+void DiffusionSolver::InitializeRHSOperators()
+{
+  ChiLogicalErrorIf(rhs_ == nullptr,
+                    "Check that Initialize has been called.");
+
+  VecDestroy(&rhs_operators_.fixed_rhs_);
+  rhs_operators_ = RHSOperators();
+
+  const size_t num_local_cells = grid_.local_cells.size();
+  rhs_operators_.cell_num_nodes_.reserve(num_local_cells);
+  rhs_operators_.cell_dof_offsets_.reserve(num_local_cells + 1);
+  rhs_operators_.cell_block_offsets_.reserve(num_local_cells + 1);
+  rhs_operators_.cell_dof_offsets_.push_back(0);
+  rhs_operators_.cell_block_offsets_.push_back(0);
+
+  VecDuplicate(rhs_, &rhs_operators_.fixed_rhs_);
+  VecSet(rhs_operators_.fixed_rhs_, 0.0);
+}
+
+// ###################################################################
+/**Adds the operators of a cell. Must be called for the local cells in
+ * order.
+ *
+ * \param cell The cell.
+ * \param block Row-major num_nodes x num_nodes block mapping the nodal
+ *              source of a group to the rows of that group.
+ * \param fixed_values Source independent contributions to the rows of the
+ *                     cell, ordered [group][node].*/
+void DiffusionSolver::AddCellRHSOperator(
+  const chi_mesh::Cell& cell,
+  const std::vector<double>& block,
+  const std::vector<double>& fixed_values)
+{
+  const size_t num_groups = uk_man_.unknowns_.front().num_components_;
+  const size_t num_nodes = sdm_.GetCellMapping(cell).NumNodes();
+
+  ChiLogicalErrorIf(cell.local_id_ != rhs_operators_.cell_num_nodes_.size(),
+                    "Cells must be added in order.");
+  ChiLogicalErrorIf(block.size() != num_nodes * num_nodes or
+                      fixed_values.size() != num_groups * num_nodes,
+                    "Block or fixed values of the wrong size.");
+
+  auto& ops = rhs_operators_;
+  ops.cell_num_nodes_.push_back(num_nodes);
+
+  const size_t dof_offset = ops.local_dofs_.size();
+  for (size_t g = 0; g < num_groups; ++g)
+    for (size_t i = 0; i < num_nodes; ++i)
+    {
+      ops.local_dofs_.push_back(sdm_.MapDOFLocal(cell, i, uk_man_, 0, g));
+      ops.global_dofs_.push_back(sdm_.MapDOF(cell, i, uk_man_, 0, g));
+    }
+  ops.cell_dof_offsets_.push_back(ops.local_dofs_.size());
+
+  ops.blocks_.insert(ops.blocks_.end(), block.begin(), block.end());
+  ops.cell_block_offsets_.push_back(ops.blocks_.size());
+
+  bool has_fixed_values = false;
+  for (const double value : fixed_values)
+    if (value != 0.0) has_fixed_values = true;
+
+  if (has_fixed_values)
+    VecSetValues(ops.fixed_rhs_,
+                 static_cast<PetscInt>(fixed_values.size()),
+                 &ops.global_dofs_[dof_offset],
+                 fixed_values.data(),
+                 ADD_VALUES);
+}
+
+// ###################################################################
+/**Completes the construction of the right-hand side operators.*/
+void DiffusionSolver::FinalizeRHSOperators()
+{
+  ChiLogicalErrorIf(
+    rhs_operators_.cell_num_nodes_.size() != grid_.local_cells.size(),
+    "Not all the local cells have right-hand side operators.");
+
+  VecAssemblyBegin(rhs_operators_.fixed_rhs_);
+  VecAssemblyEnd(rhs_operators_.fixed_rhs_);
+}
+
+// ###################################################################
+/**Assembles the right-hand side from the cached cell operators, i.e., the
+ * fixed contributions plus the product of every cell's block with the
+ * cell's nodal source of each group. The rows of a cell are inserted with
+ * a single call.
+ *
+ * \param q_vector Local source moments, indexed with MapDOFLocal.*/
+void DiffusionSolver::AssembleRHS(const double* q_vector)
+{
+  ChiLogicalErrorIf(rhs_operators_.fixed_rhs_ == nullptr,
+                    "Right-hand side operators have not been built.");
+
+  if (options.verbose)
+    Chi::log.Log() << Chi::program_timer.GetTimeString()
+                   << " Starting assembly";
+
+  auto& t_assemble =
+    Chi::log.CreateOrGetTimingBlock("DiffusionSolver::Assemble_b");
+  t_assemble.TimeSectionBegin();
+
+  const auto& ops = rhs_operators_;
+  const size_t num_groups = uk_man_.unknowns_.front().num_components_;
+
+  VecCopy(ops.fixed_rhs_, rhs_);
+
+  std::vector<double> cell_rhs;
+  const size_t num_local_cells = ops.cell_num_nodes_.size();
+  for (size_t c = 0; c < num_local_cells; ++c)
+  {
+    const size_t num_nodes = ops.cell_num_nodes_[c];
+    const size_t dof_offset = ops.cell_dof_offsets_[c];
+    const double* block = &ops.blocks_[ops.cell_block_offsets_[c]];
+    const int64_t* local_dofs = &ops.local_dofs_[dof_offset];
+
+    cell_rhs.assign(num_groups * num_nodes, 0.0);
+    for (size_t g = 0; g < num_groups; ++g)
+    {
+      const int64_t* g_local_dofs = &local_dofs[g * num_nodes];
+      double* g_rhs = &cell_rhs[g * num_nodes];
+      for (size_t i = 0; i < num_nodes; ++i)
+      {
+        const double* block_row = &block[i * num_nodes];
+        double entry_rhs_i = 0.0;
+        for (size_t j = 0; j < num_nodes; ++j)
+          entry_rhs_i += block_row[j] * q_vector[g_local_dofs[j]];
+        g_rhs[i] = entry_rhs_i;
+      }
+    } // for g
+
+    VecSetValues(rhs_,
+                 static_cast<PetscInt>(cell_rhs.size()),
+                 &ops.global_dofs_[dof_offset],
+                 cell_rhs.data(),
+                 ADD_VALUES);
+  } // for cell
+
+  VecAssemblyBegin(rhs_);
+  VecAssemblyEnd(rhs_);
+
+  if (options.verbose)
+    Chi::log.Log() << Chi::program_timer.GetTimeString()
+                   << " Assembly completed";
+
+  t_assemble.TimeSectionEnd();
+}
+
+} // namespace lbs::acceleration
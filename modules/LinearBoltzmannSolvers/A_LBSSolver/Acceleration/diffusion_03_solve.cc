@@ -18,6 +18,9 @@ void lbs::acceleration::DiffusionSolver::Solve(
   std::vector<double>& solution, bool use_initial_guess /*=false*/)
 {
   const std::string fname = "lbs::acceleration::DiffusionMIPSolver::Solve";
+  auto& t_solve = Chi::log.CreateOrGetTimingBlock("DiffusionSolver::Solve");
+  t_solve.TimeSectionBegin();
+
   Vec x;
   VecDuplicate(rhs_, &x);
   VecSet(x, 0.0);
@@ -32,7 +35,7 @@ void lbs::acceleration::DiffusionSolver::Solve(
                    1.0e50,
                    options.max_iters);
 
-  if (options.perform_symmetry_check)
+  if (options.perform_symmetry_check and not options.matrix_free)
   {
     PetscBool symmetry = PETSC_FALSE;
     MatIsSymmetric(A_, 1.0e-6, &symmetry);
@@ -93,6 +96,8 @@ void lbs::acceleration::DiffusionSolver::Solve(
 
   //============================================= Cleanup x
   VecDestroy(&x);
+
+  t_solve.TimeSectionEnd();
 }
 
 // ###################################################################
@@ -105,6 +110,9 @@ void lbs::acceleration::DiffusionSolver::Solve(
   Vec petsc_solution, bool use_initial_guess /*=false*/)
 {
   const std::string fname = "lbs::acceleration::DiffusionMIPSolver::Solve";
+  auto& t_solve = Chi::log.CreateOrGetTimingBlock("DiffusionSolver::Solve");
+  t_solve.TimeSectionBegin();
+
   Vec x;
   VecDuplicate(rhs_, &x);
   VecSet(x, 0.0);
@@ -119,7 +127,7 @@ void lbs::acceleration::DiffusionSolver::Solve(
                    1.0e50,
                    options.max_iters);
 
-  if (options.perform_symmetry_check)
+  if (options.perform_symmetry_check and not options.matrix_free)
   {
     PetscBool symmetry = PETSC_FALSE;
     MatIsSymmetric(A_, 1.0e-6, &symmetry);
@@ -166,4 +174,6 @@ void lbs::acceleration::DiffusionSolver::Solve(
 
   //============================================= Cleanup x
   VecDestroy(&x);
+
+  t_solve.TimeSectionEnd();
 }
\ No newline at end of file
@@ -22,6 +22,10 @@ public:
   //02d
   void Assemble_b(const std::vector<double>& q_vector) override;
   void Assemble_b(Vec petsc_q_vector) override;
+
+protected:
+  //02d
+  void BuildRHSOperators() override;
 };
 
 } // namespace lbs::acceleration
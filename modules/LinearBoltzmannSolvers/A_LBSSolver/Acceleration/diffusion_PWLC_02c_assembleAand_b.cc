@@ -19,7 +19,9 @@ namespace lbs::acceleration
 {
 // ###################################################################
 /**Assembles both the matrix and the RHS using unit cell-matrices. These are
- * the routines used in the production versions.*/
+ * the routines used in the production versions. The entries of a cell are
+ * inserted per block and the right-hand side operators are built here once
+ * so that Assemble_b only has to apply them.*/
 void DiffusionPWLCSolver::AssembleAand_b(const std::vector<double>& q_vector)
 {
   const size_t num_local_dofs = sdm_.GetNumLocalAndGhostDOFs(uk_man_);
@@ -37,26 +39,30 @@ void DiffusionPWLCSolver::AssembleAand_b(const std::vector<double>& q_vector)
     Chi::log.Log() << Chi::program_timer.GetTimeString()
                    << " Starting assembly";
 
+  auto& t_assemble =
+    Chi::log.CreateOrGetTimingBlock("DiffusionSolver::AssembleAand_b");
+  t_assemble.TimeSectionBegin();
+
   const size_t num_groups = uk_man_.unknowns_.front().num_components_;
 
-  VecSet(rhs_, 0.0);
+  // The cell blocks contain zeros for the couplings with Dirichlet nodes,
+  // these must not become entries of the matrix.
+  MatSetOption(A_, MAT_IGNORE_ZERO_ENTRIES, PETSC_TRUE);
+
   for (const auto& cell : grid_.local_cells)
   {
     const size_t num_faces = cell.faces_.size();
     const auto& cell_mapping = sdm_.GetCellMapping(cell);
     const size_t num_nodes = cell_mapping.NumNodes();
-    const auto cc_nodes = cell_mapping.GetNodeLocations();
     const auto& unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
 
     const auto& cell_K_matrix = unit_cell_matrices.K_matrix;
     const auto& cell_M_matrix = unit_cell_matrices.M_matrix;
-    const auto& cell_Vi = unit_cell_matrices.Vi_vectors;
 
     const auto& xs = mat_id_2_xs_map_.at(cell.material_id_);
 
     //=========================================== Mark dirichlet nodes
-    typedef std::pair<bool, double> DirichFlagVal;
-    std::vector<DirichFlagVal> node_is_dirichlet(num_nodes, {false, 0.0});
+    std::vector<bool> node_is_dirichlet(num_nodes, false);
     for (size_t f = 0; f < num_faces; ++f)
     {
       const auto& face = cell.faces_[f];
@@ -69,47 +75,35 @@ void DiffusionPWLCSolver::AssembleAand_b(const std::vector<double>& q_vector)
 
         const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
         for (size_t fi = 0; fi < num_face_nodes; ++fi)
-          node_is_dirichlet[cell_mapping.MapFaceNode(f, fi)] = {true,
-                                                                bc.values[0]};
+          node_is_dirichlet[cell_mapping.MapFaceNode(f, fi)] = true;
       }
     }
 
     for (size_t g = 0; g < num_groups; ++g)
     {
-      //==================================== Get coefficient and nodal src
+      //==================================== Get coefficient and dof maps
       const double Dg = xs.Dg[g];
       const double sigr_g = xs.sigR[g];
 
-      std::vector<double> qg(num_nodes, 0.0);
-      for (size_t j = 0; j < num_nodes; j++)
-        qg[j] = q_vector[sdm_.MapDOFLocal(cell, j, uk_man_, 0, g)];
+      std::vector<PetscInt> cell_dofs(num_nodes, 0);
+      for (size_t i = 0; i < num_nodes; i++)
+        cell_dofs[i] = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+
+      // Row-major block of the cell, inserted with a single call
+      std::vector<double> cell_block(num_nodes * num_nodes, 0.0);
+      auto Aij = [&cell_block, num_nodes](size_t i, size_t j) -> double&
+      { return cell_block[i * num_nodes + j]; };
 
       //==================================== Assemble continuous terms
       for (size_t i = 0; i < num_nodes; i++)
       {
-        if (node_is_dirichlet[i].first) continue;
-        const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
-        double entry_rhs_i = 0.0;
+        if (node_is_dirichlet[i]) continue;
         for (size_t j = 0; j < num_nodes; j++)
         {
-          const int64_t jmap = sdm_.MapDOF(cell, j, uk_man_, 0, g);
-
-          const double entry_aij =
-            Dg * cell_K_matrix[i][j] + sigr_g * cell_M_matrix[i][j];
-
-          if (not node_is_dirichlet[j].first)
-            MatSetValue(A_, imap, jmap, entry_aij, ADD_VALUES);
-          else
-          {
-            const double bcvalue = node_is_dirichlet[j].second;
-            VecSetValue(rhs_, imap, -entry_aij * bcvalue, ADD_VALUES);
-          }
-
-          entry_rhs_i += qg[j] * cell_M_matrix[i][j];
+          if (node_is_dirichlet[j]) continue;
+          Aij(i, j) += Dg * cell_K_matrix[i][j] + sigr_g * cell_M_matrix[i][j];
         } // for j
-
-        VecSetValue(rhs_, imap, entry_rhs_i, ADD_VALUES);
-      } // for i
+      }   // for i
 
       //==================================== Assemble face terms
       for (size_t f = 0; f < num_faces; ++f)
@@ -118,7 +112,6 @@ void DiffusionPWLCSolver::AssembleAand_b(const std::vector<double>& q_vector)
         const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
 
         const auto& face_M = unit_cell_matrices.face_M_matrices[f];
-        const auto& face_Si = unit_cell_matrices.face_Si_vectors[f];
 
         if (not face.has_neighbor_)
         {
@@ -128,17 +121,10 @@ void DiffusionPWLCSolver::AssembleAand_b(const std::vector<double>& q_vector)
 
           if (bc.type == BCType::DIRICHLET)
           {
-            const double bc_value = bc.values[0];
-
             for (size_t fi = 0; fi < num_face_nodes; ++fi)
             {
               const int i = cell_mapping.MapFaceNode(f, fi);
-              const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
-
-              // MatSetValue(A_, imap, imap, cell_Vi[i], ADD_VALUES);
-              // VecSetValue(rhs_, imap, bc_value * cell_Vi[i], ADD_VALUES);
-              MatSetValue(A_, imap, imap, 1.0, ADD_VALUES);
-              VecSetValue(rhs_, imap, bc_value, ADD_VALUES);
+              Aij(i, i) += 1.0;
             } // for fi
 
           } // Dirichlet BC
@@ -146,45 +132,41 @@ void DiffusionPWLCSolver::AssembleAand_b(const std::vector<double>& q_vector)
           {
             const double aval = bc.values[0];
             const double bval = bc.values[1];
-            const double fval = bc.values[2];
 
             if (std::fabs(bval) < 1.0e-12) continue; // a and f assumed zero
+            if (std::fabs(aval) < 1.0e-12) continue;
 
             for (size_t fi = 0; fi < num_face_nodes; fi++)
             {
               const int i = cell_mapping.MapFaceNode(f, fi);
-              const int64_t ir = sdm_.MapDOF(cell, i, uk_man_, 0, g);
 
-              if (std::fabs(aval) >= 1.0e-12)
+              for (size_t fj = 0; fj < num_face_nodes; fj++)
               {
-                for (size_t fj = 0; fj < num_face_nodes; fj++)
-                {
-                  const int j = cell_mapping.MapFaceNode(f, fj);
-                  const int64_t jr = sdm_.MapDOF(cell, j, uk_man_, 0, g);
-
-                  const double aij = (aval / bval) * face_M[i][j];
+                const int j = cell_mapping.MapFaceNode(f, fj);
 
-                  MatSetValue(A_, ir, jr, aij, ADD_VALUES);
-                } // for fj
-              }   // if a nonzero
-
-              if (std::fabs(fval) >= 1.0e-12)
-              {
-                const double rhs_val = (fval / bval) * face_Si[i];
-
-                VecSetValue(rhs_, ir, rhs_val, ADD_VALUES);
-              } // if f nonzero
+                Aij(i, j) += (aval / bval) * face_M[i][j];
+              } // for fj
             }   // for fi
           }     // Robin BC
         }       // boundary face
       }         // for face
-    }           // for g
-  }             // for cell
+
+      MatSetValues(A_,
+                   static_cast<PetscInt>(num_nodes),
+                   cell_dofs.data(),
+                   static_cast<PetscInt>(num_nodes),
+                   cell_dofs.data(),
+                   cell_block.data(),
+                   ADD_VALUES);
+    } // for g
+  }   // for cell
 
   MatAssemblyBegin(A_, MAT_FINAL_ASSEMBLY);
   MatAssemblyEnd(A_, MAT_FINAL_ASSEMBLY);
-  VecAssemblyBegin(rhs_);
-  VecAssemblyEnd(rhs_);
+
+  //============================================= Right-hand side
+  BuildRHSOperators();
+  AssembleRHS(q_vector.data());
 
   if (options.verbose)
   {
@@ -216,6 +198,8 @@ void DiffusionPWLCSolver::AssembleAand_b(const std::vector<double>& q_vector)
   PCSetUp(pc);
 
   KSPSetUp(ksp_);
+
+  t_assemble.TimeSectionEnd();
 }
 
 } // namespace lbs::acceleration
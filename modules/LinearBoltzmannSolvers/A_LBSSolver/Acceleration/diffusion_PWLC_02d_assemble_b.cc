@@ -4,7 +4,6 @@
 #include "mesh/MeshContinuum/chi_meshcontinuum.h"
 
 #include "math/SpatialDiscretization/SpatialDiscretization.h"
-#include "math/SpatialDiscretization/FiniteElement/QuadraturePointData.h"
 
 #include "physics/PhysicsMaterial/MultiGroupXS/multigroup_xs.h"
 
@@ -12,8 +11,6 @@
 
 #include "chi_runtime.h"
 #include "chi_log.h"
-#include "utils/chi_timer.h"
-#include "console/chi_console.h"
 
 #define DefaultBCDirichlet                                                     \
   BoundaryCondition                                                            \
@@ -22,39 +19,24 @@
   }
 
 // ###################################################################
-/**Assembles the RHS using unit cell-matrices. These are
- * the routines used in the production versions.*/
-void lbs::acceleration::DiffusionPWLCSolver::Assemble_b(
-  const std::vector<double>& q_vector)
+/**Builds the right-hand side operators using unit cell-matrices. The
+ * block of a cell is its mass matrix without the rows of the Dirichlet
+ * nodes. The fixed contributions are the Dirichlet values, lifted through
+ * the cell matrix, and the Robin sources.*/
+void lbs::acceleration::DiffusionPWLCSolver::BuildRHSOperators()
 {
-  const size_t num_local_dofs = sdm_.GetNumLocalAndGhostDOFs(uk_man_);
-  ChiInvalidArgumentIf(q_vector.size() != num_local_dofs,
-                       std::string("q_vector size mismatch. ") +
-                         std::to_string(q_vector.size()) + " vs " +
-                         std::to_string(num_local_dofs));
-  const std::string fname = "lbs::acceleration::DiffusionMIPSolver::"
-                            "Assemble_b";
-  if (A_ == nullptr or rhs_ == nullptr or ksp_ == nullptr)
-    throw std::logic_error(fname + ": Some or all PETSc elements are null. "
-                                   "Check that Initialize has been called.");
-  if (options.verbose)
-    Chi::log.Log() << Chi::program_timer.GetTimeString()
-                   << " Starting assembly";
-
   const size_t num_groups = uk_man_.unknowns_.front().num_components_;
 
-  VecSet(rhs_, 0.0);
+  InitializeRHSOperators();
   for (const auto& cell : grid_.local_cells)
   {
     const size_t num_faces = cell.faces_.size();
     const auto& cell_mapping = sdm_.GetCellMapping(cell);
     const size_t num_nodes = cell_mapping.NumNodes();
-    const auto cc_nodes = cell_mapping.GetNodeLocations();
     const auto& unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
 
     const auto& cell_K_matrix = unit_cell_matrices.K_matrix;
     const auto& cell_M_matrix = unit_cell_matrices.M_matrix;
-    const auto& cell_Vi = unit_cell_matrices.Vi_vectors;
 
     const auto& xs = mat_id_2_xs_map_.at(cell.material_id_);
 
@@ -78,38 +60,37 @@ void lbs::acceleration::DiffusionPWLCSolver::Assemble_b(
       }
     }
 
-    for (size_t g = 0; g < num_groups; ++g)
+    //=========================================== Source block
+    std::vector<double> block(num_nodes * num_nodes, 0.0);
+    for (size_t i = 0; i < num_nodes; i++)
     {
-      //==================================== Get coefficient and nodal src
-      std::vector<double> qg(num_nodes, 0.0);
+      if (node_is_dirichlet[i].first) continue;
       for (size_t j = 0; j < num_nodes; j++)
-        qg[j] = q_vector[sdm_.MapDOFLocal(cell, j, uk_man_, 0, g)];
+        block[i * num_nodes + j] = cell_M_matrix[i][j];
+    }
 
-      //==================================== Assemble continuous terms
+    //=========================================== Boundary contributions
+    std::vector<double> fixed_values(num_groups * num_nodes, 0.0);
+    for (size_t g = 0; g < num_groups; ++g)
+    {
       const double Dg = xs.Dg[g];
       const double sigr_g = xs.sigR[g];
+      double* fixed_g = &fixed_values[g * num_nodes];
 
+      //==================================== Lift Dirichlet values
       for (size_t i = 0; i < num_nodes; i++)
       {
         if (node_is_dirichlet[i].first) continue;
-        const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
-        double entry_rhs_i = 0.0;
         for (size_t j = 0; j < num_nodes; j++)
         {
-          if (node_is_dirichlet[j].first)
-          {
-            const double entry_aij =
-              Dg * cell_K_matrix[i][j] + sigr_g * cell_M_matrix[i][j];
+          if (not node_is_dirichlet[j].first) continue;
 
-            const double bcvalue = node_is_dirichlet[j].second;
-            VecSetValue(rhs_, imap, -entry_aij * bcvalue, ADD_VALUES);
-          }
+          const double entry_aij =
+            Dg * cell_K_matrix[i][j] + sigr_g * cell_M_matrix[i][j];
 
-          entry_rhs_i += qg[j] * cell_M_matrix[i][j];
+          fixed_g[i] -= entry_aij * node_is_dirichlet[j].second;
         } // for j
-
-        VecSetValue(rhs_, imap, entry_rhs_i, ADD_VALUES);
-      } // for i
+      }   // for i
 
       //==================================== Assemble face terms
       for (size_t f = 0; f < num_faces; ++f)
@@ -129,16 +110,8 @@ void lbs::acceleration::DiffusionPWLCSolver::Assemble_b(
           {
             const double bc_value = bc.values[0];
 
-            //========================= Assembly penalty terms
             for (size_t fi = 0; fi < num_face_nodes; ++fi)
-            {
-              const int i = cell_mapping.MapFaceNode(f, fi);
-              const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
-
-              // VecSetValue(rhs_, imap, bc_value * cell_Vi[i], ADD_VALUES);
-              VecSetValue(rhs_, imap, bc_value, ADD_VALUES);
-            } // for fi
-
+              fixed_g[cell_mapping.MapFaceNode(f, fi)] += bc_value;
           } // Dirichlet BC
           else if (bc.type == BCType::ROBIN)
           {
@@ -146,160 +119,62 @@ void lbs::acceleration::DiffusionPWLCSolver::Assemble_b(
             const double fval = bc.values[2];
 
             if (std::fabs(bval) < 1.0e-12) continue; // a and f assumed zero
+            if (std::fabs(fval) < 1.0e-12) continue;
 
             for (size_t fi = 0; fi < num_face_nodes; fi++)
             {
               const int i = cell_mapping.MapFaceNode(f, fi);
-              const int64_t ir = sdm_.MapDOF(cell, i, uk_man_, 0, g);
-
-              if (std::fabs(fval) >= 1.0e-12)
-              {
-                const double rhs_val = (fval / bval) * face_Si[i];
-
-                VecSetValue(rhs_, ir, rhs_val, ADD_VALUES);
-              } // if f nonzero
-            }   // for fi
-          }     // Robin BC
-        }       // boundary face
-      }         // for face
-    }           // for g
-  }             // for cell
-
-  VecAssemblyBegin(rhs_);
-  VecAssemblyEnd(rhs_);
-
-  if (options.verbose)
-    Chi::log.Log() << Chi::program_timer.GetTimeString()
-                   << " Assembly completed";
+              fixed_g[i] += (fval / bval) * face_Si[i];
+            } // for fi
+          }   // Robin BC
+        }     // boundary face
+      }       // for face
+    }         // for g
+
+    AddCellRHSOperator(cell, block, fixed_values);
+  } // for cell
+  FinalizeRHSOperators();
 }
 
 // ###################################################################
-/**Assembles the RHS using unit cell-matrices. These are
- * the routines used in the production versions.*/
-void lbs::acceleration::DiffusionPWLCSolver::Assemble_b(Vec petsc_q_vector)
+/**Assembles the RHS from the cell operators built with the matrix. These
+ * are the routines used in the production versions.*/
+void lbs::acceleration::DiffusionPWLCSolver::Assemble_b(
+  const std::vector<double>& q_vector)
 {
+  const size_t num_local_dofs = sdm_.GetNumLocalAndGhostDOFs(uk_man_);
+  ChiInvalidArgumentIf(q_vector.size() != num_local_dofs,
+                       std::string("q_vector size mismatch. ") +
+                         std::to_string(q_vector.size()) + " vs " +
+                         std::to_string(num_local_dofs));
   const std::string fname = "lbs::acceleration::DiffusionMIPSolver::"
                             "Assemble_b";
   if (A_ == nullptr or rhs_ == nullptr or ksp_ == nullptr)
     throw std::logic_error(fname + ": Some or all PETSc elements are null. "
                                    "Check that Initialize has been called.");
-  if (options.verbose)
-    Chi::log.Log() << Chi::program_timer.GetTimeString()
-                   << " Starting assembly";
-
-  const size_t num_groups = uk_man_.unknowns_.front().num_components_;
-
-  const double* q_vector;
-  VecGetArrayRead(petsc_q_vector, &q_vector);
-
-  VecSet(rhs_, 0.0);
-  for (const auto& cell : grid_.local_cells)
-  {
-    const size_t num_faces = cell.faces_.size();
-    const auto& cell_mapping = sdm_.GetCellMapping(cell);
-    const size_t num_nodes = cell_mapping.NumNodes();
-    const auto cc_nodes = cell_mapping.GetNodeLocations();
-    const auto& unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
-
-    const auto& cell_M_matrix = unit_cell_matrices.M_matrix;
-    const auto& cell_Vi = unit_cell_matrices.Vi_vectors;
-
-    //=========================================== Mark dirichlet nodes
-    std::vector<bool> node_is_dirichlet(num_nodes, false);
-    for (size_t f = 0; f < num_faces; ++f)
-    {
-      const auto& face = cell.faces_[f];
-      if (not face.has_neighbor_)
-      {
-        auto bc = DefaultBCDirichlet;
-        if (bcs_.count(face.neighbor_id_) > 0) bc = bcs_.at(face.neighbor_id_);
-
-        if (bc.type != BCType::DIRICHLET) continue;
-
-        const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
-        for (size_t fi = 0; fi < num_face_nodes; ++fi)
-          node_is_dirichlet[cell_mapping.MapFaceNode(f, fi)] = true;
-      }
-    }
-
-    for (size_t g = 0; g < num_groups; ++g)
-    {
-      //==================================== Get coefficient and nodal src
-      std::vector<double> qg(num_nodes, 0.0);
-      for (size_t j = 0; j < num_nodes; j++)
-        qg[j] = q_vector[sdm_.MapDOFLocal(cell, j, uk_man_, 0, g)];
-
-      //==================================== Assemble continuous terms
-      for (size_t i = 0; i < num_nodes; i++)
-      {
-        if (node_is_dirichlet[i]) continue;
-        const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
-        double entry_rhs_i = 0.0;
-        for (size_t j = 0; j < num_nodes; j++)
-          entry_rhs_i += qg[j] * cell_M_matrix[i][j];
-
-        VecSetValue(rhs_, imap, entry_rhs_i, ADD_VALUES);
-      } // for i
-
-      //==================================== Assemble face terms
-      for (size_t f = 0; f < num_faces; ++f)
-      {
-        const auto& face = cell.faces_[f];
-        const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
 
-        const auto& face_Si = unit_cell_matrices.face_Si_vectors[f];
-
-        if (not face.has_neighbor_)
-        {
-          auto bc = DefaultBCDirichlet;
-          if (bcs_.count(face.neighbor_id_) > 0)
-            bc = bcs_.at(face.neighbor_id_);
-
-          if (bc.type == BCType::DIRICHLET)
-          {
-            const double bc_value = bc.values[0];
+  if (rhs_operators_.fixed_rhs_ == nullptr) BuildRHSOperators();
 
-            //========================= Assembly penalty terms
-            for (size_t fi = 0; fi < num_face_nodes; ++fi)
-            {
-              const int i = cell_mapping.MapFaceNode(f, fi);
-              const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
-
-              VecSetValue(rhs_, imap, bc_value * cell_Vi[i], ADD_VALUES);
-            } // for fi
-
-          } // Dirichlet BC
-          else if (bc.type == BCType::ROBIN)
-          {
-            const double bval = bc.values[1];
-            const double fval = bc.values[2];
+  AssembleRHS(q_vector.data());
+}
 
-            if (std::fabs(bval) < 1.0e-12) continue; // a and f assumed zero
+// ###################################################################
+/**Assembles the RHS from the cell operators built with the matrix. These
+ * are the routines used in the production versions.*/
+void lbs::acceleration::DiffusionPWLCSolver::Assemble_b(Vec petsc_q_vector)
+{
+  const std::string fname = "lbs::acceleration::DiffusionMIPSolver::"
+                            "Assemble_b";
+  if (A_ == nullptr or rhs_ == nullptr or ksp_ == nullptr)
+    throw std::logic_error(fname + ": Some or all PETSc elements are null. "
+                                   "Check that Initialize has been called.");
 
-            for (size_t fi = 0; fi < num_face_nodes; fi++)
-            {
-              const int i = cell_mapping.MapFaceNode(f, fi);
-              const int64_t ir = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+  if (rhs_operators_.fixed_rhs_ == nullptr) BuildRHSOperators();
 
-              if (std::fabs(fval) >= 1.0e-12)
-              {
-                const double rhs_val = (fval / bval) * face_Si[i];
+  const double* q_vector;
+  VecGetArrayRead(petsc_q_vector, &q_vector);
 
-                VecSetValue(rhs_, ir, rhs_val, ADD_VALUES);
-              } // if f nonzero
-            }   // for fi
-          }     // Robin BC
-        }       // boundary face
-      }         // for face
-    }           // for g
-  }             // for cell
+  AssembleRHS(q_vector);
 
   VecRestoreArrayRead(petsc_q_vector, &q_vector);
-
-  VecAssemblyBegin(rhs_);
-  VecAssemblyEnd(rhs_);
-
-  if (options.verbose)
-    Chi::log.Log() << Chi::program_timer.GetTimeString()
-                   << " Assembly completed";
-}
\ No newline at end of file
+}
@@ -47,10 +47,77 @@ public:
 
   //02c
   void AssembleAand_b(const std::vector<double>& q_vector) override;
+protected:
+  void AssembleA();
+public:
   //02d
   void Assemble_b(const std::vector<double>& q_vector) override;
   void Assemble_b(Vec petsc_q_vector) override;
 
+protected:
+  //02d
+  void BuildRHSOperators() override;
+
+  //02e
+  Mat CreateMatrixFreeOperator() override;
+  void BuildMatrixFreeOperator();
+  void ApplyMatrixFree(const double* x, double* y) const;
+  void MatrixFreeDiagonal(double* diagonal) const;
+  static PetscErrorCode MatrixFreeMult(Mat A, Vec x, Vec y);
+  static PetscErrorCode MatrixFreeGetDiagonal(Mat A, Vec diagonal);
+
+  /**Cached data of the matrix-free operator. The cell matrices and face
+   * blocks are group independent and combined with the cross sections of
+   * all the groups while they are applied.*/
+  struct MatrixFreeData
+  {
+    enum class FaceKind { INTERNAL, DIRICHLET, ROBIN, NONE };
+    struct CellData
+    {
+      size_t num_nodes = 0;
+      const Multigroup_D_and_sigR* xs = nullptr;
+      /**Offset of the local dof indices, ordered [node][group].*/
+      size_t dof_offset = 0;
+      /**Offset of the row-major stiffness and mass matrices.*/
+      size_t matrix_offset = 0;
+      size_t face_begin = 0;
+      size_t face_end = 0;
+      /**Multiplier of the penalty coefficient, zero if it is fixed to one.*/
+      double kappa_factor = 0.0;
+    };
+    struct FaceData
+    {
+      FaceKind kind = FaceKind::NONE;
+      size_t num_face_nodes = 0;
+      size_t face_node_offset = 0;
+      /**Offset of the face mass block (num_face_nodes^2) followed by the
+       * gradient block (num_face_nodes x num_nodes for internal faces,
+       * num_nodes^2 for Dirichlet faces).*/
+      size_t matrix_offset = 0;
+      double hm = 1.0;
+      double hp = 1.0;
+      double robin_coefficient = 0.0;
+      const Multigroup_D_and_sigR* adj_xs = nullptr;
+      /**Offset of the adjacent dof indices, ordered [face node][group].*/
+      size_t adj_dof_offset = 0;
+    };
+
+    size_t num_groups = 0;
+    std::vector<CellData> cells;
+    std::vector<FaceData> faces;
+    std::vector<int> face_nodes;
+    std::vector<int64_t> dofs;
+    std::vector<double> matrices;
+
+    /**Ghosted work vectors holding the entries of adjacent cells on other
+     * locations.*/
+    Vec x_ghosted = nullptr;
+    Vec y_ghosted = nullptr;
+  };
+
+  MatrixFreeData matrix_free_data_;
+
+public:
   //05
   double HPerpendicular(const chi_mesh::Cell& cell, unsigned int f);
 
@@ -65,7 +132,7 @@ public:
   double CallLuaXYZFunction(lua_State* L, const std::string& lua_func_name,
                             const chi_mesh::Vector3& xyz);
 
-  virtual ~DiffusionMIPSolver() = default;
+  ~DiffusionMIPSolver() override;
 };
 
 }//namespace lbs::acceleration
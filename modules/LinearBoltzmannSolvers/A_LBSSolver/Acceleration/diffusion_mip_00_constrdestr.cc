@@ -30,3 +30,11 @@ lbs::acceleration::DiffusionMIPSolver::DiffusionMIPSolver(
     throw std::logic_error("lbs::acceleration::DiffusionMIPSolver: can only be"
                            " used with PWLD.");
 }
+
+// ###################################################################
+/**Destroys the work vectors of the matrix-free operator.*/
+lbs::acceleration::DiffusionMIPSolver::~DiffusionMIPSolver()
+{
+  VecDestroy(&matrix_free_data_.x_ghosted);
+  VecDestroy(&matrix_free_data_.y_ghosted);
+}
@@ -29,6 +29,10 @@ void lbs::acceleration::DiffusionMIPSolver::
   if (options.verbose)
     Chi::log.Log() << Chi::program_timer.GetTimeString() << " Starting assembly";
 
+  auto& t_assemble =
+    Chi::log.CreateOrGetTimingBlock("DiffusionSolver::AssembleAand_b");
+  t_assemble.TimeSectionBegin();
+
   lua_State* L = Chi::console.GetConsoleState();
   const auto& source_function = options.source_lua_function;
   const auto& solution_function = options.ref_solution_lua_function;
@@ -37,9 +41,12 @@ void lbs::acceleration::DiffusionMIPSolver::
 
   VecSet(rhs_, 0.0);
 
+  const auto& face_view = grid_.GetFlatFaceView();
+
   for (const auto& cell : grid_.local_cells)
   {
-    const size_t num_faces    = cell.faces_.size();
+    const size_t num_faces    = face_view.NumFaces(cell.local_id_);
+    const size_t face_offset  = face_view.CellFaceOffset(cell.local_id_);
     const auto&  cell_mapping = sdm_.GetCellMapping(cell);
     const size_t num_nodes    = cell_mapping.NumNodes();
     const auto   cc_nodes     = cell_mapping.GetNodeLocations();
@@ -101,21 +108,24 @@ void lbs::acceleration::DiffusionMIPSolver::
       //==================================== Assemble face terms
       for (size_t f=0; f<num_faces; ++f)
       {
-        const auto&  face           = cell.faces_[f];
-        const auto&  n_f            = face.normal_;
+        const size_t face_index     = face_offset + f;
+        const auto&  n_f            = face_view.Normal(face_index);
         const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
         const auto   fqp_data   = cell_mapping.MakeSurfaceQuadraturePointData(f);
 
         const double hm = HPerpendicular(cell, f);
 
-        typedef chi_mesh::MeshContinuum Grid;
-
-        if (face.has_neighbor_)
+        if (face_view.HasNeighbor(face_index))
         {
-          const auto&  adj_cell         = grid_.cells[face.neighbor_id_];
+          const int64_t adj_local_id    =
+            face_view.NeighborLocalID(face_index);
+          const auto&  adj_cell         =
+            adj_local_id >= 0 ? grid_.local_cells[adj_local_id]
+                              : grid_.cells[face_view.NeighborID(face_index)];
           const auto&  adj_cell_mapping = sdm_.GetCellMapping(adj_cell);
           const auto   ac_nodes         = adj_cell_mapping.GetNodeLocations();
-          const size_t acf              = Grid::MapCellFace(cell, adj_cell, f);
+          const size_t acf              =
+            grid_.GetFaceAdjacency().AssociatedFace(cell.local_id_, f);
           const double hp               = HPerpendicular(adj_cell, acf);
 
           const auto&  adj_xs   = mat_id_2_xs_map_.at(adj_cell.material_id_);
@@ -213,8 +223,8 @@ void lbs::acceleration::DiffusionMIPSolver::
         else
         {
           auto bc = DefaultBCDirichlet;
-          if (bcs_.count(face.neighbor_id_) > 0)
-            bc = bcs_.at(face.neighbor_id_);
+          if (bcs_.count(face_view.NeighborID(face_index)) > 0)
+            bc = bcs_.at(face_view.NeighborID(face_index));
 
           if (bc.type == BCType::DIRICHLET)
           {
@@ -376,4 +386,6 @@ void lbs::acceleration::DiffusionMIPSolver::
   PCSetUp(pc);
 
   KSPSetUp(ksp_);
+
+  t_assemble.TimeSectionEnd();
 }
\ No newline at end of file
@@ -29,6 +29,10 @@ void lbs::acceleration::DiffusionMIPSolver::
   if (options.verbose)
     Chi::log.Log() << Chi::program_timer.GetTimeString() << " Starting assembly";
 
+  auto& t_assemble =
+    Chi::log.CreateOrGetTimingBlock("DiffusionSolver::Assemble_b");
+  t_assemble.TimeSectionBegin();
+
   lua_State* L = Chi::console.GetConsoleState();
   const auto& source_function = options.source_lua_function;
   const auto& solution_function = options.ref_solution_lua_function;
@@ -225,4 +229,6 @@ void lbs::acceleration::DiffusionMIPSolver::
   PCSetUp(pc);
 
   KSPSetUp(ksp_);
+
+  t_assemble.TimeSectionEnd();
 }
\ No newline at end of file
@@ -4,7 +4,6 @@
 #include "mesh/MeshContinuum/chi_meshcontinuum.h"
 
 #include "math/SpatialDiscretization/SpatialDiscretization.h"
-#include "math/SpatialDiscretization/FiniteElement/QuadraturePointData.h"
 
 #include "physics/PhysicsMaterial/MultiGroupXS/multigroup_xs.h"
 
@@ -19,7 +18,9 @@
 
 //###################################################################
 /**Assembles both the matrix and the RHS using unit cell-matrices. These are
- * the routines used in the production versions.*/
+ * the routines used in the production versions. The entries of a cell are
+ * inserted per block and the right-hand side operators are built here once
+ * so that Assemble_b only has to apply them.*/
 void lbs::acceleration::DiffusionMIPSolver::
   AssembleAand_b(const std::vector<double>& q_vector)
 {
@@ -31,9 +32,62 @@ void lbs::acceleration::DiffusionMIPSolver::
   if (options.verbose)
     Chi::log.Log() << Chi::program_timer.GetTimeString() << " Starting assembly";
 
+  auto& t_assemble =
+    Chi::log.CreateOrGetTimingBlock("DiffusionSolver::AssembleAand_b");
+  t_assemble.TimeSectionBegin();
+
+  //============================================= Operator
+  if (options.matrix_free)
+    BuildMatrixFreeOperator();
+  else
+    AssembleA();
+
+  //============================================= Right-hand side
+  BuildRHSOperators();
+  AssembleRHS(q_vector.data());
+
+  if (options.verbose and not options.matrix_free)
+  {
+    MatInfo info;
+    MatGetInfo(A_, MAT_GLOBAL_SUM, &info);
+
+    Chi::log.Log() << "Number of mallocs used = " << info.mallocs
+                   << "\nNumber of non-zeros allocated = "
+                   << info.nz_allocated
+                   << "\nNumber of non-zeros used = "
+                   << info.nz_used
+                   << "\nNumber of unneeded non-zeros = "
+                   << info.nz_unneeded;
+  }
+
+  if (options.perform_symmetry_check and not options.matrix_free)
+  {
+    PetscBool symmetry = PETSC_FALSE;
+    MatIsSymmetric(A_, 1.0e-6, &symmetry);
+    if (symmetry == PETSC_FALSE)
+      throw std::logic_error(fname + ":Symmetry check failed");
+  }
+
+  KSPSetOperators(ksp_, A_, A_);
+
+  if (options.verbose)
+    Chi::log.Log() << Chi::program_timer.GetTimeString() << " Assembly completed";
+
+  PC pc;
+  KSPGetPC(ksp_, &pc);
+  PCSetUp(pc);
+
+  KSPSetUp(ksp_);
+
+  t_assemble.TimeSectionEnd();
+}
+
+//###################################################################
+/**Assembles the matrix of the operator using unit cell-matrices.*/
+void lbs::acceleration::DiffusionMIPSolver::AssembleA()
+{
   const size_t num_groups   = uk_man_.unknowns_.front().num_components_;
 
-  VecSet(rhs_, 0.0);
   for (const auto& cell : grid_.local_cells)
   {
     const size_t num_faces    = cell.faces_.size();
@@ -49,34 +103,25 @@ void lbs::acceleration::DiffusionMIPSolver::
 
     for (size_t g=0; g<num_groups; ++g)
     {
-      //==================================== Get coefficient and nodal src
+      //==================================== Get coefficient and dof maps
       const double Dg     = xs.Dg[g];
       const double sigr_g = xs.sigR[g];
 
-      std::vector<double> qg(num_nodes, 0.0);
-      for (size_t j=0; j<num_nodes; j++)
-        qg[j] = q_vector[sdm_.MapDOFLocal(cell, j, uk_man_, 0, g)];
+      std::vector<PetscInt> cell_dofs(num_nodes, 0);
+      for (size_t i=0; i<num_nodes; i++)
+        cell_dofs[i] = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+
+      // Row-major block of the couplings within the cell. It is inserted
+      // with a single call once all the terms have been added.
+      std::vector<double> cell_block(num_nodes*num_nodes, 0.0);
+      auto Aij = [&cell_block, num_nodes](size_t i, size_t j) -> double&
+      { return cell_block[i*num_nodes + j]; };
 
       //==================================== Assemble continuous terms
       for (size_t i=0; i<num_nodes; i++)
-      {
-        const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
-        double entry_rhs_i = 0.0;
         for (size_t j=0; j<num_nodes; j++)
-        {
-          const int64_t jmap = sdm_.MapDOF(cell, j, uk_man_, 0, g);
-
-          const double entry_aij =
-            Dg * cell_K_matrix[i][j] +
-            sigr_g * cell_M_matrix[i][j];
-
-          entry_rhs_i += qg[j]* cell_M_matrix[i][j];
-
-          MatSetValue(A_, imap, jmap, entry_aij, ADD_VALUES);
-        }//for j
-
-        VecSetValue(rhs_, imap, entry_rhs_i, ADD_VALUES);
-      }//for i
+          Aij(i,j) += Dg * cell_K_matrix[i][j] +
+                      sigr_g * cell_M_matrix[i][j];
 
       //==================================== Assemble face terms
       for (size_t f=0; f<num_faces; ++f)
@@ -87,23 +132,35 @@ void lbs::acceleration::DiffusionMIPSolver::
 
         const auto& face_M = unit_cell_matrices.face_M_matrices[f];
         const auto& face_G = unit_cell_matrices.face_G_matrices[f];
-        const auto& face_Si = unit_cell_matrices.face_Si_vectors[f];
 
         const double hm = HPerpendicular(cell, f);
 
-        typedef chi_mesh::MeshContinuum Grid;
-
         if (face.has_neighbor_)
         {
           const auto&  adj_cell         = grid_.cells[face.neighbor_id_];
           const auto&  adj_cell_mapping = sdm_.GetCellMapping(adj_cell);
           const auto   ac_nodes         = adj_cell_mapping.GetNodeLocations();
-          const size_t acf              = Grid::MapCellFace(cell, adj_cell, f);
+          const size_t acf              =
+            grid_.GetFaceAdjacency().AssociatedFace(cell.local_id_, f);
           const double hp               = HPerpendicular(adj_cell, acf);
 
           const auto&  adj_xs   = mat_id_2_xs_map_.at(adj_cell.material_id_);
           const double adj_Dg   = adj_xs.Dg[g];
 
+          //========================= Map face nodes to the adjacent cell
+          std::vector<PetscInt> adj_dofs(num_face_nodes, 0);
+          for (size_t fj=0; fj<num_face_nodes; ++fj)
+          {
+            const int jp = MapFaceNodeDisc(cell, adj_cell, cc_nodes, ac_nodes,
+                                           f, acf, fj);         //j-plus
+            adj_dofs[fj] = sdm_.MapDOF(adj_cell, jp, uk_man_, 0, g);
+          }
+
+          // Row-major blocks coupling the cell's nodes to the adjacent
+          // cell's face nodes and vice versa
+          std::vector<double> cell_adj_block(num_nodes*num_face_nodes, 0.0);
+          std::vector<double> adj_cell_block(num_face_nodes*num_nodes, 0.0);
+
           //========================= Compute kappa
           double kappa = 1.0;
           if (cell.Type() == chi_mesh::CellType::SLAB)
@@ -117,20 +174,15 @@ void lbs::acceleration::DiffusionMIPSolver::
           for (size_t fi=0; fi<num_face_nodes; ++fi)
           {
             const int i  = cell_mapping.MapFaceNode(f,fi);
-            const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
 
             for (size_t fj=0; fj<num_face_nodes; ++fj)
             {
               const int jm = cell_mapping.MapFaceNode(f,fj);      //j-minus
-              const int jp = MapFaceNodeDisc(cell, adj_cell, cc_nodes, ac_nodes,
-                                             f, acf, fj);         //j-plus
-              const int64_t jmmap = sdm_.MapDOF(cell, jm, uk_man_, 0, g);
-              const int64_t jpmap = sdm_.MapDOF(adj_cell, jp, uk_man_, 0, g);
 
               const double aij = kappa * face_M[i][jm];
 
-              MatSetValue(A_, imap, jmmap, aij, ADD_VALUES);
-              MatSetValue(A_, imap, jpmap, -aij, ADD_VALUES);
+              Aij(i,jm) += aij;
+              cell_adj_block[i*num_face_nodes + fj] -= aij;
             }//for fj
           }//for fi
 
@@ -139,45 +191,41 @@ void lbs::acceleration::DiffusionMIPSolver::
           // Dk = 0.5* n dot nabla bk
 
           // 0.5*D* n dot (b_j^+ - b_j^-)*nabla b_i^-
-          for (int i=0; i<num_nodes; i++)
+          for (size_t i=0; i<num_nodes; i++)
           {
-            const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
-
-            for (int fj=0; fj<num_face_nodes; fj++)
+            for (size_t fj=0; fj<num_face_nodes; fj++)
             {
               const int jm = cell_mapping.MapFaceNode(f,fj);      //j-minus
-              const int jp = MapFaceNodeDisc(cell, adj_cell, cc_nodes, ac_nodes,
-                                             f, acf, fj);         //j-plus
-              const int64_t jmmap = sdm_.MapDOF(cell, jm, uk_man_, 0, g);
-              const int64_t jpmap = sdm_.MapDOF(adj_cell, jp, uk_man_, 0, g);
 
               const double aij = -0.5*Dg*n_f.Dot(face_G[jm][i]);
 
-              MatSetValue(A_, imap, jmmap, aij, ADD_VALUES);
-              MatSetValue(A_, imap, jpmap, -aij, ADD_VALUES);
+              Aij(i,jm) += aij;
+              cell_adj_block[i*num_face_nodes + fj] -= aij;
             }//for fj
           }//for i
 
           // 0.5*D* n dot (b_i^+ - b_i^-)*nabla b_j^-
-          for (int fi=0; fi<num_face_nodes; fi++)
+          for (size_t fi=0; fi<num_face_nodes; fi++)
           {
             const int im = cell_mapping.MapFaceNode(f,fi);       //i-minus
-            const int ip = MapFaceNodeDisc(cell,adj_cell,cc_nodes,ac_nodes,
-                                           f,acf,fi);            //i-plus
-            const int64_t immap = sdm_.MapDOF(cell, im, uk_man_, 0, g);
-            const int64_t ipmap = sdm_.MapDOF(adj_cell, ip, uk_man_, 0, g);
 
-            for (int j=0; j<num_nodes; j++)
+            for (size_t j=0; j<num_nodes; j++)
             {
-              const int64_t jmap = sdm_.MapDOF(cell, j, uk_man_, 0, g);
-
               const double aij = -0.5*Dg*n_f.Dot(face_G[im][j]);
 
-              MatSetValue(A_, immap, jmap, aij, ADD_VALUES);
-              MatSetValue(A_, ipmap, jmap, -aij, ADD_VALUES);
+              Aij(im,j) += aij;
+              adj_cell_block[fi*num_nodes + j] -= aij;
             }//for j
           }//for fi
 
+          MatSetValues(A_,
+                       static_cast<PetscInt>(num_nodes), cell_dofs.data(),
+                       static_cast<PetscInt>(num_face_nodes), adj_dofs.data(),
+                       cell_adj_block.data(), ADD_VALUES);
+          MatSetValues(A_,
+                       static_cast<PetscInt>(num_face_nodes), adj_dofs.data(),
+                       static_cast<PetscInt>(num_nodes), cell_dofs.data(),
+                       adj_cell_block.data(), ADD_VALUES);
         }//internal face
         else
         {
@@ -187,8 +235,6 @@ void lbs::acceleration::DiffusionMIPSolver::
 
           if (bc.type == BCType::DIRICHLET)
           {
-            const double bc_value = bc.values[0];
-
             //========================= Compute kappa
             double kappa = 1.0;
             if (cell.Type() == chi_mesh::CellType::SLAB)
@@ -202,18 +248,12 @@ void lbs::acceleration::DiffusionMIPSolver::
             for (size_t fi=0; fi<num_face_nodes; ++fi)
             {
               const int i  = cell_mapping.MapFaceNode(f,fi);
-              const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
 
               for (size_t fj=0; fj<num_face_nodes; ++fj)
               {
                 const int jm = cell_mapping.MapFaceNode(f,fj);
-                const int64_t jmmap = sdm_.MapDOF(cell, jm, uk_man_, 0, g);
-
-                const double aij = kappa*face_M[i][jm];
-                const double aij_bc_value = aij*bc_value;
 
-                MatSetValue(A_  , imap, jmmap, aij, ADD_VALUES);
-                VecSetValue(rhs_, imap, aij_bc_value, ADD_VALUES);
+                Aij(i,jm) += kappa*face_M[i][jm];
               }//for fj
             }//for fi
 
@@ -223,96 +263,39 @@ void lbs::acceleration::DiffusionMIPSolver::
 
             // D* n dot (b_j^+ - b_j^-)*nabla b_i^-
             for (size_t i=0; i<num_nodes; i++)
-            {
-              const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
-
               for (size_t j=0; j<num_nodes; j++)
-              {
-                const int64_t jmap = sdm_.MapDOF(cell, j, uk_man_, 0, g);
-
-                const double aij = -Dg*n_f.Dot(face_G[j][i] + face_G[i][j]);
-                const double aij_bc_value = aij*bc_value;
-
-
-                MatSetValue(A_, imap, jmap, aij, ADD_VALUES);
-                VecSetValue(rhs_, imap, aij_bc_value, ADD_VALUES);
-              }//for fj
-            }//for i
+                Aij(i,j) += -Dg*n_f.Dot(face_G[j][i] + face_G[i][j]);
           }//Dirichlet BC
           else if (bc.type == BCType::ROBIN)
           {
             const double aval = bc.values[0];
             const double bval = bc.values[1];
-            const double fval = bc.values[2];
 
             if (std::fabs(bval) < 1.0e-12) continue; //a and f assumed zero
+            if (std::fabs(aval) < 1.0e-12) continue;
 
             for (size_t fi=0; fi<num_face_nodes; fi++)
             {
               const int i  = cell_mapping.MapFaceNode(f,fi);
-              const int64_t ir = sdm_.MapDOF(cell, i, uk_man_, 0, g);
 
-              if (std::fabs(aval) >= 1.0e-12)
+              for (size_t fj=0; fj<num_face_nodes; fj++)
               {
-                for (size_t fj=0; fj<num_face_nodes; fj++)
-                {
-                  const int j  = cell_mapping.MapFaceNode(f,fj);
-                  const int64_t jr = sdm_.MapDOF(cell, j, uk_man_, 0, g);
-
-                  const double aij = (aval/bval) * face_M[i][j];
-
-                  MatSetValue(A_, ir , jr, aij, ADD_VALUES);
-                }//for fj
-              }//if a nonzero
+                const int j  = cell_mapping.MapFaceNode(f,fj);
 
-              if (std::fabs(fval) >= 1.0e-12)
-              {
-                const double rhs_val = (fval/bval) * face_Si[i];
-
-                VecSetValue(rhs_, ir, rhs_val, ADD_VALUES);
-              }//if f nonzero
+                Aij(i,j) += (aval/bval) * face_M[i][j];
+              }//for fj
             }//for fi
           }//Robin BC
         }//boundary face
       }//for face
+
+      MatSetValues(A_,
+                   static_cast<PetscInt>(num_nodes), cell_dofs.data(),
+                   static_cast<PetscInt>(num_nodes), cell_dofs.data(),
+                   cell_block.data(), ADD_VALUES);
     }//for g
   }//for cell
 
   MatAssemblyBegin(A_, MAT_FINAL_ASSEMBLY);
   MatAssemblyEnd(A_, MAT_FINAL_ASSEMBLY);
-  VecAssemblyBegin(rhs_);
-  VecAssemblyEnd(rhs_);
-
-  if (options.verbose)
-  {
-    MatInfo info;
-    MatGetInfo(A_, MAT_GLOBAL_SUM, &info);
-
-    Chi::log.Log() << "Number of mallocs used = " << info.mallocs
-                   << "\nNumber of non-zeros allocated = "
-                   << info.nz_allocated
-                   << "\nNumber of non-zeros used = "
-                   << info.nz_used
-                   << "\nNumber of unneeded non-zeros = "
-                   << info.nz_unneeded;
-  }
-
-  if (options.perform_symmetry_check)
-  {
-    PetscBool symmetry = PETSC_FALSE;
-    MatIsSymmetric(A_, 1.0e-6, &symmetry);
-    if (symmetry == PETSC_FALSE)
-      throw std::logic_error(fname + ":Symmetry check failed");
-  }
-
-  KSPSetOperators(ksp_, A_, A_);
-
-  if (options.verbose)
-    Chi::log.Log() << Chi::program_timer.GetTimeString() << " Assembly completed";
-
-  PC pc;
-  KSPGetPC(ksp_, &pc);
-  PCSetUp(pc);
-
-  KSPSetUp(ksp_);
-}
\ No newline at end of file
+}
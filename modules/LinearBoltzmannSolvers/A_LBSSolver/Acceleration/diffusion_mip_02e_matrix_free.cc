@@ -0,0 +1,517 @@
+#include "diffusion_mip.h"
+#include "acceleration.h"
+
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "math/SpatialDiscretization/SpatialDiscretization.h"
+#include "math/PETScUtils/petsc_utils.h"
+
+#include "A_LBSSolver/lbs_structs.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include <unordered_map>
+
+#define DefaultBCDirichlet BoundaryCondition{BCType::DIRICHLET,{0,0,0}}
+
+namespace lbs::acceleration
+{
+
+//###################################################################
+/**Creates the shell matrix applying the MIP operator. Its data is built
+ * with BuildMatrixFreeOperator.*/
+Mat DiffusionMIPSolver::CreateMatrixFreeOperator()
+{
+  Mat A;
+  MatCreateShell(PETSC_COMM_WORLD,
+                 num_local_dofs_,
+                 num_local_dofs_,
+                 num_global_dofs_,
+                 num_global_dofs_,
+                 this,
+                 &A);
+
+  MatShellSetOperation(A, MATOP_MULT, (void (*)())MatrixFreeMult);
+  MatShellSetOperation(A, MATOP_MULT_TRANSPOSE, (void (*)())MatrixFreeMult);
+  MatShellSetOperation(
+    A, MATOP_GET_DIAGONAL, (void (*)())MatrixFreeGetDiagonal);
+  MatSetOption(A, MAT_SYMMETRIC, PETSC_TRUE);
+
+  return A;
+}
+
+//###################################################################
+/**Caches the group independent cell matrices and face blocks of the MIP
+ * operator, the indices of the dofs they couple, and creates the ghosted
+ * work vectors for the dofs of adjacent cells on other locations.*/
+void DiffusionMIPSolver::BuildMatrixFreeOperator()
+{
+  typedef MatrixFreeData::FaceKind FaceKind;
+
+  auto& mf = matrix_free_data_;
+  VecDestroy(&mf.x_ghosted);
+  VecDestroy(&mf.y_ghosted);
+  mf = MatrixFreeData();
+
+  const size_t num_groups = uk_man_.unknowns_.front().num_components_;
+  mf.num_groups = num_groups;
+  mf.cells.reserve(grid_.local_cells.size());
+
+  std::vector<int64_t> ghost_ids;
+  std::unordered_map<int64_t, int64_t> ghost_id_to_local;
+
+  const auto& face_view = grid_.GetFlatFaceView();
+
+  for (const auto& cell : grid_.local_cells)
+  {
+    const size_t num_faces    = face_view.NumFaces(cell.local_id_);
+    const size_t face_offset  = face_view.CellFaceOffset(cell.local_id_);
+    const auto&  cell_mapping = sdm_.GetCellMapping(cell);
+    const size_t num_nodes    = cell_mapping.NumNodes();
+    const auto   cc_nodes     = cell_mapping.GetNodeLocations();
+    const auto&  unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
+
+    MatrixFreeData::CellData cell_data;
+    cell_data.num_nodes = num_nodes;
+    cell_data.xs = &mat_id_2_xs_map_.at(cell.material_id_);
+
+    if (cell.Type() == chi_mesh::CellType::SLAB or
+        cell.Type() == chi_mesh::CellType::POLYGON)
+      cell_data.kappa_factor = 1.0;
+    if (cell.Type() == chi_mesh::CellType::POLYHEDRON)
+      cell_data.kappa_factor = 2.0;
+
+    //==================================== Dofs and cell matrices
+    cell_data.dof_offset = mf.dofs.size();
+    for (size_t i=0; i<num_nodes; ++i)
+      for (size_t g=0; g<num_groups; ++g)
+        mf.dofs.push_back(sdm_.MapDOFLocal(cell, i, uk_man_, 0, g));
+
+    cell_data.matrix_offset = mf.matrices.size();
+    for (const auto* matrix : {&unit_cell_matrices.K_matrix,
+                               &unit_cell_matrices.M_matrix})
+      for (size_t i=0; i<num_nodes; ++i)
+        for (size_t j=0; j<num_nodes; ++j)
+          mf.matrices.push_back((*matrix)[i][j]);
+
+    //==================================== Faces
+    cell_data.face_begin = mf.faces.size();
+    for (size_t f=0; f<num_faces; ++f)
+    {
+      const size_t face_index     = face_offset + f;
+      const auto&  n_f            = face_view.Normal(face_index);
+      const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
+
+      const auto& face_M = unit_cell_matrices.face_M_matrices[f];
+      const auto& face_G = unit_cell_matrices.face_G_matrices[f];
+
+      MatrixFreeData::FaceData face_data;
+      face_data.num_face_nodes = num_face_nodes;
+      face_data.face_node_offset = mf.face_nodes.size();
+      for (size_t fi=0; fi<num_face_nodes; ++fi)
+        mf.face_nodes.push_back(cell_mapping.MapFaceNode(f,fi));
+      const int* fnodes = &mf.face_nodes[face_data.face_node_offset];
+
+      face_data.hm = HPerpendicular(cell, f);
+
+      auto PushFaceMassBlock = [&]()
+      {
+        face_data.matrix_offset = mf.matrices.size();
+        for (size_t fi=0; fi<num_face_nodes; ++fi)
+          for (size_t fj=0; fj<num_face_nodes; ++fj)
+            mf.matrices.push_back(face_M[fnodes[fi]][fnodes[fj]]);
+      };
+
+      if (face_view.HasNeighbor(face_index))
+      {
+        const int64_t adj_local_id    = face_view.NeighborLocalID(face_index);
+        const auto&  adj_cell         =
+          adj_local_id >= 0 ? grid_.local_cells[adj_local_id]
+                            : grid_.cells[face_view.NeighborID(face_index)];
+        const auto&  adj_cell_mapping = sdm_.GetCellMapping(adj_cell);
+        const auto   ac_nodes         = adj_cell_mapping.GetNodeLocations();
+        const size_t acf              =
+          grid_.GetFaceAdjacency().AssociatedFace(cell.local_id_, f);
+        const bool   adj_is_local     = adj_local_id >= 0;
+
+        face_data.kind = FaceKind::INTERNAL;
+        face_data.hp = HPerpendicular(adj_cell, acf);
+        face_data.adj_xs = &mat_id_2_xs_map_.at(adj_cell.material_id_);
+
+        // Penalty block followed by the gradient block
+        // -0.5 n dot grad b_j integrated against face node fi
+        PushFaceMassBlock();
+        for (size_t fi=0; fi<num_face_nodes; ++fi)
+          for (size_t j=0; j<num_nodes; ++j)
+            mf.matrices.push_back(-0.5*n_f.Dot(face_G[fnodes[fi]][j]));
+
+        face_data.adj_dof_offset = mf.dofs.size();
+        for (size_t fj=0; fj<num_face_nodes; ++fj)
+        {
+          const int jp = MapFaceNodeDisc(cell, adj_cell, cc_nodes, ac_nodes,
+                                         f, acf, fj);         //j-plus
+          for (size_t g=0; g<num_groups; ++g)
+          {
+            if (adj_is_local)
+            {
+              mf.dofs.push_back(sdm_.MapDOFLocal(adj_cell, jp, uk_man_, 0, g));
+              continue;
+            }
+
+            const int64_t jpmap = sdm_.MapDOF(adj_cell, jp, uk_man_, 0, g);
+            auto it = ghost_id_to_local.find(jpmap);
+            if (it == ghost_id_to_local.end())
+            {
+              const int64_t local_id =
+                num_local_dofs_ + static_cast<int64_t>(ghost_ids.size());
+              ghost_ids.push_back(jpmap);
+              it = ghost_id_to_local.insert({jpmap, local_id}).first;
+            }
+            mf.dofs.push_back(it->second);
+          }
+        }
+      }//internal face
+      else
+      {
+        auto bc = DefaultBCDirichlet;
+        if (bcs_.count(face_view.NeighborID(face_index)) > 0)
+          bc = bcs_.at(face_view.NeighborID(face_index));
+
+        if (bc.type == BCType::DIRICHLET)
+        {
+          face_data.kind = FaceKind::DIRICHLET;
+
+          // Penalty block followed by the full gradient block
+          PushFaceMassBlock();
+          for (size_t i=0; i<num_nodes; ++i)
+            for (size_t j=0; j<num_nodes; ++j)
+              mf.matrices.push_back(-n_f.Dot(face_G[j][i] + face_G[i][j]));
+        }//Dirichlet BC
+        else if (bc.type == BCType::ROBIN)
+        {
+          const double aval = bc.values[0];
+          const double bval = bc.values[1];
+
+          if (std::fabs(bval) < 1.0e-12) continue; //a and f assumed zero
+          if (std::fabs(aval) < 1.0e-12) continue;
+
+          face_data.kind = FaceKind::ROBIN;
+          face_data.robin_coefficient = aval/bval;
+          PushFaceMassBlock();
+        }//Robin BC
+      }//boundary face
+
+      mf.faces.push_back(face_data);
+    }//for face
+    cell_data.face_end = mf.faces.size();
+
+    mf.cells.push_back(cell_data);
+  }//for cell
+
+  //==================================== Work vectors
+  mf.x_ghosted = chi_math::PETScUtils::CreateVectorWithGhosts(
+    num_local_dofs_,
+    num_global_dofs_,
+    static_cast<int64_t>(ghost_ids.size()),
+    ghost_ids);
+  VecDuplicate(mf.x_ghosted, &mf.y_ghosted);
+
+  if (options.verbose)
+    Chi::log.Log() << text_name_ << ": Matrix-free operator uses "
+                   << mf.matrices.size() * sizeof(double) +
+                        mf.dofs.size() * sizeof(int64_t)
+                   << " bytes of cached data on location 0.";
+}
+
+//###################################################################
+/**Applies the MIP operator to the local form of a ghosted vector and adds
+ * the result to the local form `y`. The contributions to the rows of
+ * adjacent cells on other locations are added to the ghost entries of `y`.
+ * The groups are the innermost loop so that every cell block is applied to
+ * all the groups at once.*/
+void DiffusionMIPSolver::ApplyMatrixFree(const double* x, double* y) const
+{
+  typedef MatrixFreeData::FaceKind FaceKind;
+
+  const auto& mf = matrix_free_data_;
+  const size_t G = mf.num_groups;
+  const double penalty_factor = options.penalty_factor;
+
+  std::vector<double> xc, yc, jumps, t(G), kappa(G);
+  for (const auto& cell_data : mf.cells)
+  {
+    const size_t n = cell_data.num_nodes;
+    const int64_t* dofs = &mf.dofs[cell_data.dof_offset];
+    const double* D = cell_data.xs->Dg.data();
+    const double* S = cell_data.xs->sigR.data();
+    const double* K = &mf.matrices[cell_data.matrix_offset];
+    const double* M = K + n*n;
+
+    xc.resize(n*G);
+    yc.assign(n*G, 0.0);
+    for (size_t k=0; k<n*G; ++k)
+      xc[k] = x[dofs[k]];
+
+    //==================================== Volumetric terms
+    for (size_t i=0; i<n; ++i)
+    {
+      double* yi = &yc[i*G];
+      for (size_t j=0; j<n; ++j)
+      {
+        const double kij = K[i*n + j];
+        const double mij = M[i*n + j];
+        const double* xj = &xc[j*G];
+        for (size_t g=0; g<G; ++g)
+          yi[g] += (D[g]*kij + S[g]*mij) * xj[g];
+      }
+    }
+
+    //==================================== Face terms
+    for (size_t f=cell_data.face_begin; f<cell_data.face_end; ++f)
+    {
+      const auto& face_data = mf.faces[f];
+      const size_t nf = face_data.num_face_nodes;
+      const int* fnodes = &mf.face_nodes[face_data.face_node_offset];
+      const double* P = &mf.matrices[face_data.matrix_offset];
+      const double* Gm = P + nf*nf;
+
+      if (face_data.kind == FaceKind::INTERNAL)
+      {
+        const int64_t* adj_dofs = &mf.dofs[face_data.adj_dof_offset];
+        const double* adj_D = face_data.adj_xs->Dg.data();
+
+        for (size_t g=0; g<G; ++g)
+          kappa[g] = (cell_data.kappa_factor == 0.0)? 1.0 :
+            fmax(penalty_factor*cell_data.kappa_factor*
+                 (adj_D[g]/face_data.hp + D[g]/face_data.hm)*0.5, 0.25);
+
+        // Jumps of the face nodes, (x^- - x^+)
+        jumps.resize(nf*G);
+        for (size_t fj=0; fj<nf; ++fj)
+          for (size_t g=0; g<G; ++g)
+            jumps[fj*G + g] = xc[fnodes[fj]*G + g] - x[adj_dofs[fj*G + g]];
+
+        // Penalty terms
+        for (size_t fi=0; fi<nf; ++fi)
+        {
+          double* yi = &yc[fnodes[fi]*G];
+          for (size_t fj=0; fj<nf; ++fj)
+          {
+            const double pij = P[fi*nf + fj];
+            for (size_t g=0; g<G; ++g)
+              yi[g] += kappa[g] * pij * jumps[fj*G + g];
+          }
+        }
+
+        // 0.5*D* n dot (b_j^+ - b_j^-)*nabla b_i^-
+        for (size_t i=0; i<n; ++i)
+        {
+          double* yi = &yc[i*G];
+          for (size_t fj=0; fj<nf; ++fj)
+          {
+            const double gji = Gm[fj*n + i];
+            for (size_t g=0; g<G; ++g)
+              yi[g] += D[g] * gji * jumps[fj*G + g];
+          }
+        }
+
+        // 0.5*D* n dot (b_i^+ - b_i^-)*nabla b_j^-
+        for (size_t fi=0; fi<nf; ++fi)
+        {
+          t.assign(G, 0.0);
+          for (size_t j=0; j<n; ++j)
+          {
+            const double gij = Gm[fi*n + j];
+            const double* xj = &xc[j*G];
+            for (size_t g=0; g<G; ++g)
+              t[g] += gij * xj[g];
+          }
+          double* yi = &yc[fnodes[fi]*G];
+          const int64_t* adj_i = &adj_dofs[fi*G];
+          for (size_t g=0; g<G; ++g)
+          {
+            yi[g] += D[g] * t[g];
+            y[adj_i[g]] -= D[g] * t[g];
+          }
+        }
+      }//internal face
+      else if (face_data.kind == FaceKind::DIRICHLET)
+      {
+        for (size_t g=0; g<G; ++g)
+          kappa[g] = (cell_data.kappa_factor == 0.0)? 1.0 :
+            fmax(penalty_factor*cell_data.kappa_factor*D[g]/face_data.hm,
+                 0.25);
+
+        // Penalty terms
+        for (size_t fi=0; fi<nf; ++fi)
+        {
+          double* yi = &yc[fnodes[fi]*G];
+          for (size_t fj=0; fj<nf; ++fj)
+          {
+            const double pij = P[fi*nf + fj];
+            const double* xj = &xc[fnodes[fj]*G];
+            for (size_t g=0; g<G; ++g)
+              yi[g] += kappa[g] * pij * xj[g];
+          }
+        }
+
+        // D* n dot (b_j^+ - b_j^-)*nabla b_i^-
+        for (size_t i=0; i<n; ++i)
+        {
+          double* yi = &yc[i*G];
+          for (size_t j=0; j<n; ++j)
+          {
+            const double gij = Gm[i*n + j];
+            const double* xj = &xc[j*G];
+            for (size_t g=0; g<G; ++g)
+              yi[g] += D[g] * gij * xj[g];
+          }
+        }
+      }//Dirichlet face
+      else if (face_data.kind == FaceKind::ROBIN)
+      {
+        const double coefficient = face_data.robin_coefficient;
+        for (size_t fi=0; fi<nf; ++fi)
+        {
+          double* yi = &yc[fnodes[fi]*G];
+          for (size_t fj=0; fj<nf; ++fj)
+          {
+            const double pij = coefficient * P[fi*nf + fj];
+            const double* xj = &xc[fnodes[fj]*G];
+            for (size_t g=0; g<G; ++g)
+              yi[g] += pij * xj[g];
+          }
+        }
+      }//Robin face
+    }//for face
+
+    for (size_t k=0; k<n*G; ++k)
+      y[dofs[k]] += yc[k];
+  }//for cell
+}
+
+//###################################################################
+/**Computes the local diagonal of the MIP operator.*/
+void DiffusionMIPSolver::MatrixFreeDiagonal(double* diagonal) const
+{
+  typedef MatrixFreeData::FaceKind FaceKind;
+
+  const auto& mf = matrix_free_data_;
+  const size_t G = mf.num_groups;
+  const double penalty_factor = options.penalty_factor;
+
+  for (const auto& cell_data : mf.cells)
+  {
+    const size_t n = cell_data.num_nodes;
+    const int64_t* dofs = &mf.dofs[cell_data.dof_offset];
+    const double* D = cell_data.xs->Dg.data();
+    const double* S = cell_data.xs->sigR.data();
+    const double* K = &mf.matrices[cell_data.matrix_offset];
+    const double* M = K + n*n;
+
+    for (size_t i=0; i<n; ++i)
+      for (size_t g=0; g<G; ++g)
+        diagonal[dofs[i*G + g]] = D[g]*K[i*n + i] + S[g]*M[i*n + i];
+
+    for (size_t f=cell_data.face_begin; f<cell_data.face_end; ++f)
+    {
+      const auto& face_data = mf.faces[f];
+      const size_t nf = face_data.num_face_nodes;
+      const int* fnodes = &mf.face_nodes[face_data.face_node_offset];
+      const double* P = &mf.matrices[face_data.matrix_offset];
+      const double* Gm = P + nf*nf;
+
+      for (size_t g=0; g<G; ++g)
+      {
+        if (face_data.kind == FaceKind::INTERNAL)
+        {
+          const double adj_Dg = face_data.adj_xs->Dg[g];
+          const double kappa = (cell_data.kappa_factor == 0.0)? 1.0 :
+            fmax(penalty_factor*cell_data.kappa_factor*
+                 (adj_Dg/face_data.hp + D[g]/face_data.hm)*0.5, 0.25);
+
+          for (size_t fi=0; fi<nf; ++fi)
+            diagonal[dofs[fnodes[fi]*G + g]] +=
+              kappa*P[fi*nf + fi] + 2.0*D[g]*Gm[fi*n + fnodes[fi]];
+        }
+        else if (face_data.kind == FaceKind::DIRICHLET)
+        {
+          const double kappa = (cell_data.kappa_factor == 0.0)? 1.0 :
+            fmax(penalty_factor*cell_data.kappa_factor*D[g]/face_data.hm,
+                 0.25);
+
+          for (size_t fi=0; fi<nf; ++fi)
+            diagonal[dofs[fnodes[fi]*G + g]] += kappa*P[fi*nf + fi];
+          for (size_t i=0; i<n; ++i)
+            diagonal[dofs[i*G + g]] += D[g]*Gm[i*n + i];
+        }
+        else if (face_data.kind == FaceKind::ROBIN)
+        {
+          for (size_t fi=0; fi<nf; ++fi)
+            diagonal[dofs[fnodes[fi]*G + g]] +=
+              face_data.robin_coefficient*P[fi*nf + fi];
+        }
+      }//for g
+    }//for face
+  }//for cell
+}
+
+//###################################################################
+/**Shell matrix action. The ghost entries of x are communicated before the
+ * cells are applied and the contributions to ghost rows are added back to
+ * their owners afterwards.*/
+PetscErrorCode DiffusionMIPSolver::MatrixFreeMult(Mat A, Vec x, Vec y)
+{
+  void* context;
+  MatShellGetContext(A, &context);
+  const auto& solver = *static_cast<DiffusionMIPSolver*>(context);
+  const auto& mf = solver.matrix_free_data_;
+
+  VecCopy(x, mf.x_ghosted);
+  chi_math::PETScUtils::CommunicateGhostEntries(mf.x_ghosted);
+
+  Vec x_local, y_local;
+  VecGhostGetLocalForm(mf.x_ghosted, &x_local);
+  VecGhostGetLocalForm(mf.y_ghosted, &y_local);
+  VecSet(y_local, 0.0);
+
+  const double* x_raw;
+  double* y_raw;
+  VecGetArrayRead(x_local, &x_raw);
+  VecGetArray(y_local, &y_raw);
+
+  solver.ApplyMatrixFree(x_raw, y_raw);
+
+  VecRestoreArrayRead(x_local, &x_raw);
+  VecRestoreArray(y_local, &y_raw);
+  VecGhostRestoreLocalForm(mf.x_ghosted, &x_local);
+  VecGhostRestoreLocalForm(mf.y_ghosted, &y_local);
+
+  VecGhostUpdateBegin(mf.y_ghosted, ADD_VALUES, SCATTER_REVERSE);
+  VecGhostUpdateEnd(mf.y_ghosted, ADD_VALUES, SCATTER_REVERSE);
+
+  VecCopy(mf.y_ghosted, y);
+
+  return 0;
+}
+
+//###################################################################
+/**Shell matrix diagonal, used by Jacobi preconditioning.*/
+PetscErrorCode DiffusionMIPSolver::MatrixFreeGetDiagonal(Mat A, Vec diagonal)
+{
+  void* context;
+  MatShellGetContext(A, &context);
+  const auto& solver = *static_cast<DiffusionMIPSolver*>(context);
+
+  double* diagonal_raw;
+  VecGetArray(diagonal, &diagonal_raw);
+
+  solver.MatrixFreeDiagonal(diagonal_raw);
+
+  VecRestoreArray(diagonal, &diagonal_raw);
+
+  return 0;
+}
+
+}//namespace lbs::acceleration
@@ -68,6 +68,8 @@ public:
   bool                 tgdsa_verbose_ = false;
   std::string          wgdsa_string_;
   std::string          tgdsa_string_;
+  bool                 wgdsa_matrix_free_ = false;
+  bool                 tgdsa_matrix_free_ = false;
 
   std::shared_ptr<lbs::acceleration::DiffusionMIPSolver> wgdsa_solver_;
   std::shared_ptr<lbs::acceleration::DiffusionMIPSolver> tgdsa_solver_;
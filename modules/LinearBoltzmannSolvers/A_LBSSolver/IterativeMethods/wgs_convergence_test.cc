@@ -2,6 +2,7 @@
 
 #include "wgs_context.h"
 #include "LinearBoltzmannSolvers/A_LBSSolver/Groupset/lbs_groupset.h"
+#include "LinearBoltzmannSolvers/A_LBSSolver/lbs_solver.h"
 
 #include "chi_runtime.h"
 #include "chi_log.h"
@@ -75,6 +76,9 @@ PetscErrorCode GSConvergenceTest(KSP ksp, PetscInt n, PetscReal rnorm,
 
   if (context->log_info_) Chi::log.Log() << iter_info.str() << std::endl;
 
+  //======================================== Periodic restart data
+  context->lbs_solver_.WriteRestartDataIfDue();
+
   return KSP_CONVERGED_ITERATING;
 }
 
@@ -14,7 +14,9 @@ public:
   explicit
   AdjointSourceFunction(const LBSSolver& lbs_solver);
 
-  double AddSourceMoments() const override {return 0.0;}
+  void AddSourceMoments(const Context&,
+                        const double*,
+                        double*) const override {}
 
   void AddAdditionalSources(LBSGroupset& groupset,
                             std::vector<double>& destination_q,
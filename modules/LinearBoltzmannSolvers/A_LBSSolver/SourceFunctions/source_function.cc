@@ -3,9 +3,13 @@
 #include "A_LBSSolver/lbs_solver.h"
 #include "mesh/MeshContinuum/chi_meshcontinuum.h"
 
+#include "utils/chi_thread_pool.h"
+
 #include "chi_runtime.h"
 #include "chi_log.h"
 
+#include <algorithm>
+
 namespace lbs
 {
 
@@ -13,7 +17,15 @@ namespace lbs
 /**Constructor.*/
 SourceFunction::SourceFunction(const LBSSolver &lbs_solver) :
   lbs_solver_(lbs_solver)
-{}
+{
+  const int num_threads = lbs_solver_.Options().num_sweep_threads;
+  if (num_threads > 1)
+    thread_pool_ = std::make_unique<chi::ThreadPool>(num_threads);
+}
+
+//###################################################################
+/**Destructor. Defined here where chi::ThreadPool is complete.*/
+SourceFunction::~SourceFunction() = default;
 
 
 //###################################################################
@@ -37,49 +49,125 @@ void SourceFunction::operator()(LBSGroupset &groupset,
 
   const size_t source_event_tag = lbs_solver_.GetSourceEventTag();
   Chi::log.LogEvent(source_event_tag, chi::ChiLog::EventType::EVENT_BEGIN);
+  auto& t_source = Chi::log.CreateOrGetTimingBlock("SourceFunction");
+  t_source.TimeSectionBegin();
 
-  apply_fixed_src_       = (source_flags & APPLY_FIXED_SOURCES);
-  apply_wgs_scatter_src_ = (source_flags & APPLY_WGS_SCATTER_SOURCES);
-  apply_ags_scatter_src_ = (source_flags & APPLY_AGS_SCATTER_SOURCES);
-  apply_wgs_fission_src_ = (source_flags & APPLY_WGS_FISSION_SOURCES);
-  apply_ags_fission_src_ = (source_flags & APPLY_AGS_FISSION_SOURCES);
-  suppress_wg_scatter_src_ = (source_flags & SUPPRESS_WG_SCATTER);
+  Context context;
+  context.apply_fixed_src       = (source_flags & APPLY_FIXED_SOURCES);
+  context.apply_wgs_scatter_src = (source_flags & APPLY_WGS_SCATTER_SOURCES);
+  context.apply_ags_scatter_src = (source_flags & APPLY_AGS_SCATTER_SOURCES);
+  context.apply_wgs_fission_src = (source_flags & APPLY_WGS_FISSION_SOURCES);
+  context.apply_ags_fission_src = (source_flags & APPLY_AGS_FISSION_SOURCES);
+  context.suppress_wg_scatter_src = (source_flags & SUPPRESS_WG_SCATTER);
 
   //================================================== Get group setup
-  gs_i_ = static_cast<size_t>(groupset.groups_.front().id_);
-  gs_f_ = static_cast<size_t>(groupset.groups_.back().id_);
+  context.gs_i = static_cast<size_t>(groupset.groups_.front().id_);
+  context.gs_f = static_cast<size_t>(groupset.groups_.back().id_);
+
+  context.first_grp = static_cast<size_t>(lbs_solver_.Groups().front().id_);
+  context.last_grp = static_cast<size_t>(lbs_solver_.Groups().back().id_);
+
+  //================================================== Make groupset blocks
+  const auto& cell_transport_views = lbs_solver_.GetCellTransportViews();
+  const auto& m_to_ell_em_map =
+    groupset.quadrature_->GetMomentToHarmonicsIndexMap();
+
+  unsigned int max_ell = 0;
+  for (const auto& ell_em : m_to_ell_em_map)
+    max_ell = std::max(max_ell, ell_em.ell);
+
+  GroupsetBlockMap groupset_blocks;
+  if (context.apply_wgs_scatter_src or context.apply_ags_scatter_src or
+      context.apply_wgs_fission_src or context.apply_ags_fission_src)
+    for (const auto& transport_view : cell_transport_views)
+    {
+      const auto& xs = transport_view.XS();
+      if (groupset_blocks.count(&xs) > 0) continue;
+
+      auto& blocks = groupset_blocks[&xs];
+      for (unsigned int ell = 0; ell <= max_ell; ++ell)
+        blocks.push_back(MakeGroupsetBlock(context, xs, ell));
+    }
 
-  first_grp_ = static_cast<size_t>(lbs_solver_.Groups().front().id_);
-  last_grp_ = static_cast<size_t>(lbs_solver_.Groups().back().id_);
+  //================================================== Loop over local cells
+  const size_t num_local_cells = lbs_solver_.Grid().local_cells.size();
+  auto AddSources = [&](size_t cell_begin, size_t cell_end, size_t)
+  {
+    AddCellSources(context,
+                   groupset,
+                   groupset_blocks,
+                   cell_begin,
+                   cell_end,
+                   destination_q,
+                   phi_local);
+  };
+
+  if (thread_pool_) thread_pool_->ParallelFor(num_local_cells, AddSources);
+  else AddSources(0, num_local_cells, 0);
 
-  default_zero_src_.assign(lbs_solver_.Groups().size(), 0.0);
+  AddAdditionalSources(groupset, destination_q, phi_local, source_flags);
 
+  t_source.TimeSectionEnd();
+  Chi::log.LogEvent(source_event_tag, chi::ChiLog::EventType::EVENT_END);
+}
+
+//###################################################################
+/**Adds all the volumetric sources of the local cells in the range
+ * [cell_begin, cell_end). Different ranges write to disjoint parts of
+ * `destination_q` and can therefore be processed concurrently.
+ *
+ * Fixed and delayed fission sources are added node by node. The
+ * scattering and prompt fission sources are added with the material's
+ * groupset blocks, applied to all the nodes and moments of the range's
+ * cells of that material at once, similar to a sparse matrix-matrix
+ * product. This keeps the matrix entries in cache and avoids any branching
+ * in the innermost loops.*/
+void SourceFunction::AddCellSources(
+  const Context& context,
+  const LBSGroupset& groupset,
+  const GroupsetBlockMap& groupset_blocks,
+  size_t cell_begin,
+  size_t cell_end,
+  std::vector<double>& destination_q,
+  const std::vector<double>& phi_local) const
+{
+  typedef chi_physics::MultiGroupXS MGXS;
+
+  const auto& grid = lbs_solver_.Grid();
   const auto& cell_transport_views = lbs_solver_.GetCellTransportViews();
   const auto& matid_to_src_map = lbs_solver_.GetMatID2IsoSrcMap();
 
   const size_t num_moments = lbs_solver_.NumMoments();
   const auto& ext_src_moments_local = lbs_solver_.ExtSrcMomentsLocal();
+  const bool use_src_moments = lbs_solver_.Options().use_src_moments;
+  const bool use_precursors = lbs_solver_.Options().use_precursors;
 
   const auto& m_to_ell_em_map =
     groupset.quadrature_->GetMomentToHarmonicsIndexMap();
 
-  //================================================== Loop over local cells
-  const auto& grid = lbs_solver_.Grid();
-  // Apply all nodal sources
-  for (const auto& cell : grid.local_cells)
+  const std::vector<double> zero_src(lbs_solver_.Groups().size(), 0.0);
+
+  //================================================== Fixed and delayed
+  //                                                   fission sources
+  std::map<const MGXS*, std::vector<const CellLBSView*>> xs_to_cell_views;
+  for (size_t c = cell_begin; c < cell_end; ++c)
   {
-    auto& transport_view = cell_transport_views[cell.local_id_];
-    cell_volume_ = transport_view.Volume();
+    const auto& cell = grid.local_cells[c];
+    const auto& transport_view = cell_transport_views[cell.local_id_];
 
     //==================== Obtain xs
     const auto& xs = transport_view.XS();
 
-      std::shared_ptr<chi_physics::IsotropicMultiGrpSource> P0_src = nullptr;
+    if (not groupset_blocks.empty())
+      xs_to_cell_views[&xs].push_back(&transport_view);
+
+    const bool delayed_fission = use_precursors and xs.IsFissionable();
+    if (not context.apply_fixed_src and not delayed_fission) continue;
+
+    const double* P0_src = nullptr;
     if (matid_to_src_map.count(cell.material_id_) > 0)
-      P0_src = matid_to_src_map.at(cell.material_id_);
+      P0_src = matid_to_src_map.at(cell.material_id_)->source_value_g_.data();
 
-    const auto& S = xs.TransferMatrices();
-    const auto& F = xs.ProductionMatrix();
     const auto& precursors = xs.Precursors();
     const auto& nu_delayed_sigma_f = xs.NuDelayedSigmaF();
 
@@ -94,110 +182,242 @@ void SourceFunction::operator()(LBSGroupset &groupset,
 
         size_t uk_map = transport_view.MapDOF(i, m, 0); //unknown map
 
-        const double* phi = &phi_local[uk_map];
-
-        //==================== Declare moment src
-        if (P0_src and ell == 0)
-          fixed_src_moments_ = P0_src->source_value_g_.data();
-        else
-          fixed_src_moments_ = default_zero_src_.data();
-
-        if (lbs_solver_.Options().use_src_moments)
-          fixed_src_moments_ = &ext_src_moments_local[uk_map];
+        double* q = &destination_q[uk_map];
 
-        //============================= Loop over groupset groups
-        for (size_t g = gs_i_; g <= gs_f_; ++g)
+        //============================== Apply fixed sources
+        if (context.apply_fixed_src)
         {
-          g_ = g;
-
-          double rhs = 0.0;
-
-          //============================== Apply fixed sources
-          if (apply_fixed_src_) rhs += this->AddSourceMoments();
-
-          //============================== Apply scattering sources
-          if (ell < S.size())
-          {
-            const auto& S_ell = S[ell];
-            //==================== Add Across GroupSet Scattering (AGS)
-            if (apply_ags_scatter_src_)
-              for (const auto& [_, gp, sigma_sm] : S_ell.Row(g))
-                if (gp < gs_i_ or gp > gs_f_)
-                  rhs += sigma_sm * phi[gp];
-
-            //==================== Add Within GroupSet Scattering (WGS)
-            if (apply_wgs_scatter_src_)
-              for (const auto& [_, gp, sigma_sm] : S_ell.Row(g))
-                if (gp >= gs_i_ and gp <= gs_f_)
-                {
-                  if (suppress_wg_scatter_src_ and g_ == gp) continue;
-                  rhs += sigma_sm * phi[gp];
-                }
-          }
-
-          //============================== Apply fission sources
-          const bool fission_avail = ell == 0 and xs.IsFissionable();
-
-          if (fission_avail)
-          {
-            const auto& F_g = F[g];
-            if (apply_ags_fission_src_)
-              for (size_t gp = first_grp_; gp <= last_grp_; ++gp)
-                if (gp < gs_i_ or gp > gs_f_)
-                  rhs += F_g[gp] * phi[gp];
-
-            if (apply_wgs_fission_src_)
-              for (size_t gp = gs_i_; gp <= gs_f_; ++gp)
-                rhs += F_g[gp] * phi[gp];
-
-            if (lbs_solver_.Options().use_precursors)
-              rhs += this->AddDelayedFission(
-                precursors, nu_delayed_sigma_f, &phi_local[uk_map]);
-          }
-
-          //============================== Add to destination vector
-          destination_q[uk_map + g] += rhs;
-
-        }//for g
+          const double* fixed_src_moments = zero_src.data();
+          if (P0_src and ell == 0) fixed_src_moments = P0_src;
+          if (use_src_moments)
+            fixed_src_moments = &ext_src_moments_local[uk_map];
+
+          this->AddSourceMoments(context, fixed_src_moments, q);
+        }
+
+        //============================== Apply delayed fission sources
+        if (delayed_fission and ell == 0)
+          this->AddDelayedFission(context,
+                                  precursors,
+                                  nu_delayed_sigma_f,
+                                  &phi_local[uk_map],
+                                  transport_view.Volume(),
+                                  q);
       }//for m
     }//for dof i
   }//for cell
 
-  AddAdditionalSources(groupset, destination_q, phi_local, source_flags);
+  //================================================== Scattering and
+  //                                                   prompt fission sources
+  unsigned int max_ell = 0;
+  for (const auto& ell_em : m_to_ell_em_map)
+    max_ell = std::max(max_ell, ell_em.ell);
 
-  Chi::log.LogEvent(source_event_tag, chi::ChiLog::EventType::EVENT_END);
+  std::vector<std::vector<size_t>> ell_dof_offsets(max_ell + 1);
+  for (const auto& [xs_ptr, cell_views] : xs_to_cell_views)
+  {
+    for (auto& dof_offsets : ell_dof_offsets)
+      dof_offsets.clear();
+
+    for (const auto* transport_view : cell_views)
+    {
+      const int num_nodes = transport_view->NumNodes();
+      for (int i = 0; i < num_nodes; ++i)
+        for (int m = 0; m < static_cast<int>(num_moments); ++m)
+          ell_dof_offsets[m_to_ell_em_map[m].ell].push_back(
+            transport_view->MapDOF(i, m, 0));
+    }
+
+    const auto& blocks = groupset_blocks.at(xs_ptr);
+    for (unsigned int ell = 0; ell <= max_ell; ++ell)
+    {
+      if (blocks[ell].values.empty()) continue;
+
+      ApplyGroupsetBlock(blocks[ell],
+                         context.gs_i,
+                         ell_dof_offsets[ell],
+                         phi_local.data(),
+                         destination_q.data());
+    }
+  }//for material
 }
 
-double SourceFunction::AddSourceMoments() const
+//###################################################################
+/**Returns the rows of the groupset's groups of the scattering operator
+ * of Legendre order `ell`, including the production matrix when `ell=0`,
+ * restricted to the entries selected by the context's source flags. Row
+ * `r` of the block corresponds to group `gs_i + r`. For each row the
+ * entries are ordered as across-groupset scattering, within-groupset
+ * scattering, across-groupset fission and within-groupset fission.*/
+SourceFunction::GroupsetBlock
+SourceFunction::MakeGroupsetBlock(const Context& context,
+                                  const chi_physics::MultiGroupXS& xs,
+                                  unsigned int ell)
+{
+  GroupsetBlock block;
+
+  const auto& S = xs.FlatTransferMatrices();
+  const auto& F = xs.FlatProductionMatrix();
+  const size_t num_groups = xs.NumGroups();
+  const bool apply_fission = ell == 0 and xs.IsFissionable() and
+                             not F.empty();
+
+  const size_t gs_i = context.gs_i;
+  const size_t gs_f = context.gs_f;
+
+  auto WithinGroupset = [gs_i, gs_f](size_t gp)
+  { return gp >= gs_i and gp <= gs_f; };
+
+  auto AddEntry = [&block](size_t gp, double value)
+  {
+    block.column_indices.push_back(static_cast<unsigned int>(gp));
+    block.values.push_back(value);
+  };
+
+  block.row_offsets.reserve(gs_f - gs_i + 2);
+  block.row_offsets.push_back(0);
+  for (size_t g = gs_i; g <= gs_f; ++g)
+  {
+    //============================== Scattering
+    if (ell < S.size())
+    {
+      const auto& S_ell = S[ell];
+      const size_t t_begin = S_ell.row_offsets[g];
+      const size_t t_end = S_ell.row_offsets[g + 1];
+
+      if (context.apply_ags_scatter_src)
+        for (size_t t = t_begin; t < t_end; ++t)
+        {
+          const size_t gp = S_ell.column_indices[t];
+          if (not WithinGroupset(gp)) AddEntry(gp, S_ell.values[t]);
+        }
+
+      if (context.apply_wgs_scatter_src)
+        for (size_t t = t_begin; t < t_end; ++t)
+        {
+          const size_t gp = S_ell.column_indices[t];
+          if (not WithinGroupset(gp)) continue;
+          if (context.suppress_wg_scatter_src and g == gp) continue;
+          AddEntry(gp, S_ell.values[t]);
+        }
+    }
+
+    //============================== Prompt fission
+    if (apply_fission)
+    {
+      const double* F_g = &F[g * num_groups];
+      if (context.apply_ags_fission_src)
+        for (size_t gp = context.first_grp; gp <= context.last_grp; ++gp)
+          if (not WithinGroupset(gp) and F_g[gp] != 0.0)
+            AddEntry(gp, F_g[gp]);
+
+      if (context.apply_wgs_fission_src)
+        for (size_t gp = gs_i; gp <= gs_f; ++gp)
+          if (F_g[gp] != 0.0)
+            AddEntry(gp, F_g[gp]);
+    }
+
+    block.row_offsets.push_back(block.values.size());
+  }//for g
+
+  return block;
+}
+
+//###################################################################
+/**Computes `q[k + gs_i + r] += sum_t block[r,t] * phi[k + column_t]` for
+ * every row `r` of the block and every offset `k` in `dof_offsets`. The
+ * offsets are processed in tiles so that the entries of a row are reused
+ * while the tile's flux values remain in cache.*/
+void SourceFunction::ApplyGroupsetBlock(const GroupsetBlock& block,
+                                        size_t gs_i,
+                                        const std::vector<size_t>& dof_offsets,
+                                        const double* phi,
+                                        double* q)
+{
+  constexpr size_t TILE_SIZE = 32;
+
+  const size_t num_rows = block.row_offsets.size() - 1;
+  const size_t num_dofs = dof_offsets.size();
+  const unsigned int* columns = block.column_indices.data();
+  const double* values = block.values.data();
+
+  for (size_t k0 = 0; k0 < num_dofs; k0 += TILE_SIZE)
+  {
+    const size_t k1 = std::min(k0 + TILE_SIZE, num_dofs);
+    for (size_t r = 0; r < num_rows; ++r)
+    {
+      const size_t t_begin = block.row_offsets[r];
+      const size_t t_end = block.row_offsets[r + 1];
+      if (t_begin == t_end) continue;
+
+      const size_t g = gs_i + r;
+      for (size_t k = k0; k < k1; ++k)
+      {
+        const double* phi_k = &phi[dof_offsets[k]];
+        double rhs = 0.0;
+        for (size_t t = t_begin; t < t_end; ++t)
+          rhs += values[t] * phi_k[columns[t]];
+        q[dof_offsets[k] + g] += rhs;
+      }
+    }//for row
+  }//for tile
+}
+
+//###################################################################
+/**Adds the fixed source moments.*/
+void SourceFunction::AddSourceMoments(const Context& context,
+                                      const double* fixed_src_moments,
+                                      double* q) const
 {
-  return fixed_src_moments_[g_];
+  for (size_t g = context.gs_i; g <= context.gs_f; ++g)
+    q[g] += fixed_src_moments[g];
 }
 
 
 //###################################################################
-/**Adds delayed particle precursor sources.*/
+/**Returns the delayed fission rate over the groups selected by the
+ * fission flags.*/
 double SourceFunction::
-  AddDelayedFission(const PrecursorList &precursors,
+  DelayedFissionRate(const Context& context,
+                     const std::vector<double>& nu_delayed_sigma_f,
+                     const double* phi)
+{
+  double rate = 0.0;
+  if (context.apply_ags_fission_src)
+    for (size_t gp = context.first_grp; gp <= context.last_grp; ++gp)
+      if (gp < context.gs_i or gp > context.gs_f)
+        rate += nu_delayed_sigma_f[gp] * phi[gp];
+
+  if (context.apply_wgs_fission_src)
+    for (size_t gp = context.gs_i; gp <= context.gs_f; ++gp)
+      rate += nu_delayed_sigma_f[gp] * phi[gp];
+
+  return rate;
+}
+
+
+//###################################################################
+/**Adds delayed particle precursor sources. The source is separable in
+ * the emission and the fission groups, hence the fission rate is computed
+ * once and then distributed over the groupset's groups.*/
+void SourceFunction::
+  AddDelayedFission(const Context& context,
+                    const PrecursorList &precursors,
                     const std::vector<double> &nu_delayed_sigma_f,
-                    const double *phi) const
+                    const double *phi,
+                    double,
+                    double* q) const
 {
-  double value = 0.0;
-  if (apply_ags_fission_src_)
-    for (size_t gp = first_grp_; gp <= last_grp_; ++gp)
-      if (gp < gs_i_ or gp > gs_f_)
-        for (const auto& precursor : precursors)
-          value += precursor.emission_spectrum[g_] *
-                   precursor.fractional_yield *
-                   nu_delayed_sigma_f[gp] * phi[gp];
-
-  if (apply_wgs_fission_src_)
-    for (size_t gp = gs_i_; gp <= gs_f_; ++gp)
-      for (const auto& precursor : precursors)
-        value += precursor.emission_spectrum[g_] *
-                 precursor.fractional_yield *
-                 nu_delayed_sigma_f[gp] * phi[gp];
-
-  return value;
+  const double rate = DelayedFissionRate(context, nu_delayed_sigma_f, phi);
+  if (rate == 0.0) return;
+
+  for (const auto& precursor : precursors)
+  {
+    const double* chi_d = precursor.emission_spectrum.data();
+    const double coeff = precursor.fractional_yield * rate;
+    for (size_t g = context.gs_i; g <= context.gs_f; ++g)
+      q[g] += chi_d[g] * coeff;
+  }
 }
 
 
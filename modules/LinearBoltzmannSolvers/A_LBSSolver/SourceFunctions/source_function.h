@@ -5,9 +5,15 @@
 
 #include "physics/PhysicsMaterial/MultiGroupXS/multigroup_xs.h"
 
+#include <map>
 #include <memory>
 #include <utility>
 
+namespace chi
+{
+class ThreadPool;
+}
+
 namespace lbs
 {
 class LBSSolver;
@@ -16,46 +22,67 @@ class LBSGroupset;
 //###################################################################
 /**Implements a customizable source function using virtual methods.
  * This base class will function well for steady simulations and kEigenvalue
- * simulations. It needs some customization for adjoint and transient.*/
+ * simulations. It needs some customization for adjoint and transient.
+ *
+ * The source function is reentrant, i.e., all the data of an application
+ * is passed around in a Context, and the cells are distributed over a
+ * thread pool when the solver option `num_sweep_threads` is larger than
+ * one. Overrides of the virtual methods are therefore called concurrently
+ * and must not modify the object.*/
 class SourceFunction
 {
+public:
+  /**Data describing a single application of the source function.*/
+  struct Context
+  {
+    bool apply_fixed_src         = false;
+    bool apply_wgs_scatter_src   = false;
+    bool apply_ags_scatter_src   = false;
+    bool apply_wgs_fission_src   = false;
+    bool apply_ags_fission_src   = false;
+    bool suppress_wg_scatter_src = false;
+
+    size_t gs_i      = 0;
+    size_t gs_f      = 0;
+    size_t first_grp = 0;
+    size_t last_grp  = 0;
+  };
+
+  typedef chi_physics::MultiGroupXS::FlatTransferMatrix GroupsetBlock;
+  /**Per-material, per-Legendre-order groupset blocks, see
+   * MakeGroupsetBlock.*/
+  typedef std::map<const chi_physics::MultiGroupXS*,
+                   std::vector<GroupsetBlock>> GroupsetBlockMap;
+
 protected:
   const LBSSolver& lbs_solver_;
-
-  bool apply_fixed_src_         = false;
-  bool apply_wgs_scatter_src_   = false;
-  bool apply_ags_scatter_src_   = false;
-  bool apply_wgs_fission_src_   = false;
-  bool apply_ags_fission_src_   = false;
-  bool suppress_wg_scatter_src_ = false;
-
-  size_t gs_i_      = 0;
-  size_t gs_f_      = 0;
-  size_t first_grp_ = 0;
-  size_t last_grp_  = 0;
-
-  double        cell_volume_       = 0.0;
-  size_t        g_                 = 0;
-  const double* fixed_src_moments_ = nullptr;
-  std::vector<double> default_zero_src_;
+  std::unique_ptr<chi::ThreadPool> thread_pool_;
 
 public:
   explicit
   SourceFunction(const LBSSolver& lbs_solver);
-  virtual ~SourceFunction() = default;
+  virtual ~SourceFunction();
 
   virtual void operator()(LBSGroupset& groupset,
                           std::vector<double>& destination_q,
                           const std::vector<double>& phi,
                           SourceFlags source_flags);
 
-  virtual double AddSourceMoments() const;
+  /**Adds the fixed source moments of the groupset's groups, i.e.,
+   * `q[g] += fixed_src_moments[g]` for every group `g` of the groupset.*/
+  virtual void AddSourceMoments(const Context& context,
+                                const double* fixed_src_moments,
+                                double* q) const;
 
   typedef std::vector<chi_physics::MultiGroupXS::Precursor> PrecursorList;
+  /**Adds the delayed fission source of the groupset's groups to `q`.*/
   virtual
-  double AddDelayedFission(const PrecursorList& precursors,
-                           const std::vector<double>& nu_delayed_sigma_f,
-                           const double* phi) const;
+  void AddDelayedFission(const Context& context,
+                         const PrecursorList& precursors,
+                         const std::vector<double>& nu_delayed_sigma_f,
+                         const double* phi,
+                         double cell_volume,
+                         double* q) const;
 
   virtual void AddAdditionalSources(LBSGroupset& groupset,
                                     std::vector<double>& destination_q,
@@ -69,6 +96,33 @@ public:
                        std::vector<double>& destination_q,
                        const std::vector<double>& phi,
                        SourceFlags source_flags);
+
+protected:
+  /**Returns the delayed fission rate
+   * \f$ \sum_{g'} \nu_d \sigma_{f,g'} \phi_{g'} \f$ over the groups
+   * selected by the fission flags of the context.*/
+  static double
+  DelayedFissionRate(const Context& context,
+                     const std::vector<double>& nu_delayed_sigma_f,
+                     const double* phi);
+
+  void AddCellSources(const Context& context,
+                      const LBSGroupset& groupset,
+                      const GroupsetBlockMap& groupset_blocks,
+                      size_t cell_begin,
+                      size_t cell_end,
+                      std::vector<double>& destination_q,
+                      const std::vector<double>& phi) const;
+
+  static GroupsetBlock MakeGroupsetBlock(const Context& context,
+                                         const chi_physics::MultiGroupXS& xs,
+                                         unsigned int ell);
+
+  static void ApplyGroupsetBlock(const GroupsetBlock& block,
+                                 size_t gs_i,
+                                 const std::vector<size_t>& dof_offsets,
+                                 const double* phi,
+                                 double* q);
 };
 
 }//namespace lbs
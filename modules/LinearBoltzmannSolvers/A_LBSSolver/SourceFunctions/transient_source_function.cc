@@ -13,10 +13,13 @@ TransientSourceFunction(const LBSSolver& lbs_solver,
 
 //###################################################################
 /**Customized delayed fission source..*/
-double lbs::TransientSourceFunction::
-AddDelayedFission(const PrecursorList &precursors,
+void lbs::TransientSourceFunction::
+AddDelayedFission(const Context& context,
+                  const PrecursorList &precursors,
                   const std::vector<double> &nu_delayed_sigma_f,
-                  const double *phi) const
+                  const double *phi,
+                  double cell_volume,
+                  double* q) const
 {
   const auto& BackwardEuler = chi_math::SteppingMethod::IMPLICIT_EULER;
   const auto& CrankNicolson = chi_math::SteppingMethod::CRANK_NICOLSON;
@@ -28,39 +31,18 @@ AddDelayedFission(const PrecursorList &precursors,
 
   const double eff_dt = theta * dt_;
 
-  double value = 0.0;
-  if (apply_ags_fission_src_)
-    for (size_t gp = first_grp_; gp <= last_grp_; ++gp)
-      if (gp < gs_i_ or gp > gs_f_)
-        for (const auto& precursor : precursors)
-        {
-          const double coeff =
-            precursor.emission_spectrum[g_] *
-            precursor.decay_constant /
-            (1.0 + eff_dt * precursor.decay_constant);
-
-          value += coeff * eff_dt *
-                   precursor.fractional_yield *
-                   nu_delayed_sigma_f[gp] *
-                   phi[gp] /
-                   cell_volume_;
-        }
-
-  if (apply_wgs_fission_src_)
-    for (size_t gp = gs_i_; gp <= gs_f_; ++gp)
-      for (const auto& precursor : precursors)
-      {
-        const double coeff =
-          precursor.emission_spectrum[g_] *
-          precursor.decay_constant /
-          (1.0 + eff_dt * precursor.decay_constant);
-
-        value += coeff * eff_dt *
-                 precursor.fractional_yield *
-                 nu_delayed_sigma_f[gp] *
-                 phi[gp] /
-                 cell_volume_;
-      }
-
-  return value;
-}
\ No newline at end of file
+  const double rate = DelayedFissionRate(context, nu_delayed_sigma_f, phi);
+  if (rate == 0.0) return;
+
+  for (const auto& precursor : precursors)
+  {
+    const double* chi_d = precursor.emission_spectrum.data();
+    const double coeff =
+      precursor.decay_constant /
+      (1.0 + eff_dt * precursor.decay_constant) *
+      eff_dt * precursor.fractional_yield * rate / cell_volume;
+
+    for (size_t g = context.gs_i; g <= context.gs_f; ++g)
+      q[g] += chi_d[g] * coeff;
+  }
+}
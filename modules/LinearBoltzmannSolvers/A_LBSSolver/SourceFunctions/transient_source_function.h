@@ -20,9 +20,12 @@ public:
                           double& ref_dt,
                           chi_math::SteppingMethod& method);
 
-  double AddDelayedFission(const PrecursorList& precursors,
-                           const std::vector<double>& nu_delayed_sigma_f,
-                           const double* phi) const override;
+  void AddDelayedFission(const Context& context,
+                         const PrecursorList& precursors,
+                         const std::vector<double>& nu_delayed_sigma_f,
+                         const double* phi,
+                         double cell_volume,
+                         double* q) const override;
 };
 
 }//namespace lbs
@@ -0,0 +1,319 @@
+#include "lbs_angular_flux_store.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include <vtk_zlib.h>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace lbs
+{
+
+//###################################################################
+/**Allocates the storage for the given mode.*/
+AngularFluxStore::AngularFluxStore(AngularFluxStorageMode mode,
+                                   size_t size,
+                                   const std::string& spill_folder)
+  : mode_(mode), size_(size)
+{
+  switch (mode_)
+  {
+    case AngularFluxStorageMode::DOUBLE:
+      doubles_.assign(size_, 0.0);
+      break;
+    case AngularFluxStorageMode::SINGLE:
+      floats_.assign(size_, 0.0f);
+      break;
+    case AngularFluxStorageMode::COMPRESSED:
+      blocks_.resize((size_ + BLOCK_SIZE - 1) / BLOCK_SIZE);
+      cache_mutex_ = std::make_unique<std::mutex>();
+      cache_.assign(BLOCK_SIZE, 0.0);
+      break;
+    case AngularFluxStorageMode::MAPPED:
+    {
+      if (size_ == 0) break;
+
+      std::string file_name = spill_folder + "/chi_psi_XXXXXX";
+      const int fd = mkstemp(file_name.data());
+      ChiLogicalErrorIf(fd < 0, "Failed to create an angular flux spill file "
+                                "in folder \"" + spill_folder + "\".");
+
+      // The file is only reachable through the mapping from here on, the
+      // operating system reclaims it when the mapping is removed.
+      unlink(file_name.c_str());
+
+      const size_t num_bytes = size_ * sizeof(double);
+      void* mapped = MAP_FAILED;
+      if (ftruncate(fd, static_cast<off_t>(num_bytes)) == 0)
+        mapped = mmap(nullptr, num_bytes, PROT_READ | PROT_WRITE, MAP_SHARED,
+                      fd, 0);
+      close(fd);
+
+      ChiLogicalErrorIf(mapped == MAP_FAILED,
+                        "Failed to map an angular flux spill file of " +
+                        std::to_string(num_bytes) + " bytes in folder \"" +
+                        spill_folder + "\".");
+      mapped_ = static_cast<double*>(mapped);
+      break;
+    }
+  }
+}
+
+//###################################################################
+/**Unmaps the spill file, if any.*/
+AngularFluxStore::~AngularFluxStore()
+{
+  if (mapped_ != nullptr) munmap(mapped_, size_ * sizeof(double));
+}
+
+//###################################################################
+AngularFluxStore::AngularFluxStore(AngularFluxStore&& other) noexcept
+{
+  *this = std::move(other);
+}
+
+//###################################################################
+AngularFluxStore& AngularFluxStore::operator=(AngularFluxStore&& other) noexcept
+{
+  if (this == &other) return *this;
+
+  std::swap(mode_, other.mode_);
+  std::swap(size_, other.size_);
+  std::swap(doubles_, other.doubles_);
+  std::swap(floats_, other.floats_);
+  std::swap(mapped_, other.mapped_);
+  std::swap(blocks_, other.blocks_);
+  std::swap(cache_mutex_, other.cache_mutex_);
+  std::swap(cached_block_, other.cached_block_);
+  std::swap(cache_valid_, other.cache_valid_);
+  std::swap(cache_, other.cache_);
+
+  return *this;
+}
+
+//###################################################################
+/**Returns the number of bytes of the values held in memory.*/
+size_t AngularFluxStore::MemoryFootprint() const
+{
+  size_t num_bytes = doubles_.size() * sizeof(double) +
+                     floats_.size() * sizeof(float) +
+                     cache_.size() * sizeof(double);
+  for (const auto& block : blocks_)
+    num_bytes += block.size();
+
+  return num_bytes;
+}
+
+//###################################################################
+/**Decompresses a block into the cache. The cache mutex must be held.*/
+void AngularFluxStore::LoadBlock(size_t block) const
+{
+  if (cache_valid_ and cached_block_ == block) return;
+
+  const size_t block_size = std::min(BLOCK_SIZE, size_ - block * BLOCK_SIZE);
+  const auto& data = blocks_[block];
+  uLongf num_bytes = block_size * sizeof(double);
+
+  if (data.empty())
+    std::fill_n(cache_.begin(), block_size, 0.0);
+  else if (data.size() == num_bytes)
+    memcpy(cache_.data(), data.data(), num_bytes);
+  else
+  {
+    const int status = uncompress(reinterpret_cast<Bytef*>(cache_.data()),
+                                  &num_bytes,
+                                  data.data(),
+                                  data.size());
+    ChiLogicalErrorIf(status != Z_OK, "Corrupt angular flux block.");
+  }
+
+  cached_block_ = block;
+  cache_valid_ = true;
+}
+
+//###################################################################
+/**Compresses the values of a block. Blocks of zeros are not stored and
+ * blocks that do not compress are stored as is. The cache mutex must be
+ * held.*/
+void AngularFluxStore::CompressBlock(size_t block, const double* values)
+{
+  const size_t block_size = std::min(BLOCK_SIZE, size_ - block * BLOCK_SIZE);
+  const uLong raw_num_bytes = block_size * sizeof(double);
+  auto& data = blocks_[block];
+
+  if (std::all_of(values, values + block_size,
+                  [](double value) { return value == 0.0; }))
+  {
+    std::vector<unsigned char>().swap(data);
+    return;
+  }
+
+  std::vector<unsigned char> buffer(compressBound(raw_num_bytes));
+  uLongf num_bytes = buffer.size();
+  const int status = compress2(buffer.data(), &num_bytes,
+                               reinterpret_cast<const Bytef*>(values),
+                               raw_num_bytes, Z_BEST_SPEED);
+
+  // Copying to a new vector sheds the excess capacity
+  if (status == Z_OK and num_bytes < raw_num_bytes)
+    data.assign(buffer.begin(),
+                buffer.begin() + static_cast<ptrdiff_t>(num_bytes));
+  else
+    data.assign(reinterpret_cast<const unsigned char*>(values),
+                reinterpret_cast<const unsigned char*>(values) +
+                  raw_num_bytes);
+}
+
+//###################################################################
+/**Copies `count` values starting at `offset` into `values`.*/
+void AngularFluxStore::Load(size_t offset, size_t count, double* values) const
+{
+  ChiInvalidArgumentIf(offset + count > size_, "Range out of bounds.");
+
+  switch (mode_)
+  {
+    case AngularFluxStorageMode::DOUBLE:
+      std::copy_n(doubles_.begin() + static_cast<ptrdiff_t>(offset), count,
+                  values);
+      break;
+    case AngularFluxStorageMode::SINGLE:
+      std::copy_n(floats_.begin() + static_cast<ptrdiff_t>(offset), count,
+                  values);
+      break;
+    case AngularFluxStorageMode::MAPPED:
+      std::copy_n(mapped_ + offset, count, values);
+      break;
+    case AngularFluxStorageMode::COMPRESSED:
+    {
+      std::lock_guard<std::mutex> lock(*cache_mutex_);
+      size_t i = offset;
+      while (i < offset + count)
+      {
+        const size_t block = i / BLOCK_SIZE;
+        const size_t block_begin = block * BLOCK_SIZE;
+        const size_t n = std::min(offset + count, block_begin + BLOCK_SIZE) - i;
+
+        LoadBlock(block);
+        std::copy_n(cache_.begin() + static_cast<ptrdiff_t>(i - block_begin),
+                    n, values + (i - offset));
+        i += n;
+      }
+      break;
+    }
+  }
+}
+
+//###################################################################
+/**Copies `count` values from `values` into the store starting at
+ * `offset`.*/
+void AngularFluxStore::Store(size_t offset, size_t count, const double* values)
+{
+  ChiInvalidArgumentIf(offset + count > size_, "Range out of bounds.");
+
+  switch (mode_)
+  {
+    case AngularFluxStorageMode::DOUBLE:
+      std::copy_n(values, count,
+                  doubles_.begin() + static_cast<ptrdiff_t>(offset));
+      break;
+    case AngularFluxStorageMode::SINGLE:
+      std::transform(values, values + count,
+                     floats_.begin() + static_cast<ptrdiff_t>(offset),
+                     [](double value) { return static_cast<float>(value); });
+      break;
+    case AngularFluxStorageMode::MAPPED:
+      std::copy_n(values, count, mapped_ + offset);
+      break;
+    case AngularFluxStorageMode::COMPRESSED:
+    {
+      std::lock_guard<std::mutex> lock(*cache_mutex_);
+      size_t i = offset;
+      while (i < offset + count)
+      {
+        const size_t block = i / BLOCK_SIZE;
+        const size_t block_begin = block * BLOCK_SIZE;
+        const size_t block_size = std::min(BLOCK_SIZE, size_ - block_begin);
+        const size_t n = std::min(offset + count, block_begin + block_size) - i;
+        const double* block_values = values + (i - offset);
+
+        // Whole blocks are compressed directly, partial blocks are
+        // updated in the cache first
+        if (n == block_size)
+        {
+          if (cache_valid_ and cached_block_ == block) cache_valid_ = false;
+          CompressBlock(block, block_values);
+        }
+        else
+        {
+          LoadBlock(block);
+          std::copy_n(block_values, n,
+                      cache_.begin() + static_cast<ptrdiff_t>(i - block_begin));
+          CompressBlock(block, cache_.data());
+        }
+        i += n;
+      }
+      break;
+    }
+  }
+}
+
+//###################################################################
+/**Returns a single value.*/
+double AngularFluxStore::Get(size_t index) const
+{
+  switch (mode_)
+  {
+    case AngularFluxStorageMode::DOUBLE: return doubles_[index];
+    case AngularFluxStorageMode::SINGLE: return floats_[index];
+    case AngularFluxStorageMode::MAPPED: return mapped_[index];
+    default:
+    {
+      double value;
+      Load(index, 1, &value);
+      return value;
+    }
+  }
+}
+
+//###################################################################
+/**Sets the values from a vector of the same size.*/
+void AngularFluxStore::Assign(const std::vector<double>& values)
+{
+  ChiInvalidArgumentIf(values.size() != size_, "Size mismatch.");
+  Store(0, size_, values.data());
+}
+
+//###################################################################
+/**Sets the values from another store of the same size, one block at a
+ * time.*/
+void AngularFluxStore::Assign(const AngularFluxStore& other)
+{
+  ChiInvalidArgumentIf(other.size_ != size_, "Size mismatch.");
+
+  std::vector<double> buffer(std::min(BLOCK_SIZE, size_), 0.0);
+  for (size_t offset = 0; offset < size_; offset += BLOCK_SIZE)
+  {
+    const size_t count = std::min(BLOCK_SIZE, size_ - offset);
+    other.Load(offset, count, buffer.data());
+    Store(offset, count, buffer.data());
+  }
+}
+
+//###################################################################
+/**Sets all the values to zero.*/
+void AngularFluxStore::SetZero()
+{
+  std::fill(doubles_.begin(), doubles_.end(), 0.0);
+  std::fill(floats_.begin(), floats_.end(), 0.0f);
+  if (mapped_ != nullptr) std::fill_n(mapped_, size_, 0.0);
+  for (auto& block : blocks_)
+    std::vector<unsigned char>().swap(block);
+  cache_valid_ = false;
+}
+
+} // namespace lbs
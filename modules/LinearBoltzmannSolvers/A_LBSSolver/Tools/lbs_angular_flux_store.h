@@ -0,0 +1,88 @@
+#ifndef CHITECH_LBS_ANGULAR_FLUX_STORE_H
+#define CHITECH_LBS_ANGULAR_FLUX_STORE_H
+
+#include "A_LBSSolver/lbs_structs.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace lbs
+{
+
+/**Array of angular flux values held according to an
+ * AngularFluxStorageMode. Values are exchanged in double precision through
+ * Load and Store, regardless of how they are held.
+
+Stores to disjoint ranges can be made concurrently for all modes except
+`COMPRESSED`. In `COMPRESSED` mode the values are held in blocks of
+`BLOCK_SIZE` values, each compressed losslessly, and partial updates of a
+block require decompressing and recompressing it. This mode is therefore
+meant for copies that are assigned in bulk and read back, not for the
+destination of a sweep.*/
+class AngularFluxStore
+{
+public:
+  static constexpr size_t BLOCK_SIZE = 4096;
+
+private:
+  AngularFluxStorageMode mode_ = AngularFluxStorageMode::DOUBLE;
+  size_t size_ = 0;
+
+  std::vector<double> doubles_;
+  std::vector<float> floats_;
+
+  double* mapped_ = nullptr;
+
+  /**Compressed blocks. An empty block holds only zeros.*/
+  std::vector<std::vector<unsigned char>> blocks_;
+  mutable std::unique_ptr<std::mutex> cache_mutex_;
+  mutable size_t cached_block_ = 0;
+  mutable bool cache_valid_ = false;
+  mutable std::vector<double> cache_;
+
+public:
+  AngularFluxStore() = default;
+  /**Creates a store of `size` zeros. Files backing `MAPPED` storage are
+   * created in `spill_folder` and removed once mapped.*/
+  AngularFluxStore(AngularFluxStorageMode mode,
+                   size_t size,
+                   const std::string& spill_folder = ".");
+  ~AngularFluxStore();
+
+  AngularFluxStore(AngularFluxStore&& other) noexcept;
+  AngularFluxStore& operator=(AngularFluxStore&& other) noexcept;
+  AngularFluxStore(const AngularFluxStore&) = delete;
+  AngularFluxStore& operator=(const AngularFluxStore&) = delete;
+
+  AngularFluxStorageMode Mode() const { return mode_; }
+  size_t Size() const { return size_; }
+  bool Empty() const { return size_ == 0; }
+
+  /**Returns the number of bytes of the values held in memory, excluding
+   * pages of a `MAPPED` store.*/
+  size_t MemoryFootprint() const;
+
+  /**Copies `count` values starting at `offset` into `values`.*/
+  void Load(size_t offset, size_t count, double* values) const;
+  /**Copies `count` values from `values` into the store starting at
+   * `offset`.*/
+  void Store(size_t offset, size_t count, const double* values);
+  /**Returns a single value.*/
+  double Get(size_t index) const;
+
+  /**Sets the values from a vector of the same size.*/
+  void Assign(const std::vector<double>& values);
+  /**Sets the values from another store of the same size.*/
+  void Assign(const AngularFluxStore& other);
+  void SetZero();
+
+private:
+  void LoadBlock(size_t block) const;
+  void CompressBlock(size_t block, const double* values);
+};
+
+} // namespace lbs
+
+#endif // CHITECH_LBS_ANGULAR_FLUX_STORE_H
@@ -0,0 +1,275 @@
+#include "lbs_nodal_data_file.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include <vtk_zlib.h>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <cstring>
+
+namespace lbs
+{
+
+namespace
+{
+/**Identifies a nodal data file. Bump the version whenever the layout
+ * changes.*/
+constexpr uint64_t NODAL_DATA_FILE_MAGIC = 0x31304e5444494843; // CHIDTN01
+
+constexpr size_t DESCRIPTION_SIZE = 64;
+
+template <typename T>
+void WriteArray(std::ofstream& file, const T* data, size_t count)
+{
+  file.write(reinterpret_cast<const char*>(data),
+             static_cast<std::streamsize>(count * sizeof(T)));
+}
+} // namespace
+
+//###################################################################
+/**Writes the values in chunks of one component and group. The values of
+ * a component are transposed to group-major order in one pass, after which
+ * each of its chunks is written with a single call.*/
+bool NodalDataFile::Write(const std::string& file_name,
+                          const Layout& layout,
+                          const std::vector<double>& values,
+                          bool compress)
+{
+  const uint64_t num_nodes = layout.NumNodes();
+  const uint64_t num_components = layout.num_components;
+  const uint64_t num_groups = layout.num_groups;
+  const uint64_t num_cells = layout.cell_global_ids.size();
+
+  ChiInvalidArgumentIf(
+    values.size() != num_nodes * num_components * num_groups or
+      layout.cell_num_nodes.size() != num_cells,
+    "Values or cell table inconsistent with the layout.");
+
+  std::ofstream file(file_name,
+                     std::ofstream::binary | //binary file
+                     std::ofstream::out |    //no accidental reading
+                     std::ofstream::trunc);  //clear file contents when opened
+  if (not file.is_open()) return false;
+
+  //============================================= Write header
+  char description[DESCRIPTION_SIZE];
+  memset(description, ' ', DESCRIPTION_SIZE);
+  const std::string description_text =
+    "Chi-Tech LinearBoltzmann: Nodal data file\n";
+  memcpy(description, description_text.c_str(), description_text.size());
+  description[DESCRIPTION_SIZE - 1] = '\n';
+  file.write(description, DESCRIPTION_SIZE);
+
+  const uint64_t header[] = {NODAL_DATA_FILE_MAGIC,
+                             static_cast<uint64_t>(layout.content),
+                             num_nodes,
+                             num_components,
+                             num_groups,
+                             num_cells};
+  WriteArray(file, header, 6);
+
+  //============================================= Write cell table
+  WriteArray(file, layout.cell_global_ids.data(), num_cells);
+  WriteArray(file, layout.cell_num_nodes.data(), num_cells);
+
+  std::vector<double> node_locations;
+  node_locations.reserve(3 * num_nodes);
+  for (const auto& node : layout.node_locations)
+  {
+    node_locations.push_back(node.x);
+    node_locations.push_back(node.y);
+    node_locations.push_back(node.z);
+  }
+  WriteArray(file, node_locations.data(), node_locations.size());
+
+  //============================================= Reserve chunk index
+  const uint64_t num_chunks = num_components * num_groups;
+  std::vector<uint64_t> chunk_index(2 * num_chunks, 0);
+  const auto index_position = file.tellp();
+  WriteArray(file, chunk_index.data(), chunk_index.size());
+
+  //============================================= Write chunks
+  auto offset = static_cast<uint64_t>(file.tellp());
+  const uint64_t raw_num_bytes = num_nodes * sizeof(double);
+
+  std::vector<double> component_values(num_groups * num_nodes, 0.0);
+  std::vector<Bytef> compressed;
+  for (uint64_t c = 0; c < num_components; ++c)
+  {
+    for (uint64_t n = 0; n < num_nodes; ++n)
+    {
+      const double* node_values = &values[(n * num_components + c) * num_groups];
+      for (uint64_t g = 0; g < num_groups; ++g)
+        component_values[g * num_nodes + n] = node_values[g];
+    }
+
+    for (uint64_t g = 0; g < num_groups; ++g)
+    {
+      const auto* chunk =
+        reinterpret_cast<const char*>(&component_values[g * num_nodes]);
+      uint64_t num_bytes = raw_num_bytes;
+
+      if (compress and num_nodes > 0)
+      {
+        uLongf compressed_size = compressBound(raw_num_bytes);
+        compressed.resize(compressed_size);
+        if (compress2(compressed.data(), &compressed_size,
+                      reinterpret_cast<const Bytef*>(chunk), raw_num_bytes,
+                      Z_BEST_SPEED) == Z_OK and
+            compressed_size < raw_num_bytes)
+        {
+          chunk = reinterpret_cast<const char*>(compressed.data());
+          num_bytes = compressed_size;
+        }
+      }
+
+      file.write(chunk, static_cast<std::streamsize>(num_bytes));
+
+      chunk_index[2 * (c * num_groups + g)] = offset;
+      chunk_index[2 * (c * num_groups + g) + 1] = num_bytes;
+      offset += num_bytes;
+    } // for g
+  }   // for c
+
+  //============================================= Write chunk index
+  file.seekp(index_position);
+  WriteArray(file, chunk_index.data(), chunk_index.size());
+
+  return static_cast<bool>(file);
+}
+
+//###################################################################
+/**Maps the file into memory and reads the header, the cell table and the
+ * chunk index. The chunks are only read on demand.*/
+NodalDataFile::NodalDataFile(const std::string& file_name)
+{
+  const int fd = open(file_name.c_str(), O_RDONLY);
+  if (fd < 0) return;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 or st.st_size == 0)
+  {
+    close(fd);
+    return;
+  }
+
+  const auto file_size = static_cast<size_t>(st.st_size);
+  void* mapped = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapped == MAP_FAILED) return;
+
+  const auto* data = static_cast<const std::byte*>(mapped);
+
+  //============================================= Sequential reader that
+  //                                              checks the bounds
+  size_t address = DESCRIPTION_SIZE;
+  bool valid = address <= file_size;
+  auto ReadArray = [&](auto* destination, size_t count)
+  {
+    const size_t num_bytes = count * sizeof(*destination);
+    if (not valid or address + num_bytes > file_size)
+    {
+      valid = false;
+      return;
+    }
+    memcpy(destination, data + address, num_bytes);
+    address += num_bytes;
+  };
+
+  uint64_t header[6] = {0, 0, 0, 0, 0, 0};
+  ReadArray(header, 6);
+  valid &= header[0] == NODAL_DATA_FILE_MAGIC;
+
+  const uint64_t num_nodes = header[2];
+  const uint64_t num_cells = header[5];
+  const uint64_t num_chunks = header[3] * header[4];
+  valid &= num_nodes <= file_size and num_cells <= file_size and
+           num_chunks <= file_size;
+
+  if (valid)
+  {
+    layout_.content = static_cast<Content>(header[1]);
+    layout_.num_components = header[3];
+    layout_.num_groups = header[4];
+
+    layout_.cell_global_ids.resize(num_cells);
+    layout_.cell_num_nodes.resize(num_cells);
+    ReadArray(layout_.cell_global_ids.data(), num_cells);
+    ReadArray(layout_.cell_num_nodes.data(), num_cells);
+
+    std::vector<double> node_locations(3 * num_nodes, 0.0);
+    ReadArray(node_locations.data(), node_locations.size());
+    layout_.node_locations.reserve(num_nodes);
+    for (uint64_t n = 0; n < num_nodes; ++n)
+      layout_.node_locations.emplace_back(node_locations[3 * n],
+                                          node_locations[3 * n + 1],
+                                          node_locations[3 * n + 2]);
+
+    chunk_index_.resize(2 * num_chunks);
+    ReadArray(chunk_index_.data(), chunk_index_.size());
+  }
+
+  for (uint64_t k = 0; valid and k < num_chunks; ++k)
+    valid = chunk_index_[2 * k] + chunk_index_[2 * k + 1] <= file_size;
+
+  if (not valid)
+  {
+    munmap(mapped, file_size);
+    layout_ = Layout();
+    chunk_index_.clear();
+    return;
+  }
+
+  mapped_data_ = data;
+  mapped_size_ = file_size;
+}
+
+//###################################################################
+/**Unmaps the file.*/
+NodalDataFile::~NodalDataFile()
+{
+  if (mapped_data_ != nullptr)
+    munmap(const_cast<std::byte*>(mapped_data_), mapped_size_);
+}
+
+//###################################################################
+/**Reads the values of all the nodes for a single component and group,
+ * decompressing the chunk if required.*/
+std::vector<double> NodalDataFile::ReadChunk(uint64_t component,
+                                             uint64_t group) const
+{
+  ChiLogicalErrorIf(not IsOpen(), "The file is not open.");
+  ChiInvalidArgumentIf(component >= layout_.num_components or
+                         group >= layout_.num_groups,
+                       "Component or group out of range.");
+
+  const uint64_t k = component * layout_.num_groups + group;
+  const std::byte* chunk = mapped_data_ + chunk_index_[2 * k];
+  const uint64_t num_bytes = chunk_index_[2 * k + 1];
+
+  std::vector<double> values(layout_.NumNodes(), 0.0);
+  uLongf raw_num_bytes = values.size() * sizeof(double);
+
+  if (num_bytes == raw_num_bytes)
+    memcpy(values.data(), chunk, raw_num_bytes);
+  else
+  {
+    const int status = uncompress(reinterpret_cast<Bytef*>(values.data()),
+                                  &raw_num_bytes,
+                                  reinterpret_cast<const Bytef*>(chunk),
+                                  num_bytes);
+    ChiLogicalErrorIf(status != Z_OK or
+                        raw_num_bytes != values.size() * sizeof(double),
+                      "Corrupt chunk in nodal data file.");
+  }
+
+  return values;
+}
+
+} // namespace lbs
@@ -0,0 +1,92 @@
+#ifndef CHITECH_LBS_NODAL_DATA_FILE_H
+#define CHITECH_LBS_NODAL_DATA_FILE_H
+
+#include "mesh/chi_mesh.h"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace lbs
+{
+
+/**Binary file holding nodal data with `num_components x num_groups` values
+ * per node, e.g., flux moments or angular fluxes.
+
+The file starts with a fixed header and the table of the cells, i.e., their
+global ids, number of nodes and node locations. The values follow in
+chunks, one per component and group, holding the value of every node in
+cell order. A chunk index stores the offset and size of each chunk so that a
+single component/group can be read without touching the rest of the file.
+Chunks can optionally be compressed losslessly with zlib, in which case a
+chunk is only stored compressed if that makes it smaller.
+
+Structure(type-info):
+\verbatim
+char[64]  description
+uint64_t  magic number
+uint64_t  content tag
+uint64_t  num_nodes
+uint64_t  num_components
+uint64_t  num_groups
+uint64_t  num_cells
+uint64_t  cell_global_ids[num_cells]
+uint64_t  cell_num_nodes[num_cells]
+double    node_locations[num_nodes][3]
+uint64_t  chunk_index[num_components][num_groups][2] (offset, num_bytes)
+chunks
+\endverbatim*/
+class NodalDataFile
+{
+public:
+  /**Identifies the type of content of a file.*/
+  enum class Content : uint64_t
+  {
+    FLUX_MOMENTS = 1,
+    ANGULAR_FLUXES = 2
+  };
+
+  struct Layout
+  {
+    Content content = Content::FLUX_MOMENTS;
+    uint64_t num_components = 0;
+    uint64_t num_groups = 0;
+    std::vector<uint64_t> cell_global_ids;
+    std::vector<uint64_t> cell_num_nodes;
+    std::vector<chi_mesh::Vector3> node_locations;
+
+    uint64_t NumNodes() const { return node_locations.size(); }
+  };
+
+  /**Writes a file. The values are ordered [node][component][group] with the
+   * nodes in the order of the cell table. Returns false if the file could
+   * not be written.*/
+  static bool Write(const std::string& file_name,
+                    const Layout& layout,
+                    const std::vector<double>& values,
+                    bool compress);
+
+private:
+  Layout layout_;
+  std::vector<uint64_t> chunk_index_;
+  const std::byte* mapped_data_ = nullptr;
+  size_t mapped_size_ = 0;
+
+public:
+  /**Memory maps a file for reading. Check IsOpen before reading.*/
+  explicit NodalDataFile(const std::string& file_name);
+  ~NodalDataFile();
+
+  NodalDataFile(const NodalDataFile&) = delete;
+  NodalDataFile& operator=(const NodalDataFile&) = delete;
+
+  bool IsOpen() const { return mapped_data_ != nullptr; }
+  const Layout& GetLayout() const { return layout_; }
+
+  /**Reads the values of all the nodes for a single component and group.*/
+  std::vector<double> ReadChunk(uint64_t component, uint64_t group) const;
+};
+
+} // namespace lbs
+
+#endif // CHITECH_LBS_NODAL_DATA_FILE_H
@@ -76,6 +76,9 @@ LBSSolver::LBSSolver(const chi::InputParameters& params)
   }
 }
 
+/**Completes a restart write still in progress.*/
+LBSSolver::~LBSSolver() { FinishRestartDataWrite(); }
+
 /**Returns the source event tag used for logging the time it
  * takes to set source moments.*/
 size_t LBSSolver::GetSourceEventTag() const { return source_event_tag_; }
@@ -38,6 +38,21 @@ chi::InputParameters LBSSolver::OptionsBlock()
   "on the given platform will start to suffer. One can gain a small amount of"
   "parallel efficiency by lowering this limit, however, there is a point where"
   "the parallel efficiency will actually get worse so use with caution.");
+  params.AddOptionalParameter("num_sweep_threads",1,
+  "Number of threads used during a sweep. Communication remains on the main "
+  "thread. For the `\"AAH\"` sweep type whole anglesets execute "
+  "concurrently, however, only anglesets of different group subsets, "
+  "therefore values larger than the number of group subsets give no further "
+  "benefit. For the `\"CBC\"` sweep type the cells of an angleset are "
+  "swept concurrently. The same number of threads is used to evaluate the "
+  "source function over the local cells.");
+  params.AddOptionalParameter("sweep_metadata_memory_budget_mb",0.0,
+  "Memory budget, in megabytes per process, of the cache storing sweep data "
+  "that does not change between sweeps, e.g., streaming matrices, upwind face "
+  "lists and face-node maps. The data is precomputed per angleset for as "
+  "many anglesets as the budget allows, the budget being split evenly "
+  "between the groupsets. Only used by the `\"AAH\"` sweep type. A value of "
+  "zero disables the cache.");
   params.AddOptionalParameter("read_restart_data",false,
   "Flag indicating whether restart data is to be read.");
   params.AddOptionalParameter("read_restart_folder_name","YRestart",
@@ -51,7 +66,9 @@ chi::InputParameters LBSSolver::OptionsBlock()
   params.AddOptionalParameter("write_restart_file_base","restart",
   "File base name to use when writing restart data.");
   params.AddOptionalParameter("write_restart_interval",30.0,
-  "Interval at which restart data is to be written. Currently not implemented.");
+  "Interval, in minutes, at which restart data is written in the background "
+  "during within-group iterations. The data is also written at the end of "
+  "a steady state solve.");
   params.AddOptionalParameter("use_precursors",false,
   "Flag for using delayed neutron precursors.");
   params.AddOptionalParameter("use_source_moments",false,
@@ -59,6 +76,23 @@ chi::InputParameters LBSSolver::OptionsBlock()
   "obtained elsewhere.");
   params.AddOptionalParameter("save_angular_flux",false,
   "Flag indicating whether angular fluxes are to be stored or not.");
+  params.AddOptionalParameter("angular_flux_storage","double",
+  "How the angular fluxes written by the sweeps are stored. `\"double\"` "
+  "stores them in a plain double precision array. `\"single\"` stores them "
+  "in single precision, halving the memory required, while the sweeps still "
+  "compute and accumulate in double precision. `\"mapped\"` stores them in "
+  "double precision in a file mapped into memory, see "
+  "`angular_flux_spill_folder`, so that the operating system can page them "
+  "out. Only `\"double\"` is supported by the `\"CBC\"` sweep type.");
+  params.AddOptionalParameter("retained_angular_flux_storage","double",
+  "How copies of the angular fluxes that are retained between solves, e.g., "
+  "the angular fluxes of the previous time step, are stored. Accepts the "
+  "values of `angular_flux_storage` as well as `\"compressed\"` which "
+  "stores blocks of the angular fluxes losslessly compressed.");
+  params.AddOptionalParameter("angular_flux_spill_folder",".",
+  "Folder in which the files backing `\"mapped\"` angular flux storage are "
+  "created. The files are removed as soon as they are mapped. Preferably a "
+  "node-local file system.");
   params.AddOptionalParameter("verbose_inner_iterations",true,
   "Flag to control verbosity of inner iterations.");
   params.AddOptionalParameter("verbose_outer_iterations",true,
@@ -101,6 +135,18 @@ chi::InputParameters LBSSolver::OptionsBlock()
   params.ConstrainParameterRange("spatial_discretization",
       AllowableRangeList::New({"pwld"}));
 
+  params.ConstrainParameterRange("num_sweep_threads",
+    AllowableRangeLowLimit::New(1));
+
+  params.ConstrainParameterRange("sweep_metadata_memory_budget_mb",
+    AllowableRangeLowLimit::New(0.0));
+
+  params.ConstrainParameterRange("angular_flux_storage",
+    AllowableRangeList::New({"double", "single", "mapped"}));
+
+  params.ConstrainParameterRange("retained_angular_flux_storage",
+    AllowableRangeList::New({"double", "single", "compressed", "mapped"}));
+
   params.ConstrainParameterRange("field_function_prefix_option",
     AllowableRangeList::New({"prefix", "solver_name"}));
   // clang-format on
@@ -170,6 +216,12 @@ void LBSSolver::SetOptions(const chi::InputParameters& params)
     else if (spec.Name() == "sweep_eager_limit")
       Options().sweep_eager_limit = spec.GetValue<int>();
 
+    else if (spec.Name() == "num_sweep_threads")
+      Options().num_sweep_threads = spec.GetValue<int>();
+
+    else if (spec.Name() == "sweep_metadata_memory_budget_mb")
+      Options().sweep_metadata_memory_budget_mb = spec.GetValue<double>();
+
     else if (spec.Name() == "read_restart_data")
       Options().read_restart_data = spec.GetValue<bool>();
 
@@ -204,6 +256,17 @@ void LBSSolver::SetOptions(const chi::InputParameters& params)
     else if (spec.Name() == "save_angular_flux")
       Options().save_angular_flux = spec.GetValue<bool>();
 
+    else if (spec.Name() == "angular_flux_storage")
+      Options().angular_flux_storage =
+        MapAngularFluxStorageMode(spec.GetValue<std::string>());
+
+    else if (spec.Name() == "retained_angular_flux_storage")
+      Options().retained_angular_flux_storage =
+        MapAngularFluxStorageMode(spec.GetValue<std::string>());
+
+    else if (spec.Name() == "angular_flux_spill_folder")
+      Options().angular_flux_spill_folder = spec.GetValue<std::string>();
+
     else if (spec.Name() == "verbose_inner_iterations")
       Options().verbose_inner_iterations = spec.GetValue<bool>();
 
@@ -44,18 +44,41 @@ void lbs::LBSSolver::InitializeParrays()
   phi_new_local_.assign(local_unknown_count, 0.0);
 
   //============================================= Setup groupset psi vectors
+  // Angular fluxes are either held in psi_new_local_ or, for the other
+  // storage modes, in psi_new_stores_
+  const auto psi_storage = options_.angular_flux_storage;
+  ChiInvalidArgumentIf(psi_storage == AngularFluxStorageMode::COMPRESSED,
+                       "Compressed storage is only supported for retained "
+                       "angular fluxes.");
+
   psi_new_local_.clear();
+  psi_new_stores_.clear();
+  size_t psi_memory_footprint = 0;
   for (auto& groupset : groupsets_)
   {
     psi_new_local_.emplace_back();
+    psi_new_stores_.emplace_back();
     if (options_.save_angular_flux)
     {
       size_t num_ang_unknowns =
         discretization_->GetNumLocalDOFs(groupset.psi_uk_man_);
-      psi_new_local_.back().assign(num_ang_unknowns, 0.0);
+      if (psi_storage == AngularFluxStorageMode::DOUBLE)
+        psi_new_local_.back().assign(num_ang_unknowns, 0.0);
+      else
+        psi_new_stores_.back() =
+          AngularFluxStore(psi_storage, num_ang_unknowns,
+                           options_.angular_flux_spill_folder);
+
+      psi_memory_footprint += psi_new_local_.back().size() * sizeof(double) +
+                              psi_new_stores_.back().MemoryFootprint();
     }
   }
 
+  if (options_.save_angular_flux)
+    Chi::log.LogAllVerbose1()
+      << "LBS Angular flux memory: "
+      << static_cast<double>(psi_memory_footprint) / 1024.0 / 1024.0 << " MB";
+
   //============================================= Setup precursor vector
   if (options_.use_precursors)
   {
@@ -164,6 +187,7 @@ void lbs::LBSSolver::InitializeParrays()
   //================================================== Populate grid nodal
   // mappings
   // This is used in the Flux Data Structures (FLUDS)
+  const auto& face_adjacency = grid_ptr_->GetFaceAdjacency();
   grid_nodal_mappings_.clear();
   grid_nodal_mappings_.reserve(grid_ptr_->local_cells.size());
   for (auto& cell : grid_ptr_->local_cells)
@@ -171,22 +195,11 @@ void lbs::LBSSolver::InitializeParrays()
     chi_mesh::sweep_management::CellFaceNodalMapping cell_nodal_mapping;
     cell_nodal_mapping.reserve(cell.faces_.size());
 
-    for (auto& face : cell.faces_)
-    {
-      std::vector<short> face_node_mapping;
-      std::vector<short> cell_node_mapping;
-      int ass_face = -1;
-
-      if (face.has_neighbor_)
-      {
-        grid_ptr_->FindAssociatedVertices(face, face_node_mapping);
-        grid_ptr_->FindAssociatedCellVertices(face, cell_node_mapping);
-        ass_face = face.GetNeighborAssociatedFace(*grid_ptr_);
-      }
-
+    for (unsigned int f = 0; f < cell.faces_.size(); ++f)
       cell_nodal_mapping.emplace_back(
-        ass_face, face_node_mapping, cell_node_mapping);
-    } // for f
+        face_adjacency.AssociatedFace(cell.local_id_, f),
+        face_adjacency.FaceVertexMapping(cell.local_id_, f),
+        face_adjacency.CellVertexMapping(cell.local_id_, f));
 
     grid_nodal_mappings_.push_back(cell_nodal_mapping);
   } // for local cell
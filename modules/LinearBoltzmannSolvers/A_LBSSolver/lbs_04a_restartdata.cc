@@ -1,168 +1,665 @@
 #include "lbs_solver.h"
 
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+#include "math/SpatialDiscretization/SpatialDiscretization.h"
+
+#include "data_types/byte_array.h"
+
+#include "mpi/chi_mpi_utils_map_all2all.h"
+
 #include "chi_runtime.h"
 #include "chi_log.h"
 #include "chi_mpi.h"
+#include "utils/chi_timer.h"
 
 #include <sys/stat.h>
-#include <fstream>
-#include <cstring>
+#include <cerrno>
+#include <limits>
+
+// The restart data of all the locations is stored in a single file,
+// "<folder>/<file_base>.restart", written with collective MPI-IO. It starts
+// with a header holding the layout of the unknowns and a table of blocks,
+// followed by one block per writing location. The table holds, per block,
+// its offset, its number of cells, its size and a digest of its cell global
+// ids. A block is a sequence of cell records:
+//   uint64 cell global id, uint64 number of nodes,
+//   phi_old     [node][moment][group],
+//   psi         [node][angle][group] of every groupset with stored psi,
+//   precursors  [precursor].
+// Because every record carries its cell's global id, the data can be read
+// back on any number of locations.
+
+namespace lbs
+{
+
+namespace
+{
+/**Identifies a restart file. Bump the version whenever the layout
+ * changes.*/
+constexpr uint64_t RESTART_FILE_MAGIC = 0x3230545352494843; // CHIRST02
+
+/**Number of values per block in the block table.*/
+constexpr uint64_t BLOCK_TABLE_STRIDE = 4;
+
+/**Layout of the unknowns in a restart file.*/
+struct RestartLayout
+{
+  uint64_t num_global_cells = 0;
+  uint64_t num_global_nodes = 0;
+  uint64_t num_moments = 0;
+  uint64_t num_groups = 0;
+  uint64_t num_precursors = 0;
+  /**Angular unknowns per node of each groupset, zero if psi is not
+   * stored.*/
+  std::vector<uint64_t> psi_unknowns;
+
+  /**Number of doubles of a cell record.*/
+  uint64_t NumRecordValues(uint64_t num_nodes) const
+  {
+    uint64_t num_values = num_nodes * num_moments * num_groups;
+    for (const uint64_t num_psi_unknowns : psi_unknowns)
+      num_values += num_nodes * num_psi_unknowns;
+    return num_values + num_precursors;
+  }
+
+  /**Number of bytes of a cell record, including its global id and number
+   * of nodes.*/
+  uint64_t NumRecordBytes(uint64_t num_nodes) const
+  {
+    return 2 * sizeof(uint64_t) + sizeof(double) * NumRecordValues(num_nodes);
+  }
+};
+
+/**Size of the header of a restart file.*/
+uint64_t RestartHeaderSize(const RestartLayout& layout,
+                           uint64_t num_locations)
+{
+  return sizeof(uint64_t) * (8 + layout.psi_unknowns.size()) +
+         BLOCK_TABLE_STRIDE * sizeof(uint64_t) * num_locations;
+}
+
+/**Order independent digest of the global ids of a location's local cells.
+ * Two locations holding the same cells have the same digest.*/
+uint64_t LocalCellsDigest(const chi_mesh::MeshContinuum& grid)
+{
+  uint64_t digest = grid.local_cells.size();
+  for (const auto& cell : grid.local_cells)
+  {
+    // splitmix64 finalizer, summed so that the order does not matter
+    uint64_t z = cell.global_id_ + 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    digest += z ^ (z >> 31);
+  }
+  return digest;
+}
+
+std::string RestartFileName(const std::string& folder_name,
+                            const std::string& file_base)
+{
+  return folder_name + "/" + file_base + ".restart";
+}
+} // namespace
+
+//###################################################################
+/**Writes phi_old, the angular fluxes and the precursors to a restart
+ * file. Waits for the write to complete.*/
+void LBSSolver::WriteRestartData(const std::string& folder_name,
+                                 const std::string& file_base)
+{
+  BeginRestartDataWrite(folder_name, file_base);
+  FinishRestartDataWrite();
+}
 
 //###################################################################
-/**Writes phi_old to restart file.*/
-void lbs::LBSSolver::WriteRestartData(const std::string& folder_name,
+/**Starts writing phi_old, the angular fluxes and the precursors to a
+ * restart file. The data is copied before this returns, hence it can be
+ * modified while the write proceeds in the background. The write is
+ * completed with FinishRestartDataWrite, which is also called by the next
+ * write and on destruction.*/
+void LBSSolver::BeginRestartDataWrite(const std::string& folder_name,
                                       const std::string& file_base)
 {
-  typedef struct stat Stat;
-  Stat st;
+  FinishRestartDataWrite();
 
   //======================================== Make sure folder exists
+  bool folder_exists = true;
   if (Chi::mpi.location_id == 0)
   {
+    struct stat st;
     if (stat(folder_name.c_str(),&st) != 0) //if not exist, make it
       if ( (mkdir(folder_name.c_str(),S_IRWXU | S_IRWXG | S_IRWXO) != 0) and
            (errno != EEXIST) )
-      {
-        Chi::log.Log0Warning()
-          << "Failed to create restart directory: " << folder_name;
-        return;
-      }
+        folder_exists = false;
+  }
+  MPI_Bcast(&folder_exists, 1, MPI_CXX_BOOL, 0, Chi::mpi.comm);
+
+  if (not folder_exists)
+  {
+    Chi::log.Log0Warning()
+      << "Failed to create restart directory: " << folder_name;
+    return;
   }
 
-  Chi::mpi.Barrier();
+  const auto& grid = *grid_ptr_;
+  const auto& sdm = *discretization_;
+
+  //======================================== Layout
+  RestartLayout layout;
+  layout.num_global_cells = grid.GetGlobalNumberOfCells();
+  layout.num_global_nodes = glob_node_count_;
+  layout.num_moments = num_moments_;
+  layout.num_groups = num_groups_;
+  layout.num_precursors =
+    options_.use_precursors ? max_precursors_per_material_ : 0;
+  for (const auto& groupset : groupsets_)
+    layout.psi_unknowns.push_back(
+      GroupsetPsiSize(groupset) == 0
+        ? 0 : groupset.psi_uk_man_.GetTotalUnknownStructureSize());
+
+  //======================================== Serialize local block
+  chi_data_types::ByteArray block;
+  std::vector<double> cell_psi;
+  for (const auto& cell : grid.local_cells)
+  {
+    const size_t num_nodes = sdm.GetCellMapping(cell).NumNodes();
+    block.Write<uint64_t>(cell.global_id_);
+    block.Write<uint64_t>(num_nodes);
+
+    const int64_t phi_address =
+      sdm.MapDOFLocal(cell, 0, flux_moments_uk_man_, 0, 0);
+    const size_t num_phi_values = num_nodes * num_moments_ * num_groups_;
+    for (size_t i = 0; i < num_phi_values; ++i)
+      block.Write<double>(phi_old_local_[phi_address + i]);
+
+    for (const auto& groupset : groupsets_)
+    {
+      const uint64_t num_psi_unknowns = layout.psi_unknowns[groupset.id_];
+      if (num_psi_unknowns == 0) continue;
+
+      const int64_t psi_address =
+        sdm.MapDOFLocal(cell, 0, groupset.psi_uk_man_, 0, 0);
+      cell_psi.resize(num_nodes * num_psi_unknowns);
+      LoadGroupsetPsi(groupset, psi_address, cell_psi.size(), cell_psi.data());
+      for (const double value : cell_psi)
+        block.Write<double>(value);
+    }
 
-  //======================================== Create files
-  //This step might fail for specific locations and
-  //can create quite a messy output if we print it all.
-  //We also need to consolidate the error to determine if
-  //the process as whole succeeded.
-  bool location_succeeded = true;
-  char location_cstr[20];
-  snprintf(location_cstr,20,"%d.r", Chi::mpi.location_id);
+    const size_t precursor_address = cell.local_id_ * layout.num_precursors;
+    for (size_t j = 0; j < layout.num_precursors; ++j)
+      block.Write<double>(precursor_new_local_[precursor_address + j]);
+  }//for cell
 
-  std::string file_name = folder_name + std::string("/") +
-                          file_base + std::string(location_cstr);
+  //======================================== Block offsets
+  const uint64_t header_size =
+    RestartHeaderSize(layout, Chi::mpi.process_count);
+  const uint64_t block_size = block.Size();
+  uint64_t block_offset = 0;
+  MPI_Exscan(&block_size, &block_offset, 1,
+             MPI_UINT64_T, MPI_SUM, Chi::mpi.comm);
+  if (Chi::mpi.location_id == 0) block_offset = 0;
+  block_offset += header_size;
 
-  std::ofstream ofile;
-  ofile.open(file_name, std::ios::out | std::ios::binary | std::ios::trunc);
+  const uint64_t block_entry[BLOCK_TABLE_STRIDE] = {block_offset,
+                                                    grid.local_cells.size(),
+                                                    block_size,
+                                                    LocalCellsDigest(grid)};
+  std::vector<uint64_t> block_table(
+    BLOCK_TABLE_STRIDE * Chi::mpi.process_count, 0);
+  MPI_Gather(block_entry, BLOCK_TABLE_STRIDE, MPI_UINT64_T,
+             block_table.data(), BLOCK_TABLE_STRIDE, MPI_UINT64_T,
+             0, Chi::mpi.comm);
 
-  if (not ofile.is_open())
+  //======================================== Header
+  chi_data_types::ByteArray header;
+  if (Chi::mpi.location_id == 0)
   {
-    Chi::log.LogAllError()
-      << "Failed to create restart file: " << file_name;
-    ofile.close();
-    location_succeeded = false;
+    header.Write<uint64_t>(RESTART_FILE_MAGIC);
+    header.Write<uint64_t>(Chi::mpi.process_count);
+    header.Write<uint64_t>(layout.num_global_cells);
+    header.Write<uint64_t>(layout.num_global_nodes);
+    header.Write<uint64_t>(layout.num_moments);
+    header.Write<uint64_t>(layout.num_groups);
+    header.Write<uint64_t>(layout.num_precursors);
+    header.Write<uint64_t>(layout.psi_unknowns.size());
+    for (const uint64_t num_psi_unknowns : layout.psi_unknowns)
+      header.Write<uint64_t>(num_psi_unknowns);
+    for (const uint64_t value : block_table)
+      header.Write<uint64_t>(value);
   }
-  else
-  {
-    size_t phi_old_size = phi_old_local_.size();
-    ofile.write((char*)&phi_old_size, sizeof(size_t));
-    for (auto val : phi_old_local_)
-      ofile.write((char*)&val, sizeof(double));
 
-    ofile.close();
+  //======================================== Open file and start writing
+  // The records only hold 8 byte values, hence the data is written as
+  // MPI_UINT64_T, which keeps the counts within the range of an int for
+  // blocks of up to 16 GB.
+  ChiLogicalErrorIf(block_size / sizeof(uint64_t) >
+                      static_cast<uint64_t>(std::numeric_limits<int>::max()),
+                    "Restart data block too large.");
+
+  auto& pending = pending_restart_write_;
+  pending.file_name = RestartFileName(folder_name, file_base);
+  pending.header = std::move(header.Data());
+  pending.block = std::move(block.Data());
+
+  bool location_succeeded =
+    MPI_File_open(Chi::mpi.comm, pending.file_name.c_str(),
+                  MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                  MPI_INFO_NULL, &pending.file) == MPI_SUCCESS;
+
+  bool global_succeeded = false;
+  MPI_Allreduce(&location_succeeded,   //Send buffer
+                &global_succeeded,     //Recv buffer
+                1,                     //count
+                MPI_CXX_BOOL,          //Data type
+                MPI_LAND,              //Operation - Logical and
+                Chi::mpi.comm);        //Communicator
+
+  if (not global_succeeded)
+  {
+    if (pending.file != MPI_FILE_NULL) MPI_File_close(&pending.file);
+    Chi::log.Log0Error()
+      << "Failed to create restart file: " << pending.file_name;
+    pending = PendingRestartWrite();
+    return;
   }
 
-  //======================================== Wait for all processes
-  //                                         then check success status
-  Chi::mpi.Barrier();
-  bool global_succeeded = true;
+  location_succeeded = MPI_File_set_size(pending.file, 0) == MPI_SUCCESS;
+
+  if (Chi::mpi.location_id == 0)
+    location_succeeded &=
+      MPI_File_write_at(pending.file, 0,
+                        pending.header.data(),
+                        static_cast<int>(header_size / sizeof(uint64_t)),
+                        MPI_UINT64_T, MPI_STATUS_IGNORE) == MPI_SUCCESS;
+
+  location_succeeded &=
+    MPI_File_iwrite_at_all(pending.file,
+                           static_cast<MPI_Offset>(block_offset),
+                           pending.block.data(),
+                           static_cast<int>(block_size / sizeof(uint64_t)),
+                           MPI_UINT64_T, &pending.request) == MPI_SUCCESS;
+
+  pending.location_succeeded = location_succeeded;
+  pending.active = true;
+}
+
+//###################################################################
+/**Waits for the restart write in progress, if any, to complete.*/
+void LBSSolver::FinishRestartDataWrite()
+{
+  auto& pending = pending_restart_write_;
+  if (not pending.active) return;
+
+  bool location_succeeded = pending.location_succeeded;
+  if (pending.request != MPI_REQUEST_NULL)
+    location_succeeded &=
+      MPI_Wait(&pending.request, MPI_STATUS_IGNORE) == MPI_SUCCESS;
+  location_succeeded &= MPI_File_close(&pending.file) == MPI_SUCCESS;
+
+  bool global_succeeded = false;
   MPI_Allreduce(&location_succeeded,   //Send buffer
                 &global_succeeded,     //Recv buffer
                 1,                     //count
                 MPI_CXX_BOOL,          //Data type
                 MPI_LAND,              //Operation - Logical and
-                Chi::mpi.comm);       //Communicator
+                Chi::mpi.comm);        //Communicator
 
   //======================================== Write status message
   if (global_succeeded)
     Chi::log.Log()
-      << "Successfully wrote restart data: "
-      << folder_name + std::string("/") +
-         file_base + std::string("X.r");
+      << "Successfully wrote restart data: " << pending.file_name;
   else
     Chi::log.Log0Error()
-      << "Failed to write restart data: "
-      << folder_name + std::string("/") +
-         file_base + std::string("X.r");
+      << "Failed to write restart data: " << pending.file_name;
+
+  pending = PendingRestartWrite();
 }
 
 //###################################################################
-/**Read phi_old from restart file.*/
-void lbs::LBSSolver::ReadRestartData(const std::string& folder_name,
-                                     const std::string& file_base)
+/**Starts a restart write when restart data is to be written and the
+ * write interval has elapsed since the last one. Location 0 decides so
+ * that all the locations agree.*/
+void LBSSolver::WriteRestartDataIfDue()
 {
-  Chi::mpi.Barrier();
+  if (not options_.write_restart_data) return;
 
-  //======================================== Open files
-  //This step might fail for specific locations and
-  //can create quite a messy output if we print it all.
-  //We also need to consolidate the error to determine if
-  //the process as whole succeeded.
-  bool location_succeeded = true;
-  char location_cstr[20];
-  snprintf(location_cstr,20,"%d.r", Chi::mpi.location_id);
+  const double time_minutes = Chi::program_timer.GetTime() / 60000.0;
+  bool due = time_minutes - last_restart_write_ >=
+             options_.write_restart_interval;
+  MPI_Bcast(&due, 1, MPI_CXX_BOOL, 0, Chi::mpi.comm);
 
-  std::string file_name = folder_name + std::string("/") +
-                          file_base + std::string(location_cstr);
+  if (not due) return;
 
-  std::ifstream ifile;
-  ifile.open(file_name, std::ios::in | std::ios::binary );
+  last_restart_write_ = time_minutes;
+  BeginRestartDataWrite(options_.write_restart_folder_name,
+                        options_.write_restart_file_base);
+}
 
-  if (not ifile.is_open())
+//###################################################################
+/**Reads phi_old, the angular fluxes and the precursors from a restart
+ * file. The file can have been written by any number of locations. When
+ * the partitioning is the same every location reads its own block,
+ * otherwise the blocks are read by all the locations and the cell records
+ * are routed to their owners.*/
+void LBSSolver::ReadRestartData(const std::string& folder_name,
+                                const std::string& file_base)
+{
+  const std::string file_name = RestartFileName(folder_name, file_base);
+  const auto& grid = *grid_ptr_;
+  const auto& sdm = *discretization_;
+
+  auto ReadFailed = [&file_name](const std::string& reason)
   {
-    ifile.close();
-    location_succeeded = false;
+    Chi::log.Log0Error()
+      << "Failed to read restart data: " << file_name << ". " << reason;
+  };
+
+  //======================================== Open file
+  MPI_File file = MPI_FILE_NULL;
+  bool location_succeeded =
+    MPI_File_open(Chi::mpi.comm, file_name.c_str(), MPI_MODE_RDONLY,
+                  MPI_INFO_NULL, &file) == MPI_SUCCESS;
+
+  bool global_succeeded = false;
+  MPI_Allreduce(&location_succeeded, &global_succeeded, 1,
+                MPI_CXX_BOOL, MPI_LAND, Chi::mpi.comm);
+  if (not global_succeeded)
+  {
+    if (file != MPI_FILE_NULL) MPI_File_close(&file);
+    ReadFailed("The file could not be opened.");
+    return;
   }
-  else
+
+  //======================================== Read and broadcast header
+  std::vector<uint64_t> header;
+  {
+    uint64_t header_length = 0;
+    if (Chi::mpi.location_id == 0)
+    {
+      uint64_t fixed[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+      MPI_File_read_at(file, 0, fixed, 8, MPI_UINT64_T, MPI_STATUS_IGNORE);
+      if (fixed[0] == RESTART_FILE_MAGIC)
+      {
+        header_length = 8 + fixed[7] + BLOCK_TABLE_STRIDE * fixed[1];
+        header.resize(header_length);
+        MPI_File_read_at(file, 0, header.data(),
+                         static_cast<int>(header_length),
+                         MPI_UINT64_T, MPI_STATUS_IGNORE);
+      }
+    }
+    MPI_Bcast(&header_length, 1, MPI_UINT64_T, 0, Chi::mpi.comm);
+    header.resize(header_length);
+    MPI_Bcast(header.data(), static_cast<int>(header_length),
+              MPI_UINT64_T, 0, Chi::mpi.comm);
+  }
+
+  if (header.empty() or header[0] != RESTART_FILE_MAGIC)
+  {
+    MPI_File_close(&file);
+    ReadFailed("Not a restart file.");
+    return;
+  }
+
+  RestartLayout file_layout;
+  const uint64_t num_writers = header[1];
+  file_layout.num_global_cells = header[2];
+  file_layout.num_global_nodes = header[3];
+  file_layout.num_moments = header[4];
+  file_layout.num_groups = header[5];
+  file_layout.num_precursors = header[6];
+  file_layout.psi_unknowns.assign(header.begin() + 8,
+                                  header.begin() + 8 + header[7]);
+  const uint64_t* block_table = &header[8 + header[7]];
+
+  //======================================== Check layout
+  const uint64_t num_precursors =
+    options_.use_precursors ? max_precursors_per_material_ : 0;
+  std::string mismatch;
+  if (file_layout.num_global_cells != grid.GetGlobalNumberOfCells() or
+      file_layout.num_global_nodes != glob_node_count_)
+    mismatch = "The mesh does not match.";
+  else if (file_layout.num_moments != num_moments_ or
+           file_layout.num_groups != num_groups_)
+    mismatch = "The number of moments or groups does not match.";
+  else if (file_layout.psi_unknowns.size() != groupsets_.size())
+    mismatch = "The number of groupsets does not match.";
+  else if (file_layout.num_precursors != 0 and num_precursors != 0 and
+           file_layout.num_precursors != num_precursors)
+    mismatch = "The number of precursors does not match.";
+  for (const auto& groupset : groupsets_)
+  {
+    if (not mismatch.empty()) break;
+    const uint64_t file_psi_unknowns = file_layout.psi_unknowns[groupset.id_];
+    if (file_psi_unknowns != 0 and GroupsetPsiSize(groupset) != 0 and
+        file_psi_unknowns !=
+          groupset.psi_uk_man_.GetTotalUnknownStructureSize())
+      mismatch = "The angular unknowns do not match.";
+  }
+
+  if (not mismatch.empty())
+  {
+    MPI_File_close(&file);
+    ReadFailed(mismatch);
+    return;
+  }
+
+  //======================================== Restores a single cell record
+  // Returns false if the cell is not local or the record is inconsistent.
+  // Angular fluxes held in a store are restored in place, to avoid a full
+  // copy, and reset to zero if the read fails.
+  std::vector<double> phi_old = phi_old_local_;
+  std::vector<std::vector<double>> psi = psi_new_local_;
+  std::vector<double> precursors = precursor_new_local_;
+  std::vector<double> cell_psi;
+  size_t num_cells_restored = 0;
+
+  auto RestoreRecord = [&](const chi_data_types::ByteArray& raw,
+                           size_t address)
   {
-    size_t number_of_unknowns;
-    ifile.read((char*)&number_of_unknowns, sizeof(size_t));
+    const auto global_id = raw.Read<uint64_t>(address, &address);
+    const auto num_nodes = raw.Read<uint64_t>(address, &address);
+    if (not grid.IsCellLocal(global_id)) return false;
+
+    const auto& cell = grid.cells[global_id];
+    if (num_nodes != sdm.GetCellMapping(cell).NumNodes()) return false;
+
+    const int64_t phi_address =
+      sdm.MapDOFLocal(cell, 0, flux_moments_uk_man_, 0, 0);
+    for (size_t i = 0; i < num_nodes * num_moments_ * num_groups_; ++i)
+      phi_old[phi_address + i] = raw.Read<double>(address, &address);
 
-    if (number_of_unknowns != phi_old_local_.size())
+    for (const auto& groupset : groupsets_)
     {
-      location_succeeded = false;
-      ifile.close();
+      const uint64_t file_psi_unknowns =
+        file_layout.psi_unknowns[groupset.id_];
+      const size_t num_values = num_nodes * file_psi_unknowns;
+      if (GroupsetPsiSize(groupset) == 0)
+      {
+        address += num_values * sizeof(double);
+        continue;
+      }
+      const int64_t psi_address =
+        sdm.MapDOFLocal(cell, 0, groupset.psi_uk_man_, 0, 0);
+      cell_psi.resize(num_values);
+      for (size_t i = 0; i < num_values; ++i)
+        cell_psi[i] = raw.Read<double>(address, &address);
+
+      if (psi[groupset.id_].empty())
+        psi_new_stores_[groupset.id_].Store(psi_address, num_values,
+                                            cell_psi.data());
+      else
+        std::copy(cell_psi.begin(), cell_psi.end(),
+                  psi[groupset.id_].begin() + psi_address);
     }
-    else
+
+    for (size_t j = 0; j < file_layout.num_precursors; ++j)
     {
-      std::vector<double> temp_phi_old(phi_old_local_.size(), 0.0);
+      const double value = raw.Read<double>(address, &address);
+      if (num_precursors != 0)
+        precursors[cell.local_id_ * num_precursors + j] = value;
+    }
+
+    ++num_cells_restored;
+    return true;
+  };
+
+  //======================================== Restores all the records of a
+  //                                         sequence of records
+  auto RestoreRecords = [&](const chi_data_types::ByteArray& raw)
+  {
+    bool succeeded = true;
+    size_t address = 0;
+    while (address < raw.Size())
+    {
+      const auto num_nodes = raw.Read<uint64_t>(address + sizeof(uint64_t));
+      succeeded &= RestoreRecord(raw, address);
+      address += file_layout.NumRecordBytes(num_nodes);
+    }
+    return succeeded;
+  };
+
+  //======================================== Reads a block of the file
+  auto ReadBlock = [&file, block_table](uint64_t b, bool collective)
+  {
+    const uint64_t* entry = &block_table[BLOCK_TABLE_STRIDE * b];
+    const auto offset = static_cast<MPI_Offset>(entry[0]);
+    const auto count = static_cast<int>(entry[2] / sizeof(uint64_t));
+
+    chi_data_types::ByteArray raw(entry[2]);
+    if (collective)
+      MPI_File_read_at_all(file, offset, raw.Data().data(), count,
+                           MPI_UINT64_T, MPI_STATUS_IGNORE);
+    else
+      MPI_File_read_at(file, offset, raw.Data().data(), count,
+                       MPI_UINT64_T, MPI_STATUS_IGNORE);
+    return raw;
+  };
 
-      size_t v=0;
-      while (not ifile.eof())
+  //======================================== Same partitioning
+  // Every location must have written exactly the cells it now holds. Equal
+  // cell counts are not enough, e.g., two partitioners often give the same
+  // counts for different cells.
+  const auto location_id = static_cast<uint64_t>(Chi::mpi.location_id);
+  bool same_partitioning =
+    num_writers == static_cast<uint64_t>(Chi::mpi.process_count);
+  if (same_partitioning)
+  {
+    const uint64_t* entry = &block_table[BLOCK_TABLE_STRIDE * location_id];
+    same_partitioning = entry[1] == grid.local_cells.size() and
+                        entry[3] == LocalCellsDigest(grid);
+  }
+  bool all_same_partitioning = false;
+  MPI_Allreduce(&same_partitioning, &all_same_partitioning, 1,
+                MPI_CXX_BOOL, MPI_LAND, Chi::mpi.comm);
+
+  location_succeeded = true;
+  if (all_same_partitioning)
+    location_succeeded = RestoreRecords(ReadBlock(location_id, true));
+  else
+  {
+    //==================================== Route the records through the
+    //                                     directory location of each cell
+    // The directory of a cell is the location global_id % process_count.
+    // It learns the owners of its cells from the owners themselves and
+    // forwards the records read by any location to them.
+    const auto num_locations = static_cast<uint64_t>(Chi::mpi.process_count);
+
+    std::map<int, std::vector<uint64_t>> directory_owned_ids;
+    for (const auto& cell : grid.local_cells)
+      directory_owned_ids[static_cast<int>(cell.global_id_ % num_locations)]
+        .push_back(cell.global_id_);
+
+    std::map<int, std::vector<std::byte>> directory_records;
+    for (uint64_t b = location_id; b < num_writers; b += num_locations)
+    {
+      const auto raw = ReadBlock(b, false);
+      size_t address = 0;
+      while (address < raw.Size())
       {
-        ifile.read((char*)&temp_phi_old[v], sizeof(double));
-        ++v;
+        const auto global_id = raw.Read<uint64_t>(address);
+        const auto num_nodes = raw.Read<uint64_t>(address + sizeof(uint64_t));
+        const size_t num_bytes = file_layout.NumRecordBytes(num_nodes);
+
+        auto& records =
+          directory_records[static_cast<int>(global_id % num_locations)];
+        records.insert(records.end(),
+                       raw.Data().begin() + static_cast<ptrdiff_t>(address),
+                       raw.Data().begin() +
+                         static_cast<ptrdiff_t>(address + num_bytes));
+        address += num_bytes;
       }
+    }
+
+    const auto owned_ids =
+      chi_mpi_utils::MapAllToAll(directory_owned_ids, MPI_UINT64_T);
+    const auto routed_records =
+      chi_mpi_utils::MapAllToAll(directory_records, MPI_BYTE);
 
-      if (v != (number_of_unknowns+1))
+    std::map<uint64_t, int> cell_owner;
+    for (const auto& [pid, global_ids] : owned_ids)
+      for (const uint64_t global_id : global_ids)
+        cell_owner[global_id] = pid;
+
+    std::map<int, std::vector<std::byte>> owner_records;
+    for (const auto& [pid, records] : routed_records)
+    {
+      chi_data_types::ByteArray raw(records);
+      size_t address = 0;
+      while (address < raw.Size())
       {
-        location_succeeded = false;
-        ifile.close();
-      }
-      else
-        phi_old_local_ = std::move(temp_phi_old);
+        const auto global_id = raw.Read<uint64_t>(address);
+        const auto num_nodes = raw.Read<uint64_t>(address + sizeof(uint64_t));
+        const size_t num_bytes = file_layout.NumRecordBytes(num_nodes);
 
-      ifile.close();
+        const auto owner = cell_owner.find(global_id);
+        if (owner == cell_owner.end())
+          location_succeeded = false;
+        else
+        {
+          auto& dest = owner_records[owner->second];
+          dest.insert(dest.end(),
+                      records.begin() + static_cast<ptrdiff_t>(address),
+                      records.begin() +
+                        static_cast<ptrdiff_t>(address + num_bytes));
+        }
+        address += num_bytes;
+      }
     }
+
+    const auto received_records =
+      chi_mpi_utils::MapAllToAll(owner_records, MPI_BYTE);
+    for (const auto& [pid, records] : received_records)
+      location_succeeded &=
+        RestoreRecords(chi_data_types::ByteArray(records));
   }
 
+  MPI_File_close(&file);
+
+  location_succeeded &= num_cells_restored == grid.local_cells.size();
+
   //======================================== Wait for all processes
   //                                         then check success status
-  Chi::mpi.Barrier();
-  bool global_succeeded = true;
   MPI_Allreduce(&location_succeeded,   //Send buffer
                 &global_succeeded,     //Recv buffer
                 1,                     //count
                 MPI_CXX_BOOL,          //Data type
                 MPI_LAND,              //Operation - Logical and
-                Chi::mpi.comm);       //Communicator
+                Chi::mpi.comm);        //Communicator
 
   //======================================== Write status message
-  if (global_succeeded) Chi::log.Log() << "Successfully read restart data";
-  else
-    Chi::log.Log0Error()
-      << "Failed to read restart data: "
-      << folder_name + std::string("/") +
-         file_base + std::string("X.r");
+  if (not global_succeeded)
+  {
+    for (auto& store : psi_new_stores_)
+      store.SetZero();
+    ReadFailed("The file does not hold the data of every local cell.");
+    return;
+  }
+
+  phi_old_local_ = std::move(phi_old);
+  psi_new_local_ = std::move(psi);
+  precursor_new_local_ = std::move(precursors);
+
+  Chi::log.Log() << "Successfully read restart data";
 }
+
+}//namespace lbs
@@ -1,109 +1,73 @@
 #include "lbs_solver.h"
 
+#include "Tools/lbs_nodal_data_file.h"
+
 #include "mesh/MeshContinuum/chi_meshcontinuum.h"
 
 #include "chi_runtime.h"
 #include "chi_log.h"
 #include "LinearBoltzmannSolvers/A_LBSSolver/Groupset/lbs_groupset.h"
 
-
-#include <fstream>
-#include <cstring>
-
 //###################################################################
-/**Writes the groupset's angular fluxes to file.*/
+/**Writes the groupset's angular fluxes to file. The values of each angle
+ * and group are written as a contiguous chunk, optionally compressed.*/
 void lbs::LBSSolver::
   WriteGroupsetAngularFluxes(const LBSGroupset& groupset,
-                             const std::string& file_base)
+                             const std::string& file_base,
+                             bool compress/*=false*/)
 {
   std::string file_name =
     file_base + std::to_string(Chi::mpi.location_id) + ".data";
 
-  //============================================= Open file
-  std::ofstream file(file_name,
-                     std::ofstream::binary | //binary file
-                     std::ofstream::out |    //no accidental reading
-                     std::ofstream::trunc);  //clear file contents when opened
-
-  //============================================= Check file is open
-  if (not file.is_open())
+  //============================================= Get relevant items
+  const auto& sdm        = *discretization_;
+  const size_t num_psi_values = GroupsetPsiSize(groupset);
+  const auto& dof_handler = groupset.psi_uk_man_;
+  const size_t num_angles = groupset.quadrature_->abscissae_.size();
+  const size_t num_groups = groupset.groups_.size();
+  const size_t num_cell_node_values = num_angles * num_groups;
+
+  if (num_psi_values == 0)
   {
     Chi::log.LogAllWarning()
-      << __FUNCTION__ << "Failed to open " << file_name;
+      << __FUNCTION__ << "No angular fluxes stored for groupset "
+      << groupset.id_ << ". Nothing written to " << file_name;
     return;
   }
 
-  //============================================= Write header
-  std::string header_info =
-    "Chi-Tech LinearBoltzmann::Groupset angular flux file\n"
-    "Header size: 320 bytes\n"
-    "Structure(type-info):\n"
-    "size_t-num_local_nodes\n"
-    "size_t-num_angles\n"
-    "size_t-num_groups\n"
-    "size_t-num_records\n"
-    "Each record:\n"
-    "size_t-cell_global_id\n"
-    "unsigned int-node_number\n"
-    "unsigned int-angle_num_\n"
-    "unsigned int-group_num\n"
-    "double-angular_flux\n";
-
-  int header_size = (int)header_info.length();
-
-  char header_bytes[320];
-  memset(header_bytes, '-', 320);
-  strncpy(header_bytes, header_info.c_str(),std::min(header_size,319));
-  header_bytes[319]='\0';
-
-  file << header_bytes;
-
-  //============================================= Get relevant items
-  auto NODES_ONLY = chi_math::UnknownManager::GetUnitaryUnknownManager();
-
-  size_t num_local_nodes = discretization_->GetNumLocalDOFs(NODES_ONLY);
-  size_t num_angles      = groupset.quadrature_->abscissae_.size();
-  size_t num_groups      = groupset.groups_.size();
-  size_t num_local_dofs  = psi_new_local_[groupset.id_].size();
-  auto   dof_handler     = groupset.psi_uk_man_;
+  //============================================= Gather cell table and values
+  NodalDataFile::Layout layout;
+  layout.content = NodalDataFile::Content::ANGULAR_FLUXES;
+  layout.num_components = num_angles;
+  layout.num_groups = num_groups;
 
-  //============================================= Write num_ quantities
-  file.write((char*)&num_local_nodes,sizeof(size_t));
-  file.write((char*)&num_angles     ,sizeof(size_t));
-  file.write((char*)&num_groups     ,sizeof(size_t));
-  file.write((char*)&num_local_dofs ,sizeof(size_t));
-
-  auto& sdm = discretization_;
-
-  //============================================= Write per dof data
-  size_t dof_count=0;
+  std::vector<double> values;
+  values.reserve(num_psi_values);
   for (const auto& cell : grid_ptr_->local_cells)
   {
-    const size_t num_nodes = sdm->GetCellNumNodes(cell);
-    for (unsigned int i=0; i < num_nodes; ++i)
-      for (unsigned int n=0; n<num_angles; ++n)
-        for (unsigned int g=0; g<num_groups; ++g)
-        {
-          if (++dof_count > num_local_dofs) goto close_file;
-
-          uint64_t dof_map = sdm->MapDOFLocal(cell,i,dof_handler,n,g);
-          double value = psi_new_local_[groupset.id_][dof_map];
-
-          file.write((char*)&cell.global_id_, sizeof(size_t));
-          file.write((char*)&i             ,sizeof(unsigned int));
-          file.write((char*)&n             ,sizeof(unsigned int));
-          file.write((char*)&g             ,sizeof(unsigned int));
-          file.write((char*)&value         ,sizeof(double));
-        }
-  }
-
-  //============================================= Clean-up
-  close_file:
-  file.close();
+    const size_t num_nodes = sdm.GetCellNumNodes(cell);
+    layout.cell_global_ids.push_back(cell.global_id_);
+    layout.cell_num_nodes.push_back(num_nodes);
+    for (const auto& node : sdm.GetCellNodeLocations(cell))
+      layout.node_locations.push_back(node);
+
+    // The angles and groups of a cell's nodes are contiguous
+    const int64_t address = sdm.MapDOFLocal(cell, 0, dof_handler, 0, 0);
+    const size_t num_cell_values = num_nodes * num_cell_node_values;
+    values.resize(values.size() + num_cell_values);
+    LoadGroupsetPsi(groupset, address, num_cell_values,
+                    &values[values.size() - num_cell_values]);
+  }//for cell
+
+  //============================================= Write file
+  if (not NodalDataFile::Write(file_name, layout, values, compress))
+    Chi::log.LogAllWarning()
+      << __FUNCTION__ << "Failed to write " << file_name;
 }
 
 //###################################################################
-/**Prints the groupset's angular fluxes to file.*/
+/**Reads the groupset's angular fluxes from file. The file is memory
+ * mapped and read one angle and group at a time.*/
 void lbs::LBSSolver::
   ReadGroupsetAngularFluxes(LBSGroupset& groupset,
                             const std::string& file_base)
@@ -112,12 +76,11 @@ void lbs::LBSSolver::
     file_base + std::to_string(Chi::mpi.location_id) + ".data";
 
   //============================================= Open file
-  std::ifstream file(file_name,
-                     std::ofstream::binary | //binary file
-                     std::ofstream::in);     //no accidental writing
+  Chi::log.Log() << "Reading angular flux file " << file_name;
+  const NodalDataFile file(file_name);
 
   //============================================= Check file is open
-  if (not file.is_open())
+  if (not file.IsOpen())
   {
     Chi::log.LogAllWarning()
       << __FUNCTION__ << "Failed to open " << file_name;
@@ -127,77 +90,122 @@ void lbs::LBSSolver::
   //============================================= Get relevant items
   auto NODES_ONLY = chi_math::UnknownManager::GetUnitaryUnknownManager();
 
-  size_t num_local_nodes   = discretization_->GetNumLocalDOFs(NODES_ONLY);
+  const auto& sdm          = *discretization_;
+  const auto& layout       = file.GetLayout();
+  size_t num_local_nodes   = sdm.GetNumLocalDOFs(NODES_ONLY);
   size_t num_angles        = groupset.quadrature_->abscissae_.size();
   size_t num_groups        = groupset.groups_.size();
-  size_t num_local_dofs    = psi_new_local_[groupset.id_].size();
-  std::vector<double>& psi = psi_new_local_[groupset.id_];
-  auto   dof_handler       = groupset.psi_uk_man_;
-
-  size_t file_num_local_nodes;
-  size_t file_num_angles     ;
-  size_t file_num_groups     ;
-  size_t file_num_local_dofs ;
-
-
-  //============================================= Read header
-  Chi::log.Log() << "Reading angular flux file " << file_name;
-  char header_bytes[320]; header_bytes[319] = '\0';
-  file.read(header_bytes,319);
-
-  file.read((char*)&file_num_local_nodes, sizeof(size_t));
-  file.read((char*)&file_num_angles     , sizeof(size_t));
-  file.read((char*)&file_num_groups     , sizeof(size_t));
-  file.read((char*)&file_num_local_dofs , sizeof(size_t));
+  const auto& dof_handler  = groupset.psi_uk_man_;
 
   //============================================= Check compatibility
-  if (file_num_local_nodes != num_local_nodes or
-      file_num_angles      != num_angles      or
-      file_num_groups      != num_groups      or
-      file_num_local_dofs  != num_local_dofs)
+  if (layout.content        != NodalDataFile::Content::ANGULAR_FLUXES or
+      layout.NumNodes()     != num_local_nodes or
+      layout.num_components != num_angles      or
+      layout.num_groups     != num_groups      or
+      GroupsetPsiSize(groupset) != num_local_nodes * num_angles * num_groups)
   {
     std::stringstream outstr;
-    outstr << "num_local_nodes: " << file_num_local_nodes << "\n";
-    outstr << "num_angles     : " << file_num_angles << "\n";
-    outstr << "num_groups     : " << file_num_groups << "\n";
-    outstr << "num_local_dofs : " << file_num_local_dofs << "\n";
+    outstr << "num_local_nodes: " << layout.NumNodes() << "\n";
+    outstr << "num_angles     : " << layout.num_components << "\n";
+    outstr << "num_groups     : " << layout.num_groups << "\n";
+    outstr << "num_local_dofs : "
+           << layout.NumNodes() * layout.num_components * layout.num_groups
+           << "\n";
     Chi::log.LogAll()
       << "Incompatible DOF data found in file " << file_name << "\n"
       << outstr.str();
-    file.close();
     return;
   }
 
-  auto& sdm = discretization_;
-
-  //============================================= Commit to reading the file
-  psi.reserve(file_num_local_dofs);
-  std::set<uint64_t> cells_touched;
-  for (size_t dof=0; dof < file_num_local_dofs; ++dof)
+  //============================================= Map file nodes to the
+  //                                              addresses of local nodes
+  std::vector<int64_t> node_addresses;
+  node_addresses.reserve(layout.NumNodes());
+  for (size_t c=0; c < layout.cell_global_ids.size(); ++c)
   {
-    uint64_t     cell_global_id;
-    unsigned int node;
-    unsigned int angle_num;
-    unsigned int group;
-    double       psi_value;
-
-    file.read((char*)&cell_global_id,sizeof(uint64_t));
-    file.read((char*)&node          ,sizeof(unsigned int));
-    file.read((char*)&angle_num     ,sizeof(unsigned int));
-    file.read((char*)&group         ,sizeof(unsigned int));
-    file.read((char*)&psi_value     ,sizeof(double));
+    const uint64_t cell_global_id = layout.cell_global_ids[c];
+    const uint64_t num_nodes = layout.cell_num_nodes[c];
 
-    cells_touched.insert(cell_global_id);
+    ChiLogicalErrorIf(not grid_ptr_->IsCellLocal(cell_global_id) or
+                      sdm.GetCellNumNodes(grid_ptr_->cells[cell_global_id]) !=
+                        num_nodes,
+                      "Cell " + std::to_string(cell_global_id) +
+                      " in file " + file_name + " does not match a local cell.");
 
     const auto& cell = grid_ptr_->cells[cell_global_id];
+    for (uint64_t i=0; i < num_nodes; ++i)
+      node_addresses.push_back(sdm.MapDOFLocal(cell, i, dof_handler, 0, 0));
+  }
 
-    size_t imap = sdm->MapDOFLocal(cell,node,dof_handler,angle_num,group);
+  //============================================= Commit to reading the file
+  // The values of a node are ordered [angle][group]
+  for (uint64_t n=0; n < num_angles; ++n)
+    for (uint64_t g=0; g < num_groups; ++g)
+    {
+      const auto chunk = file.ReadChunk(n, g);
+      const uint64_t component_offset = n * num_groups + g;
+      for (size_t i=0; i < chunk.size(); ++i)
+        StoreGroupsetPsi(groupset, node_addresses[i] + component_offset,
+                         1, &chunk[i]);
+    }
+
+  Chi::log.LogAll() << "Number of cells read: "
+                    << layout.cell_global_ids.size();
+}
 
-    psi[imap] = psi_value;
-  }
+//###################################################################
+/**Returns the number of angular flux values stored for a groupset, zero
+ * if the angular fluxes are not stored.*/
+size_t lbs::LBSSolver::GroupsetPsiSize(const LBSGroupset& groupset) const
+{
+  return psi_new_local_[groupset.id_].size() +
+         psi_new_stores_[groupset.id_].Size();
+}
 
-  Chi::log.LogAll() << "Number of cells read: " << cells_touched.size();
+//###################################################################
+/**Returns the store holding the angular fluxes of a groupset, `nullptr`
+ * when they are held in psi_new_local_ or not stored.*/
+lbs::AngularFluxStore*
+  lbs::LBSSolver::GroupsetPsiStore(const LBSGroupset& groupset)
+{
+  auto& store = psi_new_stores_[groupset.id_];
+  return store.Empty() ? nullptr : &store;
+}
 
-  //============================================= Clean-up
-  file.close();
-}
\ No newline at end of file
+//###################################################################
+/**Copies angular flux values of a groupset, regardless of the storage
+ * mode.*/
+void lbs::LBSSolver::LoadGroupsetPsi(const LBSGroupset& groupset,
+                                     size_t offset,
+                                     size_t count,
+                                     double* values) const
+{
+  const auto& store = psi_new_stores_[groupset.id_];
+  if (not store.Empty())
+    store.Load(offset, count, values);
+  else
+  {
+    const auto& psi = psi_new_local_[groupset.id_];
+    ChiInvalidArgumentIf(offset + count > psi.size(), "Range out of bounds.");
+    std::copy_n(psi.begin() + static_cast<int64_t>(offset), count, values);
+  }
+}
+
+//###################################################################
+/**Sets angular flux values of a groupset, regardless of the storage
+ * mode.*/
+void lbs::LBSSolver::StoreGroupsetPsi(const LBSGroupset& groupset,
+                                      size_t offset,
+                                      size_t count,
+                                      const double* values)
+{
+  auto& store = psi_new_stores_[groupset.id_];
+  if (not store.Empty())
+    store.Store(offset, count, values);
+  else
+  {
+    auto& psi = psi_new_local_[groupset.id_];
+    ChiInvalidArgumentIf(offset + count > psi.size(), "Range out of bounds.");
+    std::copy_n(values, count, psi.begin() + static_cast<int64_t>(offset));
+  }
+}
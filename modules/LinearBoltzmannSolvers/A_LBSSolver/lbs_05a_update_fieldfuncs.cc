@@ -12,6 +12,10 @@ namespace lbs
 /**Copy relevant section of phi_old to the field functions.*/
 void LBSSolver::UpdateFieldFunctions()
 {
+  auto& t_update =
+    Chi::log.CreateOrGetTimingBlock("LBSSolver::UpdateFieldFunctions");
+  t_update.TimeSectionBegin();
+
   const auto& sdm = *discretization_;
   const auto& phi_uk_man = flux_moments_uk_man_;
 
@@ -128,6 +132,8 @@ void LBSSolver::UpdateFieldFunctions()
     ff_ptr->UpdateFieldVector(data_vector_local);
 
   } // if power enabled
+
+  t_update.TimeSectionEnd();
 }
 
 // ###################################################################
@@ -11,6 +11,7 @@
 #include "mesh/SweepUtilities/SweepBoundary/sweep_boundaries.h"
 
 #include "A_LBSSolver/PointSource/lbs_point_source.h"
+#include "A_LBSSolver/Tools/lbs_angular_flux_store.h"
 
 #include <petscksp.h>
 
@@ -94,6 +95,9 @@ protected:
   std::vector<double> q_moments_local_, ext_src_moments_local_;
   std::vector<double> phi_new_local_, phi_old_local_;
   std::vector<std::vector<double>> psi_new_local_;
+  /**Angular fluxes of the groupsets when stored in a mode other than
+   * `DOUBLE`, in which case the vectors of psi_new_local_ are empty.*/
+  std::vector<AngularFluxStore> psi_new_stores_;
   std::vector<double> precursor_new_local_;
 
   SetSourceFunction active_set_source_function_;
@@ -105,6 +109,18 @@ protected:
   std::map<std::pair<size_t, size_t>, size_t> phi_field_functions_local_map_;
   size_t power_gen_fieldfunc_local_handle_ = 0;
 
+  /**State of a restart write in progress.*/
+  struct PendingRestartWrite
+  {
+    bool active = false;
+    bool location_succeeded = true;
+    std::string file_name;
+    MPI_File file = MPI_FILE_NULL;
+    MPI_Request request = MPI_REQUEST_NULL;
+    std::vector<std::byte> header;
+    std::vector<std::byte> block;
+  } pending_restart_write_;
+
   /**Time integration parameter meant to be set by an executor*/
   std::shared_ptr<const chi_math::TimeIntegration> time_integration_ = nullptr;
 
@@ -116,7 +132,7 @@ public:
   LBSSolver(const LBSSolver&) = delete;
   LBSSolver& operator=(const LBSSolver&) = delete;
 
-  virtual ~LBSSolver() = default;
+  virtual ~LBSSolver();
 
   size_t GetSourceEventTag() const;
 
@@ -276,18 +292,30 @@ public:
   // 04a
   void WriteRestartData(const std::string& folder_name,
                         const std::string& file_base);
+  void BeginRestartDataWrite(const std::string& folder_name,
+                             const std::string& file_base);
+  void FinishRestartDataWrite();
+  void WriteRestartDataIfDue();
   void ReadRestartData(const std::string& folder_name,
                        const std::string& file_base);
   // 04b
   void WriteGroupsetAngularFluxes(const LBSGroupset& groupset,
-                                  const std::string& file_base);
+                                  const std::string& file_base,
+                                  bool compress = false);
   void ReadGroupsetAngularFluxes(LBSGroupset& groupset,
                                  const std::string& file_base);
+  size_t GroupsetPsiSize(const LBSGroupset& groupset) const;
+  AngularFluxStore* GroupsetPsiStore(const LBSGroupset& groupset);
+  void LoadGroupsetPsi(const LBSGroupset& groupset,
+                       size_t offset, size_t count, double* values) const;
+  void StoreGroupsetPsi(const LBSGroupset& groupset,
+                        size_t offset, size_t count, const double* values);
 
   // 04c
   std::vector<double> MakeSourceMomentsFromPhi();
   void WriteFluxMoments(const std::string& file_base,
-                        const std::vector<double>& flux_moments);
+                        const std::vector<double>& flux_moments,
+                        bool compress = false);
   void ReadFluxMoments(const std::string& file_base,
                        std::vector<double>& flux_moments,
                        bool single_file = false);
@@ -7,6 +7,7 @@
 
 #include <functional>
 #include <map>
+#include <stdexcept>
 
 namespace lbs
 {
@@ -101,6 +102,28 @@ inline SourceFlags operator|(const SourceFlags f1, const SourceFlags f2)
   return static_cast<SourceFlags>(static_cast<int>(f1) | static_cast<int>(f2));
 }
 
+/**How angular fluxes are held in memory. Values are always computed and
+ * accumulated in double precision, the storage mode only affects how they
+ * are held between uses.*/
+enum class AngularFluxStorageMode
+{
+  DOUBLE = 0,     ///< Plain double precision array
+  SINGLE = 1,     ///< Single precision array
+  COMPRESSED = 2, ///< Losslessly compressed blocks of doubles
+  MAPPED = 3      ///< Double precision array in a memory mapped spill file
+};
+
+inline AngularFluxStorageMode
+MapAngularFluxStorageMode(const std::string& name)
+{
+  if (name == "double") return AngularFluxStorageMode::DOUBLE;
+  if (name == "single") return AngularFluxStorageMode::SINGLE;
+  if (name == "compressed") return AngularFluxStorageMode::COMPRESSED;
+  if (name == "mapped") return AngularFluxStorageMode::MAPPED;
+  throw std::invalid_argument("Unknown angular flux storage mode \"" + name +
+                              "\"");
+}
+
 enum class PhiSTLOption
 {
   PHI_OLD = 1,
@@ -125,6 +148,8 @@ struct Options
   SDMType sd_type = SDMType::PIECEWISE_LINEAR_DISCONTINUOUS;
   unsigned int scattering_order = 1;
   int sweep_eager_limit = 32000; // see chiLBSSetProperty documentation
+  int num_sweep_threads = 1;
+  double sweep_metadata_memory_budget_mb = 0.0;
 
   bool read_restart_data = false;
   std::string read_restart_folder_name = std::string("YRestart");
@@ -139,6 +164,10 @@ struct Options
   bool use_src_moments = false;
 
   bool save_angular_flux = false;
+  AngularFluxStorageMode angular_flux_storage = AngularFluxStorageMode::DOUBLE;
+  AngularFluxStorageMode retained_angular_flux_storage =
+    AngularFluxStorageMode::DOUBLE;
+  std::string angular_flux_spill_folder = std::string(".");
 
   bool verbose_inner_iterations = true;
   bool verbose_ags_iterations = false;
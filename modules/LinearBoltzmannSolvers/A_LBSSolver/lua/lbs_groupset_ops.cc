@@ -1012,6 +1012,10 @@ is to be created.
                     Default false.
 \param PETSCString char Optional. Options string to be inserted
                         during initialization.
+\param MatrixFree bool Optional flag to apply the WGDSA operator without
+                      assembling its matrix. The solver is then Jacobi
+                      preconditioned. When omitted the groupset's
+                      `wgdsa_matrix_free` parameter is kept.
 
 
 
@@ -1048,7 +1052,7 @@ int chiLBSGroupsetSetWGDSA(lua_State *L)
   if (num_args >= 5)
     verbose = lua_toboolean(L,5);
 
-  if (num_args == 6)
+  if (num_args >= 6)
     petsc_string = lua_tostring(L,6);
 
   //============================================= Get pointer to solver
@@ -1075,6 +1079,8 @@ int chiLBSGroupsetSetWGDSA(lua_State *L)
   groupset->wgdsa_tol_       = resid_tol;
   groupset->wgdsa_verbose_   = verbose;
   groupset->wgdsa_string_    = std::string(petsc_string);
+  if (num_args >= 7)
+    groupset->wgdsa_matrix_free_ = lua_toboolean(L,7);
 
   Chi::log.Log()
     << "Groupset " << grpset_index << " set to apply WGDSA with "
@@ -1103,6 +1109,10 @@ is to be created.
                     Default false.
 \param PETSCString char Optional. Options string to be inserted
                         during initialization.
+\param MatrixFree bool Optional flag to apply the TGDSA operator without
+                      assembling its matrix. The solver is then Jacobi
+                      preconditioned. When omitted the groupset's
+                      `tgdsa_matrix_free` parameter is kept.
 
 
 
@@ -1139,7 +1149,7 @@ int chiLBSGroupsetSetTGDSA(lua_State *L)
   if (num_args >= 5)
     verbose = lua_toboolean(L,5);
 
-  if (num_args == 6)
+  if (num_args >= 6)
     petsc_string = lua_tostring(L,6);
 
   //============================================= Get pointer to solver
@@ -1166,6 +1176,8 @@ int chiLBSGroupsetSetTGDSA(lua_State *L)
   groupset->tgdsa_tol_       = resid_tol;
   groupset->tgdsa_verbose_   = verbose;
   groupset->tgdsa_string_    = std::string(petsc_string);
+  if (num_args >= 7)
+    groupset->tgdsa_matrix_free_ = lua_toboolean(L,7);
 
   Chi::log.Log()
     << "Groupset " << grpset_index << " set to apply TGDSA with "
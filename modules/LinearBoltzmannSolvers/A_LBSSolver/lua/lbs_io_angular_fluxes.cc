@@ -19,13 +19,16 @@ is to be created.
 \param file_base string Path+Filename_base to use for the output. Each location
                         will append its id to the back plus an extension ".data"
 
+\param compress bool (Optional) Flag indicating that the data chunks should be
+                     compressed losslessly. Default: false.
+
 */
 int chiLBSWriteGroupsetAngularFlux(lua_State *L)
 {
   const std::string fname = "chiLBSWriteGroupsetAngularFlux";
   //============================================= Get arguments
   const int num_args = lua_gettop(L);
-  if (num_args != 3)
+  if ((num_args != 3) and (num_args != 4))
     LuaPostArgAmountError(fname,3,num_args);
 
   LuaCheckNilValue(fname,L,1);
@@ -36,6 +39,13 @@ int chiLBSWriteGroupsetAngularFlux(lua_State *L)
   const int      grpset_index  = lua_tonumber(L,2);
   const std::string file_base  = lua_tostring(L,3);
 
+  bool compress_flag = false;
+  if (num_args == 4)
+  {
+    LuaCheckBoolValue(fname, L, 4);
+    compress_flag = lua_toboolean(L, 4);
+  }
+
   //============================================= Get pointer to solver
   auto& lbs_solver =
     Chi::GetStackItem<lbs::LBSSolver>(Chi::object_stack,
@@ -55,7 +65,8 @@ int chiLBSWriteGroupsetAngularFlux(lua_State *L)
     Chi::Exit(EXIT_FAILURE);
   }
 
-  lbs_solver.WriteGroupsetAngularFluxes(*groupset, file_base);
+  lbs_solver.WriteGroupsetAngularFluxes(*groupset, file_base,
+                                        compress_flag);
 
   return 0;
 }
@@ -16,13 +16,16 @@ is to be created.
 \param file_base string Path+Filename_base to use for the output. Each location
                         will append its id to the back plus an extension ".data"
 
+\param compress bool (Optional) Flag indicating that the data chunks should be
+                     compressed losslessly. Default: false.
+
 */
 int chiLBSWriteFluxMoments(lua_State *L)
 {
   const std::string fname = "chiLBSWriteFluxMoments";
   //============================================= Get arguments
   const int num_args = lua_gettop(L);
-  if (num_args != 2)
+  if ((num_args != 2) and (num_args != 3))
     LuaPostArgAmountError(fname,2,num_args);
 
   LuaCheckNilValue(fname,L,1);
@@ -31,13 +34,21 @@ int chiLBSWriteFluxMoments(lua_State *L)
   const int      solver_handle = lua_tonumber(L,1);
   const std::string file_base = lua_tostring(L,2);
 
+  bool compress_flag = false;
+  if (num_args == 3)
+  {
+    LuaCheckBoolValue(fname, L, 3);
+    compress_flag = lua_toboolean(L, 3);
+  }
+
   //============================================= Get pointer to solver
   auto& lbs_solver =
     Chi::GetStackItem<lbs::LBSSolver>(Chi::object_stack,
                                                        solver_handle,
                                                        fname);
 
-  lbs_solver.WriteFluxMoments(file_base, lbs_solver.PhiOldLocal());
+  lbs_solver.WriteFluxMoments(file_base, lbs_solver.PhiOldLocal(),
+                              compress_flag);
 
   return 0;
 }
@@ -60,7 +60,8 @@ READ_RESTART_DATA\n
  The value can be followed by two
  optional strings. The first is the folder name which can be relative or
  absolute, and the second is the file base name. These are defaulted to
- "YRestart" and "restart" respectively.\n\n
+ "YRestart" and "restart" respectively. The file can have been written with
+ a different number of processes.\n\n
 
 SAVE_ANGULAR_FLUX\n
 Sets the flag for saving the angular flux. Expects to be followed by true/false.
@@ -94,9 +95,12 @@ WRITE_RESTART_DATA\n
  The value can be followed by two optional strings and a number
  optional strings. The first string is the folder name which can be relative or
  absolute, and the second string is the file base name. The number is the time
- interval (in minutes) for a restart write to be triggered (apart from GMRES
- restarts and the conclusion of groupset completions) .These are defaulted to
- "YRestart", "restart" and 30 minutes respectively.\n\n
+ interval (in minutes) for a restart write to be triggered during
+ within-group iterations, apart from the write at the end of a steady state
+ solve. These are defaulted to "YRestart", "restart" and 30 minutes
+ respectively. All the processes write to the single file
+ `<folder>/<file base>.restart` and the periodic writes proceed in the
+ background while the iterations continue.\n\n
 
 \code
 chiLBSSetProperty(phys1,WRITE_RESTART_DATA,"YRestart1","restart",1)
@@ -146,6 +146,7 @@ void DiffusionDFEMSolver::InitializeWGSSolvers()
     solver->options.max_iters = groupset.wgdsa_max_iters_;
     solver->options.verbose = groupset.wgdsa_verbose_;
     solver->options.additional_options_string = groupset.wgdsa_string_;
+    solver->options.matrix_free = groupset.wgdsa_matrix_free_;
 
     solver->Initialize();
 
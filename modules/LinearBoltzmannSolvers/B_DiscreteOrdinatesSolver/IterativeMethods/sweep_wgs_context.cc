@@ -151,8 +151,8 @@ void SweepWGSContext<Mat, Vec, KSP>::PostSolveCallback()
   //==================================================== Print solution info
   {
     double sweep_time = sweep_scheduler_.GetAverageSweepTime();
-    double chunk_overhead_ratio =
-      1.0 - sweep_scheduler_.GetAngleSetTimings()[2];
+    const auto angle_set_timings = sweep_scheduler_.GetAngleSetTimings();
+    double chunk_overhead_ratio = 1.0 - angle_set_timings[2];
     double source_time =
       Chi::log.ProcessEvent(lbs_solver_.GetSourceEventTag(),
                             chi::ChiLog::EventOperation::AVERAGE_DURATION);
@@ -162,6 +162,26 @@ void SweepWGSContext<Mat, Vec, KSP>::PostSolveCallback()
 
     if (log_info_)
     {
+      //=========================================== Measured sweep imbalance
+      // Based on the time each location spent in its sweep chunks, i.e.,
+      // excluding time spent waiting on upstream locations. Without chunk
+      // timings, e.g. with event tracing disabled, it is not reported.
+      double max_chunk_time = 0.0;
+      double avg_chunk_time = 0.0;
+      MPI_Allreduce(&angle_set_timings[1],
+                    &max_chunk_time,
+                    1,
+                    MPI_DOUBLE,
+                    MPI_MAX,
+                    Chi::mpi.comm);
+      MPI_Allreduce(&angle_set_timings[1],
+                    &avg_chunk_time,
+                    1,
+                    MPI_DOUBLE,
+                    MPI_SUM,
+                    Chi::mpi.comm);
+      avg_chunk_time /= Chi::mpi.process_count;
+
       Chi::log.Log() << "\n\n";
       Chi::log.Log() << "        Set Src Time/sweep (s):        "
                      << source_time;
@@ -173,6 +193,12 @@ void SweepWGSContext<Mat, Vec, KSP>::PostSolveCallback()
                           static_cast<double>(num_unknowns);
       Chi::log.Log() << "        Number of unknowns per sweep:  "
                      << num_unknowns;
+      if (max_chunk_time > 0.0)
+        Chi::log.Log() << "        Sweep imbalance max/avg:       "
+                       << max_chunk_time / avg_chunk_time;
+      else
+        Chi::log.Log() << "        Sweep imbalance max/avg:       "
+                       << "unavailable (no chunk timings)";
       Chi::log.Log() << "\n\n";
 
       std::string sweep_log_file_name =
@@ -14,7 +14,10 @@ namespace lbs
 template <class MatType, class VecType, class SolverType>
 struct SweepWGSContext : public WGSContext<MatType, VecType, SolverType>
 {
-  std::shared_ptr<chi_mesh::sweep_management::SweepChunk> sweep_chunk_;
+  typedef std::shared_ptr<chi_mesh::sweep_management::SweepChunk>
+    SweepChunkPtr;
+
+  SweepChunkPtr sweep_chunk_;
   chi_mesh::sweep_management::SweepScheduler sweep_scheduler_;
 
   DiscreteOrdinatesSolver& lbs_ss_solver_;
@@ -26,7 +29,8 @@ struct SweepWGSContext : public WGSContext<MatType, VecType, SolverType>
     int lhs_scope,
     int rhs_scope,
     bool log_info,
-    std::shared_ptr<chi_mesh::sweep_management::SweepChunk> sweep_chunk)
+    std::shared_ptr<chi_mesh::sweep_management::SweepChunk> sweep_chunk,
+    const std::vector<SweepChunkPtr>& worker_sweep_chunks = {})
     : WGSContext<MatType, VecType, SolverType>(lbs_solver,
                                                groupset,
                                                set_source_function,
@@ -39,7 +43,8 @@ struct SweepWGSContext : public WGSContext<MatType, VecType, SolverType>
           ? chi_mesh::sweep_management::SchedulingAlgorithm::DEPTH_OF_GRAPH
           : chi_mesh::sweep_management::SchedulingAlgorithm::FIRST_IN_FIRST_OUT,
         *groupset.angle_agg_,
-        *sweep_chunk_),
+        *sweep_chunk_,
+        worker_sweep_chunks),
       lbs_ss_solver_(lbs_solver)
   {
   }
@@ -1,4 +1,5 @@
 #include "AAH_SweepChunk.h"
+#include "SweepChunkKernels.h"
 
 #include "mesh/MeshContinuum/chi_meshcontinuum.h"
 #include "mesh/SweepUtilities/FLUDS/AAH_FLUDS.h"
@@ -40,6 +41,9 @@ AAH_SweepChunk::AAH_SweepChunk(
                  std::bind(&SweepChunk::KernelFEMUpwindSurfaceIntegrals, this));
   RegisterKernel("FEMSSTDMassTerms",
                  std::bind(&SweepChunk::KernelFEMSTDMassTerms, this));
+  RegisterKernel("FEMSTDMassTermsBatchedSolve",
+                 std::bind(&SweepChunk::KernelFEMSTDMassTermsBatchedSolve,
+                           this));
   RegisterKernel("KernelPhiUpdate",
                  std::bind(&SweepChunk::KernelPhiUpdate, this));
   RegisterKernel("KernelPsiUpdate",
@@ -54,12 +58,37 @@ AAH_SweepChunk::AAH_SweepChunk(
 
   mass_term_kernels_ = {Kernel("FEMSSTDMassTerms")};
 
+  group_subset_solve_kernels_ = {Kernel("FEMSTDMassTermsBatchedSolve")};
+
   flux_update_kernels_ = {Kernel("KernelPhiUpdate"), Kernel("KernelPsiUpdate")};
 
   post_cell_dir_sweep_callbacks_ = {};
+
+  standard_kernel_pipeline_available_ = true;
 }
 
+// ##################################################################
+/**Sweeps all the cells of the angle set, using the compile-time kernel
+ * pipeline, and the sweep metadata cache, when available.*/
 void AAH_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
+{
+  if (UseStandardKernelPipeline())
+    SweepImpl<StandardKernelPipeline>(
+      angle_set,
+      sweep_metadata_cache_ ? sweep_metadata_cache_->GetMetadata(angle_set)
+                            : nullptr);
+  else
+    SweepImpl<NamedKernelPipeline>(angle_set, nullptr);
+}
+
+// ##################################################################
+/**Sweep implementation with the phases of the kernel pipeline resolved
+ * at compile time. When `metadata` is supplied the face lists, face-node
+ * maps and, if stored, the per-direction data are taken from it instead
+ * of being recomputed.*/
+template <class KernelPipeline>
+void AAH_SweepChunk::SweepImpl(chi_mesh::sweep_management::AngleSet& angle_set,
+                               const SweepMetadata* metadata)
 {
   const chi::SubSetInfo& grp_ss_info =
     groupset_.grp_subset_infos_[angle_set.GetRefGroupSubset()];
@@ -98,12 +127,40 @@ void AAH_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
     using namespace chi_mesh::sweep_management;
     const auto& face_orientations = spds.CellFaceOrientations()[cell_local_id_];
 
-    cell_num_faces_ = cell_->faces_.size();
+    cell_num_faces_ = face_view_.NumFaces(cell_local_id_);
+    cell_face_offset_ = face_view_.CellFaceOffset(cell_local_id_);
     cell_num_nodes_ = cell_mapping_->NumNodes();
-    const auto& sigma_t = xs_.at(cell_->material_id_)->SigmaTotal();
 
     aah_sweep_depinterf.spls_index = spls_index;
 
+    // =============================================== Upwind/downwind faces
+    const int* upwind_faces;
+    const int* downwind_faces;
+    size_t num_upwind_faces;
+    size_t num_downwind_faces;
+    if (metadata)
+    {
+      upwind_faces = metadata->UpwindFaces(spls_index);
+      downwind_faces = metadata->DownwindFaces(spls_index);
+      num_upwind_faces = metadata->NumUpwindFaces(spls_index);
+      num_downwind_faces = metadata->NumDownwindFaces(spls_index);
+    }
+    else
+    {
+      upwind_faces_.clear();
+      downwind_faces_.clear();
+      for (int f = 0; f < cell_num_faces_; ++f)
+        if (face_orientations[f] == FaceOrientation::INCOMING)
+          upwind_faces_.push_back(f);
+        else if (face_orientations[f] == FaceOrientation::OUTGOING)
+          downwind_faces_.push_back(f);
+      upwind_faces = upwind_faces_.data();
+      downwind_faces = downwind_faces_.data();
+      num_upwind_faces = upwind_faces_.size();
+      num_downwind_faces = downwind_faces_.size();
+    }
+    const bool angular_metadata = metadata and metadata->HasAngularData();
+
     // =============================================== Get Cell matrices
     const auto& fe_intgrl_values = unit_cell_matrices_[cell_local_id_];
     G_ = &fe_intgrl_values.G_matrix;
@@ -111,8 +168,7 @@ void AAH_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
     M_surf_ = &fe_intgrl_values.face_M_matrices;
     IntS_shapeI_ = &fe_intgrl_values.face_Si_vectors;
 
-    for (auto& callback : cell_data_callbacks_)
-      callback();
+    KernelPipeline::CellData(*this);
 
     // =============================================== Loop over angles in set
     const int ni_deploc_face_counter = deploc_face_counter;
@@ -131,6 +187,10 @@ void AAH_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
       sweep_dependency_interface_.angle_set_index_ = as_ss_idx;
       sweep_dependency_interface_.angle_num_ = direction_num_;
 
+      cached_streaming_matrix_ =
+        angular_metadata ? metadata->StreamingMatrix(spls_index, as_ss_idx)
+                         : nullptr;
+
       deploc_face_counter = ni_deploc_face_counter;
       preloc_face_counter = ni_preloc_face_counter;
 
@@ -138,7 +198,7 @@ void AAH_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
       for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
         b_[gsg].assign(cell_num_nodes_, 0.0);
 
-      ExecuteKernels(direction_data_callbacks_and_kernels_);
+      KernelPipeline::DirectionData(*this);
 
       // ======================================== Upwinding structure
       aah_sweep_depinterf.in_face_counter = 0;
@@ -147,20 +207,28 @@ void AAH_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
       aah_sweep_depinterf.deploc_face_counter = 0;
 
       // ======================================== Update face orientations
-      face_mu_values_.assign(cell_num_faces_, 0.0);
-      for (int f = 0; f < cell_num_faces_; ++f)
-        face_mu_values_[f] = omega_.Dot(cell_->faces_[f].normal_);
+      if (angular_metadata)
+      {
+        const double* face_mu = metadata->FaceMu(spls_index, as_ss_idx);
+        face_mu_values_.assign(face_mu, face_mu + cell_num_faces_);
+      }
+      else
+      {
+        face_mu_values_.assign(cell_num_faces_, 0.0);
+        for (int f = 0; f < cell_num_faces_; ++f)
+          face_mu_values_[f] =
+            omega_.Dot(face_view_.Normal(cell_face_offset_ + f));
+      }
 
       // ======================================== Surface integrals
       int in_face_counter = -1;
-      for (int f = 0; f < cell_num_faces_; ++f)
+      for (size_t uf = 0; uf < num_upwind_faces; ++uf)
       {
-        const auto& face = cell_->faces_[f];
-
-        if (face_orientations[f] != FaceOrientation::INCOMING) continue;
+        const int f = upwind_faces[uf];
+        const size_t fi = cell_face_offset_ + f;
 
         const bool local = cell_transport_view_->IsFaceLocal(f);
-        const bool boundary = not face.has_neighbor_;
+        const bool boundary = not face_view_.HasNeighbor(fi);
 
         if (local) ++in_face_counter;
         else if (not boundary)
@@ -169,46 +237,39 @@ void AAH_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
         sweep_dependency_interface_.SetupIncomingFace(
           f,
           cell_mapping_->NumFaceNodes(f),
-          face.neighbor_id_,
+          face_view_.NeighborID(fi),
           local,
           boundary);
 
         aah_sweep_depinterf.in_face_counter = in_face_counter;
         aah_sweep_depinterf.preloc_face_counter = preloc_face_counter;
 
+        cached_face_node_map_ =
+          metadata ? metadata->FaceNodeMap(spls_index, f) : nullptr;
+
         // IntSf_mu_psi_Mij_dA
-        ExecuteKernels(surface_integral_kernels_);
+        KernelPipeline::SurfaceIntegrals(*this);
       } // for f
 
       // ======================================== Looping over groups,
       //                                          Assembling mass terms
-      for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
-      {
-        g_ = gs_gi_ + gsg;
-        gsg_ = gsg;
-        sigma_tg_ = sigma_t[g_];
-
-        ExecuteKernels(mass_term_kernels_);
-
-        // ================================= Solve system
-        chi_math::GaussElimination(Atemp_, b_[gsg], scint(cell_num_nodes_));
-      }
+      KernelPipeline::MassTermsAndSolves(*this);
 
       // ======================================== Flux updates
-      ExecuteKernels(flux_update_kernels_);
+      KernelPipeline::FluxUpdates(*this);
 
       // ======================================== Perform outgoing
       //                                               surface operations
       int out_face_counter = -1;
-      for (int f = 0; f < cell_num_faces_; ++f)
+      for (size_t df = 0; df < num_downwind_faces; ++df)
       {
-        if (face_orientations[f] != FaceOrientation::OUTGOING) continue;
+        const int f = downwind_faces[df];
 
         // ================================= Set flags and counters
         out_face_counter++;
-        const auto& face = cell_->faces_[f];
+        const size_t fi = cell_face_offset_ + f;
         const bool local = cell_transport_view_->IsFaceLocal(f);
-        const bool boundary = not face.has_neighbor_;
+        const bool boundary = not face_view_.HasNeighbor(fi);
         const int locality = cell_transport_view_->FaceLocality(f);
 
         if (not boundary and not local) ++deploc_face_counter;
@@ -216,7 +277,7 @@ void AAH_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
         sweep_dependency_interface_.SetupOutgoingFace(
           f,
           cell_mapping_->NumFaceNodes(f),
-          face.neighbor_id_,
+          face_view_.NeighborID(fi),
           local,
           boundary,
           locality);
@@ -227,16 +288,16 @@ void AAH_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
         OutgoingSurfaceOperations();
       } // for face
 
-      ExecuteKernels(post_cell_dir_sweep_callbacks_);
+      KernelPipeline::PostCellDirSweep(*this);
     } // for n
   }   // for cell
 }
 
 // ##################################################################
-const double*
+const PsiFloat*
 AAH_SweepDependencyInterface::GetUpwindPsi(int face_node_local_idx) const
 {
-  const double* psi;
+  const PsiFloat* psi;
   if (on_local_face_)
     psi = fluds_->UpwindPsi(
       spls_index, in_face_counter, face_node_local_idx, 0, angle_set_index_);
@@ -255,10 +316,10 @@ AAH_SweepDependencyInterface::GetUpwindPsi(int face_node_local_idx) const
   return psi;
 }
 
-double*
+PsiFloat*
 AAH_SweepDependencyInterface::GetDownwindPsi(int face_node_local_idx) const
 {
-  double* psi;
+  PsiFloat* psi;
   if (on_local_face_)
     psi = fluds_->OutgoingPsi(
       spls_index, out_face_counter, face_node_local_idx, angle_set_index_);
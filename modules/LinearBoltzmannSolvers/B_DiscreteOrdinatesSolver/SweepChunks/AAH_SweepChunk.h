@@ -2,6 +2,7 @@
 #define CHITECH_AAH_SWEEPCHUNK_H
 
 #include "SweepChunk.h"
+#include "SweepMetadata.h"
 
 #include "math/SpatialDiscretization/SpatialDiscretization.h"
 #include "LinearBoltzmannSolvers/A_LBSSolver/Groupset/lbs_groupset.h"
@@ -23,8 +24,8 @@ struct AAH_SweepDependencyInterface : public SweepDependencyInterface
   int out_face_counter = 0;
   int deploc_face_counter = 0;
 
-  const double* GetUpwindPsi(int face_node_local_idx) const override;
-  double* GetDownwindPsi(int face_node_local_idx) const override;
+  const PsiFloat* GetUpwindPsi(int face_node_local_idx) const override;
+  PsiFloat* GetDownwindPsi(int face_node_local_idx) const override;
 };
 
 // ##################################################################
@@ -47,6 +48,25 @@ public:
   // 01
   void Sweep(chi_mesh::sweep_management::AngleSet& angle_set) override;
 
+  /**Sets the cache of precomputed sweep metadata. The cache is only used
+   * with the compile-time kernel pipeline and can be shared between the
+   * sweep chunks of a groupset.*/
+  void SetSweepMetadataCache(std::shared_ptr<SweepMetadataCache> cache)
+  {
+    sweep_metadata_cache_ = std::move(cache);
+  }
+
+protected:
+  template <class KernelPipeline>
+  void SweepImpl(chi_mesh::sweep_management::AngleSet& angle_set,
+                 const SweepMetadata* metadata);
+
+  std::shared_ptr<SweepMetadataCache> sweep_metadata_cache_;
+
+  /**Upwind and downwind faces of the current cell when no metadata is
+   * available.*/
+  std::vector<int> upwind_faces_;
+  std::vector<int> downwind_faces_;
 };
 
 } // namespace lbs
@@ -1,4 +1,5 @@
 #include "CBC_SweepChunk.h"
+#include "SweepChunkKernels.h"
 
 #include "mesh/Cell/cell.h"
 #include "A_LBSSolver/Groupset/lbs_groupset.h"
@@ -45,6 +46,9 @@ CBC_SweepChunk::CBC_SweepChunk(
                  std::bind(&SweepChunk::KernelFEMUpwindSurfaceIntegrals, this));
   RegisterKernel("FEMSSTDMassTerms",
                  std::bind(&SweepChunk::KernelFEMSTDMassTerms, this));
+  RegisterKernel("FEMSTDMassTermsBatchedSolve",
+                 std::bind(&SweepChunk::KernelFEMSTDMassTermsBatchedSolve,
+                           this));
   RegisterKernel("KernelPhiUpdate",
                  std::bind(&SweepChunk::KernelPhiUpdate, this));
   RegisterKernel("KernelPsiUpdate",
@@ -59,9 +63,13 @@ CBC_SweepChunk::CBC_SweepChunk(
 
   mass_term_kernels_ = {Kernel("FEMSSTDMassTerms")};
 
+  group_subset_solve_kernels_ = {Kernel("FEMSTDMassTermsBatchedSolve")};
+
   flux_update_kernels_ = {Kernel("KernelPhiUpdate"), Kernel("KernelPsiUpdate")};
 
   post_cell_dir_sweep_callbacks_ = {};
+
+  standard_kernel_pipeline_available_ = true;
 }
 
 void CBC_SweepChunk::SetAngleSet(chi_mesh::sweep_management::AngleSet& angle_set)
@@ -97,7 +105,8 @@ void CBC_SweepChunk::SetCell(const chi_mesh::Cell* cell_ptr,
   cell_mapping_ = &grid_fe_view_.GetCellMapping(*cell_);
   cell_transport_view_ = &grid_transport_view_[cell_->local_id_];
 
-  cell_num_faces_ = cell_->faces_.size();
+  cell_num_faces_ = face_view_.NumFaces(cell_local_id_);
+  cell_face_offset_ = face_view_.CellFaceOffset(cell_local_id_);
   cell_num_nodes_ = cell_mapping_->NumNodes();
 
   // =============================================== Get Cell matrices
@@ -119,11 +128,19 @@ void CBC_SweepChunk::SetCells(const std::vector<const chi_mesh::Cell*>& cell_ptr
 }
 
 void CBC_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
+{
+  if (UseStandardKernelPipeline())
+    SweepImpl<StandardKernelPipeline>(angle_set);
+  else
+    SweepImpl<NamedKernelPipeline>(angle_set);
+}
+
+template <class KernelPipeline>
+void CBC_SweepChunk::SweepImpl(chi_mesh::sweep_management::AngleSet& angle_set)
 {
   using FaceOrientation = chi_mesh::sweep_management::FaceOrientation;
   const auto& face_orientations =
     angle_set.GetSPDS().CellFaceOrientations()[cell_local_id_];
-  const auto& sigma_t = xs_.at(cell_->material_id_)->SigmaTotal();
 
   // as = angle set
   // ss = subset
@@ -142,46 +159,40 @@ void CBC_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
     for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
       b_[gsg].assign(cell_num_nodes_, 0.0);
 
-    ExecuteKernels(direction_data_callbacks_and_kernels_);
+    KernelPipeline::DirectionData(*this);
 
     // ======================================== Update face orientations
     face_mu_values_.assign(cell_num_faces_, 0.0);
     for (int f = 0; f < cell_num_faces_; ++f)
-      face_mu_values_[f] = omega_.Dot(cell_->faces_[f].normal_);
+      face_mu_values_[f] = omega_.Dot(face_view_.Normal(cell_face_offset_ + f));
 
     // ======================================== Surface integrals
     for (int f = 0; f < cell_num_faces_; ++f)
     {
-      const auto& face = cell_->faces_[f];
-
       if (face_orientations[f] != FaceOrientation::INCOMING) continue;
 
+      const size_t fi = cell_face_offset_ + f;
+
       const bool local = cell_transport_view_->IsFaceLocal(f);
-      const bool boundary = not face.has_neighbor_;
+      const bool boundary = not face_view_.HasNeighbor(fi);
 
       sweep_dependency_interface_.SetupIncomingFace(
-        f, cell_mapping_->NumFaceNodes(f), face.neighbor_id_, local, boundary);
+        f,
+        cell_mapping_->NumFaceNodes(f),
+        face_view_.NeighborID(fi),
+        local,
+        boundary);
 
       // IntSf_mu_psi_Mij_dA
-      ExecuteKernels(surface_integral_kernels_);
+      KernelPipeline::SurfaceIntegrals(*this);
     } // for f
 
     // ======================================== Looping over groups,
     //                                          Assembling mass terms
-    for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
-    {
-      g_ = gs_gi_ + gsg;
-      gsg_ = gsg;
-      sigma_tg_ = sigma_t[g_];
-
-      ExecuteKernels(mass_term_kernels_);
-
-      // ================================= Solve system
-      chi_math::GaussElimination(Atemp_, b_[gsg], scint(cell_num_nodes_));
-    }
+    KernelPipeline::MassTermsAndSolves(*this);
 
     // ======================================== Flux updates
-    ExecuteKernels(flux_update_kernels_);
+    KernelPipeline::FluxUpdates(*this);
 
     // ======================================== Perform outgoing
     //                                          surface operations
@@ -190,15 +201,15 @@ void CBC_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
       if (face_orientations[f] != FaceOrientation::OUTGOING) continue;
 
       // ================================= Set flags and counters
-      const auto& face = cell_->faces_[f];
+      const size_t fi = cell_face_offset_ + f;
       const bool local = cell_transport_view_->IsFaceLocal(f);
-      const bool boundary = not face.has_neighbor_;
+      const bool boundary = not face_view_.HasNeighbor(fi);
       const int locality = cell_transport_view_->FaceLocality(f);
 
       sweep_dependency_interface_.SetupOutgoingFace(
         f,
         cell_mapping_->NumFaceNodes(f),
-        face.neighbor_id_,
+        face_view_.NeighborID(fi),
         local,
         boundary,
         locality);
@@ -206,7 +217,7 @@ void CBC_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
       OutgoingSurfaceOperations();
     } // for face
 
-    ExecuteKernels(post_cell_dir_sweep_callbacks_);
+    KernelPipeline::PostCellDirSweep(*this);
   } // for n
 }
 
@@ -229,9 +240,8 @@ void CBC_SweepDependencyInterface::SetupIncomingFace(int face_id,
   if (on_local_face_)
   {
     neighbor_cell_ptr_ = cell_transport_view_->FaceNeighbor(face_id);
-    psi_upwnd_data_block_ = &fluds_->GetLocalUpwindDataBlock();
     psi_local_face_upwnd_data_ = fluds_->GetLocalCellUpwindPsi(
-      *psi_upwnd_data_block_, *neighbor_cell_ptr_);
+      fluds_->GetLocalUpwindDataBlock(), *neighbor_cell_ptr_);
   }
   else if (not on_boundary_)
   {
@@ -276,18 +286,26 @@ void CBC_SweepDependencyInterface::SetupOutgoingFace(int face_id,
   }
 }
 
-const double*
+const PsiFloat*
 CBC_SweepDependencyInterface::GetUpwindPsi(int face_node_local_idx) const
 {
-  const double* psi;
+  const PsiFloat* psi;
   if (on_local_face_)
   {
     const unsigned int adj_cell_node =
       face_nodal_mapping_->cell_node_mapping_[face_node_local_idx];
 
-    return &psi_local_face_upwnd_data_[adj_cell_node * groupset_angle_group_stride_ +
+    const double* local_psi =
+      &psi_local_face_upwnd_data_[adj_cell_node * groupset_angle_group_stride_ +
                                   angle_num_ * groupset_group_stride_ +
                                   gs_ss_begin_];
+
+#ifdef CHI_SWEEP_SINGLE_PRECISION_PSI
+    psi_local_face_upwnd_buffer_.assign(local_psi, local_psi + group_stride_);
+    return psi_local_face_upwnd_buffer_.data();
+#else
+    return local_psi;
+#endif
   }
   else if (not on_boundary_)
   {
@@ -310,10 +328,10 @@ CBC_SweepDependencyInterface::GetUpwindPsi(int face_node_local_idx) const
   return psi;
 }
 
-double*
+PsiFloat*
 CBC_SweepDependencyInterface::GetDownwindPsi(int face_node_local_idx) const
 {
-  double* psi = nullptr;
+  PsiFloat* psi = nullptr;
 
   if (on_local_face_) psi = nullptr; // We don't write local face outputs
   else if (not on_boundary_)
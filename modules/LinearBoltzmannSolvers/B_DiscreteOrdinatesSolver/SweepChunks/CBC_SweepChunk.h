@@ -15,10 +15,13 @@ struct CBC_SweepDependencyInterface : public SweepDependencyInterface
   const chi_mesh::Cell* neighbor_cell_ptr_ = nullptr;
 
   /**Upwind angular flux*/
-  const std::vector<double>* psi_upwnd_data_block_ = nullptr;
+  const std::vector<PsiFloat>* psi_upwnd_data_block_ = nullptr;
   const double* psi_local_face_upwnd_data_ = nullptr;
+  /**Local upwind angular flux converted to PsiFloat, used when it differs
+   * from the precision of the destination psi.*/
+  mutable std::vector<PsiFloat> psi_local_face_upwnd_buffer_;
   /**Downwind angular flux*/
-  std::vector<double>* psi_dnwnd_data_ = nullptr;
+  std::vector<PsiFloat>* psi_dnwnd_data_ = nullptr;
 
   size_t group_stride_;
   size_t group_angle_stride_;
@@ -29,8 +32,8 @@ struct CBC_SweepDependencyInterface : public SweepDependencyInterface
   const chi_mesh::sweep_management::FaceNodalMapping* face_nodal_mapping_ =
     nullptr;
 
-  const double* GetUpwindPsi(int face_node_local_idx) const override;
-  double* GetDownwindPsi(int face_node_local_idx) const override;
+  const PsiFloat* GetUpwindPsi(int face_node_local_idx) const override;
+  PsiFloat* GetDownwindPsi(int face_node_local_idx) const override;
   void SetupIncomingFace(int face_id,
                          size_t num_face_nodes,
                          uint64_t neighbor_id,
@@ -69,6 +72,9 @@ public:
   void Sweep(chi_mesh::sweep_management::AngleSet& angle_set) override;
 
 protected:
+  template <class KernelPipeline>
+  void SweepImpl(chi_mesh::sweep_management::AngleSet& angle_set);
+
   CBC_SweepDependencyInterface& cbc_sweep_depinterf_;
   chi_mesh::Cell const* cell_ptr_ = nullptr;
   uint64_t cell_local_id_ = 0;
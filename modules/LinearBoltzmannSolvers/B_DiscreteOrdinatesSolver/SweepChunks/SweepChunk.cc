@@ -1,6 +1,8 @@
 #include "SweepChunk.h"
+#include "SweepChunkKernels.h"
 
 #include "A_LBSSolver/Groupset/lbs_groupset.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
 #include "math/SpatialDiscretization/FiniteElement/PiecewiseLinear/PieceWiseLinearDiscontinuous.h"
 
 #include "chi_runtime.h"
@@ -27,6 +29,7 @@ SweepChunk::SweepChunk(
   std::unique_ptr<SweepDependencyInterface> sweep_dependency_interface_ptr)
   : chi_mesh::sweep_management::SweepChunk(destination_phi, destination_psi),
     grid_(grid),
+    face_view_(grid.GetFlatFaceView()),
     grid_fe_view_(discretization),
     unit_cell_matrices_(unit_cell_matrices),
     grid_transport_view_(cell_transport_views),
@@ -47,6 +50,11 @@ SweepChunk::SweepChunk(
             std::vector<double>(max_num_cell_dofs, 0.0));
   source_.resize(max_num_cell_dofs, 0.0);
 
+  batch_stride_ = chi_math::PaddedBatchStride(groupset.groups_.size());
+  batched_A_.resize(max_num_cell_dofs * max_num_cell_dofs * batch_stride_);
+  batched_b_.resize(max_num_cell_dofs * batch_stride_);
+  batched_source_.resize(max_num_cell_dofs * batch_stride_);
+
   sweep_dependency_interface_.groupset_angle_group_stride_ =
     groupset_angle_group_stride_;
   sweep_dependency_interface_.groupset_group_stride_ = groupset_group_stride_;
@@ -81,6 +89,26 @@ void SweepChunk::ExecuteKernels(const std::vector<CallbackFunction>& kernels)
     kernel();
 }
 
+// ##################################################################
+/**Executes the mass term kernels and solves the cell system group by
+ * group.*/
+void SweepChunk::ExecuteGroupByGroupMassTermsAndSolves()
+{
+  const auto& sigma_t = xs_.at(cell_->material_id_)->SigmaTotal();
+
+  for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
+  {
+    g_ = gs_gi_ + gsg;
+    gsg_ = gsg;
+    sigma_tg_ = sigma_t[g_];
+
+    ExecuteKernels(mass_term_kernels_);
+
+    // ================================= Solve system
+    chi_math::GaussElimination(Atemp_, b_[gsg], scint(cell_num_nodes_));
+  }
+}
+
 // ##################################################################
 /**Operations when outgoing fluxes are handled including passing
  * face angular fluxes downstream and computing
@@ -102,7 +130,7 @@ void SweepChunk::OutgoingSurfaceOperations()
   {
     const int i = cell_mapping_->MapFaceNode(f, fi);
 
-    double* psi = sweep_dependency_interface_.GetDownwindPsi(fi);
+    PsiFloat* psi = sweep_dependency_interface_.GetDownwindPsi(fi);
 
     if (psi != nullptr)
       if (not on_boundary or is_reflecting_boundary)
@@ -116,121 +144,6 @@ void SweepChunk::OutgoingSurfaceOperations()
   } // for fi
 }
 
-// ##################################################################
-/**Assembles the volumetric gradient term.*/
-void SweepChunk::KernelFEMVolumetricGradientTerm()
-{
-  const auto& G = *G_;
-
-  for (int i = 0; i < cell_num_nodes_; ++i)
-    for (int j = 0; j < cell_num_nodes_; ++j)
-      Amat_[i][j] = omega_.Dot(G[i][j]);
-}
-
-// ##################################################################
-/**Performs the integral over the surface of a face.*/
-void SweepChunk::KernelFEMUpwindSurfaceIntegrals()
-{
-  const size_t f = sweep_dependency_interface_.current_face_idx_;
-  const auto& M_surf_f = (*M_surf_)[f];
-  const double mu = face_mu_values_[f];
-  const size_t num_face_nodes = sweep_dependency_interface_.num_face_nodes_;
-  for (int fi = 0; fi < num_face_nodes; ++fi)
-  {
-    const int i = cell_mapping_->MapFaceNode(f, fi);
-    for (int fj = 0; fj < num_face_nodes; ++fj)
-    {
-      const int j = cell_mapping_->MapFaceNode(f, fj);
-
-      const double* psi = sweep_dependency_interface_.GetUpwindPsi(fj);
-
-      const double mu_Nij = -mu * M_surf_f[i][j];
-      Amat_[i][j] += mu_Nij;
-
-      if (psi == nullptr) continue;
-
-      for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
-        b_[gsg][i] += psi[gsg] * mu_Nij;
-    } // for face node j
-  }   // for face node i
-}
-
-// ##################################################################
-/**Assembles angular sources and applies the mass matrix terms.*/
-void SweepChunk::KernelFEMSTDMassTerms()
-{
-  const auto& M = *M_;
-  const auto& m2d_op = groupset_.quadrature_->GetMomentToDiscreteOperator();
-
-  // ============================= Contribute source moments
-  // q = M_n^T * q_moms
-  for (int i = 0; i < cell_num_nodes_; ++i)
-  {
-    double temp_src = 0.0;
-    for (int m = 0; m < num_moments_; ++m)
-    {
-      const size_t ir = cell_transport_view_->MapDOF(i, m, scint(g_));
-      temp_src += m2d_op[m][direction_num_] * q_moments_[ir];
-    } // for m
-    source_[i] = temp_src;
-  } // for i
-
-  // ============================= Mass Matrix and Source
-  // Atemp  = Amat + sigma_tgr * M
-  // b     += M * q
-  for (int i = 0; i < cell_num_nodes_; ++i)
-  {
-    double temp = 0.0;
-    for (int j = 0; j < cell_num_nodes_; ++j)
-    {
-      const double Mij = M[i][j];
-      Atemp_[i][j] = Amat_[i][j] + Mij * sigma_tg_;
-      temp += Mij * source_[j];
-    } // for j
-    b_[gsg_][i] += temp;
-  } // for i
-}
-
-// ##################################################################
-/**Adds a single direction's contribution to the moment integrals.*/
-void SweepChunk::KernelPhiUpdate()
-{
-  const auto& d2m_op = groupset_.quadrature_->GetDiscreteToMomentOperator();
-
-  auto& output_phi = GetDestinationPhi();
-
-  for (int m = 0; m < num_moments_; ++m)
-  {
-    const double wn_d2m = d2m_op[m][direction_num_];
-    for (int i = 0; i < cell_num_nodes_; ++i)
-    {
-      const size_t ir = cell_transport_view_->MapDOF(i, m, gs_gi_);
-      for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
-        output_phi[ir + gsg] += wn_d2m * b_[gsg][i];
-    }
-  }
-}
-
-// ##################################################################
-/**Updates angular fluxes.*/
-void SweepChunk::KernelPsiUpdate()
-{
-  if (not save_angular_flux_) return;
-
-  auto& output_psi = GetDestinationPsi();
-  double* cell_psi_data = &output_psi[grid_fe_view_.MapDOFLocal(
-    *cell_, 0, groupset_.psi_uk_man_, 0, 0)];
-
-
-  for (size_t i = 0; i < cell_num_nodes_; ++i)
-  {
-    const size_t imap = i * groupset_angle_group_stride_ +
-                        direction_num_ * groupset_group_stride_ + gs_ss_begin_;
-    for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
-      cell_psi_data[imap + gsg] = b_[gsg][i];
-  } // for i
-}
-
 // ##################################################################
 /**Sets data for the current incoming face.*/
 void SweepDependencyInterface::SetupIncomingFace(int face_id,
@@ -3,6 +3,7 @@
 
 #include "mesh/SweepUtilities/sweepchunk_base.h"
 #include "A_LBSSolver/lbs_structs.h"
+#include "math/chi_math_batched_linear_algebra.h"
 
 namespace chi_math
 {
@@ -11,6 +12,9 @@ class CellMapping;
 
 namespace lbs
 {
+class AngularFluxStore;
+
+using chi_mesh::sweep_management::PsiFloat;
 
 struct SweepDependencyInterface
 {
@@ -43,8 +47,8 @@ public:
 
   SweepDependencyInterface() = default;
 
-  virtual const double* GetUpwindPsi(int face_node_local_idx) const = 0;
-  virtual double* GetDownwindPsi(int face_node_local_idx) const = 0;
+  virtual const PsiFloat* GetUpwindPsi(int face_node_local_idx) const = 0;
+  virtual PsiFloat* GetDownwindPsi(int face_node_local_idx) const = 0;
 
   virtual void SetupIncomingFace(int face_id,
                                  size_t num_face_nodes,
@@ -80,10 +84,30 @@ public:
     int max_num_cell_dofs,
     std::unique_ptr<SweepDependencyInterface> sweep_dependency_interface_ptr);
 
+  /**When set, the sweep executes the registered, named kernels even when
+   * the compile-time kernel pipeline is available. Mostly useful for
+   * comparing the two.*/
+  void SetForceNamedKernels(bool value) { force_named_kernels_ = value; }
+
+  /**Sets a store as the destination of the angular fluxes, used instead of
+   * the destination psi vector when the angular fluxes are not held in a
+   * plain double precision array.*/
+  void SetDestinationPsiStore(AngularFluxStore* store)
+  {
+    psi_store_ = store;
+    psi_store_buffer_.assign(store != nullptr ? groupset_group_stride_ : 0,
+                             0.0);
+    save_angular_flux_ = store != nullptr or not GetDestinationPsi().empty();
+  }
+
 protected:
   typedef std::function<void()> CallbackFunction;
 
+  struct NamedKernelPipeline;
+  struct StandardKernelPipeline;
+
   const chi_mesh::MeshContinuum& grid_;
+  const chi_mesh::FlatFaceView& face_view_;
   const chi_math::SpatialDiscretization& grid_fe_view_;
   const std::vector<UnitCellMatrices>& unit_cell_matrices_;
   std::vector<lbs::CellLBSView>& grid_transport_view_;
@@ -91,7 +115,9 @@ protected:
   const LBSGroupset& groupset_;
   const std::map<int, XSPtr>& xs_;
   const int num_moments_;
-  const bool save_angular_flux_;
+  bool save_angular_flux_;
+  AngularFluxStore* psi_store_ = nullptr;
+  std::vector<double> psi_store_buffer_;
 
   std::unique_ptr<SweepDependencyInterface> sweep_dependency_interface_ptr_;
   SweepDependencyInterface& sweep_dependency_interface_;
@@ -109,18 +135,32 @@ protected:
   std::vector<double> source_;
   std::vector<std::vector<double>> b_;
 
+  // Group-innermost buffers for the batched solve
+  size_t batch_stride_ = 0;
+  chi_math::AlignedVecDbl batched_A_;
+  chi_math::AlignedVecDbl batched_b_;
+  chi_math::AlignedVecDbl batched_source_;
+
   // Cell items
   uint64_t cell_local_id_ = 0;
   const chi_mesh::Cell* cell_ = nullptr;
   const chi_math::CellMapping* cell_mapping_ = nullptr;
   CellLBSView* cell_transport_view_ = nullptr;
   size_t cell_num_faces_ = 0;
+  size_t cell_face_offset_ = 0; ///< First face of the cell in face_view_
   size_t cell_num_nodes_ = 0;
   const MatVec3* G_ = nullptr;
   const MatDbl* M_ = nullptr;
   const std::vector<MatDbl>* M_surf_ = nullptr;
   const std::vector<VecDbl>* IntS_shapeI_ = nullptr;
 
+  /**Precomputed face-node map of the current face and streaming matrix of
+   * the current cell and direction, when available from a SweepMetadata
+   * cache. `nullptr` otherwise.*/
+  const int* cached_face_node_map_ = nullptr;
+  const double* cached_streaming_matrix_ = nullptr;
+  std::vector<int> face_node_map_;
+
   /**Callbacks at phase 1 : cell data established*/
   std::vector<CallbackFunction> cell_data_callbacks_;
 
@@ -142,12 +182,31 @@ protected:
   /**Callbacks at phase 4 : group by group mass terms*/
   std::vector<CallbackFunction> mass_term_kernels_;
 
+  /**Callbacks at phase 4, alternative : mass terms and solves for all the
+   * groups of the group subset at once. When not empty these replace the
+   * group by group mass term kernels and solves, therefore derived classes
+   * that modify the mass terms must clear this.*/
+  std::vector<CallbackFunction> group_subset_solve_kernels_;
+
   /**Callbacks at phase 5 : flux updates*/
   std::vector<CallbackFunction> flux_update_kernels_;
 
   /**Callbacks at phase 6 : Post cell-dir sweep*/
   std::vector<CallbackFunction> post_cell_dir_sweep_callbacks_;
 
+  /**Set by derived sweep chunks whose kernel lists are exactly the ones
+   * of the StandardKernelPipeline. Sweep chunks that modify any of the
+   * kernel lists must unset this.*/
+  bool standard_kernel_pipeline_available_ = false;
+  bool force_named_kernels_ = false;
+
+  /**Returns `true` if the sweep should use the StandardKernelPipeline
+   * instead of the NamedKernelPipeline.*/
+  bool UseStandardKernelPipeline() const
+  {
+    return standard_kernel_pipeline_available_ and not force_named_kernels_;
+  }
+
   // 02 operations
   /**Registers a kernel as a named callback function*/
   void RegisterKernel(const std::string& name, CallbackFunction function);
@@ -155,6 +214,7 @@ protected:
   CallbackFunction Kernel(const std::string& name) const;
   /**Executes the supplied kernels list.*/
   static void ExecuteKernels(const std::vector<CallbackFunction>& kernels);
+  void ExecuteGroupByGroupMassTermsAndSolves();
   virtual void OutgoingSurfaceOperations();
 
   // kernels
@@ -162,6 +222,7 @@ public: // public so that we can use bind
   void KernelFEMVolumetricGradientTerm();
   void KernelFEMUpwindSurfaceIntegrals();
   void KernelFEMSTDMassTerms();
+  void KernelFEMSTDMassTermsBatchedSolve();
   void KernelPhiUpdate();
   void KernelPsiUpdate();
 
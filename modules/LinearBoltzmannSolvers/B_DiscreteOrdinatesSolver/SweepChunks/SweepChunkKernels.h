@@ -0,0 +1,304 @@
+#ifndef CHITECH_SWEEPCHUNKKERNELS_H
+#define CHITECH_SWEEPCHUNKKERNELS_H
+
+#include "SweepChunk.h"
+
+#include "A_LBSSolver/Groupset/lbs_groupset.h"
+#include "A_LBSSolver/Tools/lbs_angular_flux_store.h"
+#include "math/SpatialDiscretization/SpatialDiscretization.h"
+#include "math/SpatialDiscretization/CellMappings/CellMapping.h"
+
+/**\file The standard sweep chunk kernels. These are defined inline in a
+ * header so that the compile-time kernel pipeline can inline them into
+ * the sweep loops of the derived sweep chunks.*/
+
+namespace lbs
+{
+
+// ##################################################################
+/**Assembles the volumetric gradient term.*/
+inline void SweepChunk::KernelFEMVolumetricGradientTerm()
+{
+  if (cached_streaming_matrix_)
+  {
+    const double* A = cached_streaming_matrix_;
+    for (int i = 0; i < cell_num_nodes_; ++i)
+      for (int j = 0; j < cell_num_nodes_; ++j)
+        Amat_[i][j] = A[i * cell_num_nodes_ + j];
+    return;
+  }
+
+  const auto& G = *G_;
+
+  for (int i = 0; i < cell_num_nodes_; ++i)
+    for (int j = 0; j < cell_num_nodes_; ++j)
+      Amat_[i][j] = omega_.Dot(G[i][j]);
+}
+
+// ##################################################################
+/**Performs the integral over the surface of a face.*/
+inline void SweepChunk::KernelFEMUpwindSurfaceIntegrals()
+{
+  const size_t f = sweep_dependency_interface_.current_face_idx_;
+  const auto& M_surf_f = (*M_surf_)[f];
+  const double mu = face_mu_values_[f];
+  const size_t num_face_nodes = sweep_dependency_interface_.num_face_nodes_;
+
+  const int* face_node_map = cached_face_node_map_;
+  if (face_node_map == nullptr)
+  {
+    face_node_map_.resize(num_face_nodes);
+    for (int fi = 0; fi < num_face_nodes; ++fi)
+      face_node_map_[fi] = cell_mapping_->MapFaceNode(f, fi);
+    face_node_map = face_node_map_.data();
+  }
+
+  for (int fi = 0; fi < num_face_nodes; ++fi)
+  {
+    const int i = face_node_map[fi];
+    for (int fj = 0; fj < num_face_nodes; ++fj)
+    {
+      const int j = face_node_map[fj];
+
+      const PsiFloat* psi = sweep_dependency_interface_.GetUpwindPsi(fj);
+
+      const double mu_Nij = -mu * M_surf_f[i][j];
+      Amat_[i][j] += mu_Nij;
+
+      if (psi == nullptr) continue;
+
+      for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
+        b_[gsg][i] += psi[gsg] * mu_Nij;
+    } // for face node j
+  }   // for face node i
+}
+
+// ##################################################################
+/**Assembles angular sources and applies the mass matrix terms.*/
+inline void SweepChunk::KernelFEMSTDMassTerms()
+{
+  const auto& M = *M_;
+  const auto& m2d_op = groupset_.quadrature_->GetMomentToDiscreteOperator();
+
+  // ============================= Contribute source moments
+  // q = M_n^T * q_moms
+  for (int i = 0; i < cell_num_nodes_; ++i)
+  {
+    double temp_src = 0.0;
+    for (int m = 0; m < num_moments_; ++m)
+    {
+      const size_t ir = cell_transport_view_->MapDOF(i, m, static_cast<int>(g_));
+      temp_src += m2d_op[m][direction_num_] * q_moments_[ir];
+    } // for m
+    source_[i] = temp_src;
+  } // for i
+
+  // ============================= Mass Matrix and Source
+  // Atemp  = Amat + sigma_tgr * M
+  // b     += M * q
+  for (int i = 0; i < cell_num_nodes_; ++i)
+  {
+    double temp = 0.0;
+    for (int j = 0; j < cell_num_nodes_; ++j)
+    {
+      const double Mij = M[i][j];
+      Atemp_[i][j] = Amat_[i][j] + Mij * sigma_tg_;
+      temp += Mij * source_[j];
+    } // for j
+    b_[gsg_][i] += temp;
+  } // for i
+}
+
+// ##################################################################
+/**Assembles angular sources, applies the mass matrix terms and solves the
+ * cell systems of all the groups in the group subset at once. The systems
+ * only differ by \f$ \sigma_{tg} M \f$ and are stored group-innermost so
+ * that all the loops over groups have unit stride and vectorize. This is
+ * equivalent to executing KernelFEMSTDMassTerms followed by
+ * chi_math::GaussElimination for each group.*/
+inline void SweepChunk::KernelFEMSTDMassTermsBatchedSolve()
+{
+  const auto& M = *M_;
+  const auto& m2d_op = groupset_.quadrature_->GetMomentToDiscreteOperator();
+  const auto& sigma_t = xs_.at(cell_->material_id_)->SigmaTotal();
+
+  const int n = static_cast<int>(cell_num_nodes_);
+  const size_t num_groups = gs_ss_size_;
+  const size_t S = batch_stride_;
+
+  double* A = batched_A_.data();
+  double* b = batched_b_.data();
+  double* q = batched_source_.data();
+  const double* sigma_tg = &sigma_t[gs_gi_];
+
+  // ============================= Contribute source moments
+  // q = M_n^T * q_moms
+  for (int i = 0; i < n; ++i)
+  {
+    double* q_i = &q[i * S];
+    for (size_t gsg = 0; gsg < num_groups; ++gsg)
+      q_i[gsg] = 0.0;
+
+    for (int m = 0; m < num_moments_; ++m)
+    {
+      const double w = m2d_op[m][direction_num_];
+      const double* q_mom =
+        &q_moments_[cell_transport_view_->MapDOF(i, m, gs_gi_)];
+      for (size_t gsg = 0; gsg < num_groups; ++gsg)
+        q_i[gsg] += w * q_mom[gsg];
+    } // for m
+  } // for i
+
+  // ============================= Mass Matrix and Source
+  // A  = Amat + sigma_tg * M
+  // b  = b + M * q
+  for (int i = 0; i < n; ++i)
+  {
+    double* b_i = &b[i * S];
+    for (size_t gsg = 0; gsg < num_groups; ++gsg)
+      b_i[gsg] = b_[gsg][i];
+
+    for (int j = 0; j < n; ++j)
+    {
+      const double Mij = M[i][j];
+      const double Amat_ij = Amat_[i][j];
+      double* A_ij = &A[(i * n + j) * S];
+      const double* q_j = &q[j * S];
+      for (size_t gsg = 0; gsg < num_groups; ++gsg)
+      {
+        A_ij[gsg] = Amat_ij + Mij * sigma_tg[gsg];
+        b_i[gsg] += Mij * q_j[gsg];
+      }
+    } // for j
+  } // for i
+
+  // ============================= Solve systems
+  chi_math::BatchedGaussElimination(A, b, n, num_groups, S);
+
+  for (int i = 0; i < n; ++i)
+    for (size_t gsg = 0; gsg < num_groups; ++gsg)
+      b_[gsg][i] = b[i * S + gsg];
+}
+
+// ##################################################################
+/**Adds a single direction's contribution to the moment integrals.*/
+inline void SweepChunk::KernelPhiUpdate()
+{
+  const auto& d2m_op = groupset_.quadrature_->GetDiscreteToMomentOperator();
+
+  auto& output_phi = GetDestinationPhi();
+
+  for (int m = 0; m < num_moments_; ++m)
+  {
+    const double wn_d2m = d2m_op[m][direction_num_];
+    for (int i = 0; i < cell_num_nodes_; ++i)
+    {
+      const size_t ir = cell_transport_view_->MapDOF(i, m, gs_gi_);
+      for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
+        output_phi[ir + gsg] += wn_d2m * b_[gsg][i];
+    }
+  }
+}
+
+// ##################################################################
+/**Updates angular fluxes.*/
+inline void SweepChunk::KernelPsiUpdate()
+{
+  if (not save_angular_flux_) return;
+
+  const int64_t cell_psi_address =
+    grid_fe_view_.MapDOFLocal(*cell_, 0, groupset_.psi_uk_man_, 0, 0);
+
+  if (psi_store_ != nullptr)
+  {
+    // The values of a node are contiguous, they are gathered and stored at
+    // once.
+    for (size_t i = 0; i < cell_num_nodes_; ++i)
+    {
+      const size_t imap = i * groupset_angle_group_stride_ +
+                          direction_num_ * groupset_group_stride_ +
+                          gs_ss_begin_;
+      for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
+        psi_store_buffer_[gsg] = b_[gsg][i];
+      psi_store_->Store(cell_psi_address + imap, gs_ss_size_,
+                        psi_store_buffer_.data());
+    } // for i
+    return;
+  }
+
+  auto& output_psi = GetDestinationPsi();
+  double* cell_psi_data = &output_psi[cell_psi_address];
+
+  for (size_t i = 0; i < cell_num_nodes_; ++i)
+  {
+    const size_t imap = i * groupset_angle_group_stride_ +
+                        direction_num_ * groupset_group_stride_ + gs_ss_begin_;
+    for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
+      cell_psi_data[imap + gsg] = b_[gsg][i];
+  } // for i
+}
+
+// ##################################################################
+/**Kernel pipeline executing the registered, named kernels. This is the
+ * extensible pipeline, derived sweep chunks can register and insert
+ * their own kernels.*/
+struct SweepChunk::NamedKernelPipeline
+{
+  static void CellData(SweepChunk& chunk)
+  {
+    ExecuteKernels(chunk.cell_data_callbacks_);
+  }
+  static void DirectionData(SweepChunk& chunk)
+  {
+    ExecuteKernels(chunk.direction_data_callbacks_and_kernels_);
+  }
+  static void SurfaceIntegrals(SweepChunk& chunk)
+  {
+    ExecuteKernels(chunk.surface_integral_kernels_);
+  }
+  static void MassTermsAndSolves(SweepChunk& chunk)
+  {
+    if (not chunk.group_subset_solve_kernels_.empty())
+      ExecuteKernels(chunk.group_subset_solve_kernels_);
+    else
+      chunk.ExecuteGroupByGroupMassTermsAndSolves();
+  }
+  static void FluxUpdates(SweepChunk& chunk)
+  {
+    ExecuteKernels(chunk.flux_update_kernels_);
+  }
+  static void PostCellDirSweep(SweepChunk& chunk)
+  {
+    ExecuteKernels(chunk.post_cell_dir_sweep_callbacks_);
+  }
+};
+
+// ##################################################################
+/**Kernel pipeline calling the standard kernels directly. The calls are
+ * resolved at compile time and can be inlined into the sweep loop.*/
+struct SweepChunk::StandardKernelPipeline
+{
+  static void CellData(SweepChunk&) {}
+  static void DirectionData(SweepChunk& chunk)
+  {
+    chunk.KernelFEMVolumetricGradientTerm();
+  }
+  static void SurfaceIntegrals(SweepChunk& chunk)
+  {
+    chunk.KernelFEMUpwindSurfaceIntegrals();
+  }
+  static void MassTermsAndSolves(SweepChunk& chunk)
+  {
+    chunk.KernelFEMSTDMassTermsBatchedSolve();
+  }
+  static void FluxUpdates(SweepChunk& chunk)
+  {
+    chunk.KernelPhiUpdate();
+    chunk.KernelPsiUpdate();
+  }
+  static void PostCellDirSweep(SweepChunk&) {}
+};
+
+} // namespace lbs
+
+#endif // CHITECH_SWEEPCHUNKKERNELS_H
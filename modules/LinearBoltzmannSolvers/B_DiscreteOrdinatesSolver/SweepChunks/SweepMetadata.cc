@@ -0,0 +1,193 @@
+#include "SweepMetadata.h"
+
+#include "A_LBSSolver/Groupset/lbs_groupset.h"
+
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+#include "mesh/SweepUtilities/AngleSet/AngleSet.h"
+#include "math/SpatialDiscretization/SpatialDiscretization.h"
+#include "math/SpatialDiscretization/CellMappings/CellMapping.h"
+
+namespace lbs
+{
+
+// ##################################################################
+/**Builds the metadata of the given angleset.*/
+SweepMetadata::SweepMetadata(
+  const chi_mesh::sweep_management::AngleSet& angle_set,
+  const LBSGroupset& groupset,
+  const chi_mesh::MeshContinuum& grid,
+  const chi_math::SpatialDiscretization& discretization,
+  const std::vector<UnitCellMatrices>& unit_cell_matrices,
+  bool include_angular_data)
+  : num_angles_(angle_set.GetAngleIndices().size()),
+    has_angular_data_(include_angular_data)
+{
+  using namespace chi_mesh::sweep_management;
+
+  const auto& spds = angle_set.GetSPDS();
+  const auto& spls = spds.GetSPLS().item_id;
+  const auto& face_orientations = spds.CellFaceOrientations();
+  const auto& angle_indices = angle_set.GetAngleIndices();
+  const auto& omegas = groupset.quadrature_->omegas_;
+  const size_t num_cells = spls.size();
+
+  cell_face_offsets_.reserve(num_cells + 1);
+  upwind_face_offsets_.reserve(num_cells + 1);
+  downwind_face_offsets_.reserve(num_cells + 1);
+  cell_face_offsets_.push_back(0);
+  upwind_face_offsets_.push_back(0);
+  downwind_face_offsets_.push_back(0);
+  face_node_offsets_.push_back(0);
+  if (has_angular_data_) streaming_offsets_.push_back(0);
+
+  for (size_t c = 0; c < num_cells; ++c)
+  {
+    const auto& cell = grid.local_cells[spls[c]];
+    const auto& cell_mapping = discretization.GetCellMapping(cell);
+    const size_t num_faces = cell.faces_.size();
+    const size_t num_nodes = cell_mapping.NumNodes();
+
+    //=========================================== Geometric data
+    for (size_t f = 0; f < num_faces; ++f)
+    {
+      const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
+      for (size_t fi = 0; fi < num_face_nodes; ++fi)
+        face_node_maps_.push_back(cell_mapping.MapFaceNode(f, fi));
+      face_node_offsets_.push_back(face_node_maps_.size());
+
+      const auto orientation = face_orientations[spls[c]][f];
+      if (orientation == FaceOrientation::INCOMING)
+        upwind_faces_.push_back(static_cast<int>(f));
+      else if (orientation == FaceOrientation::OUTGOING)
+        downwind_faces_.push_back(static_cast<int>(f));
+    }
+    cell_face_offsets_.push_back(cell_face_offsets_.back() + num_faces);
+    upwind_face_offsets_.push_back(upwind_faces_.size());
+    downwind_face_offsets_.push_back(downwind_faces_.size());
+
+    if (not has_angular_data_) continue;
+
+    //=========================================== Per-direction data
+    const auto& G = unit_cell_matrices[spls[c]].G_matrix;
+    for (const size_t direction_num : angle_indices)
+    {
+      const auto& omega = omegas[direction_num];
+      for (size_t f = 0; f < num_faces; ++f)
+        face_mu_.push_back(omega.Dot(cell.faces_[f].normal_));
+
+      for (size_t i = 0; i < num_nodes; ++i)
+        for (size_t j = 0; j < num_nodes; ++j)
+          streaming_matrices_.push_back(omega.Dot(G[i][j]));
+    }
+    streaming_offsets_.push_back(streaming_matrices_.size());
+  } // for cell
+
+  face_node_offsets_.shrink_to_fit();
+  face_node_maps_.shrink_to_fit();
+  upwind_faces_.shrink_to_fit();
+  downwind_faces_.shrink_to_fit();
+  face_mu_.shrink_to_fit();
+  streaming_offsets_.shrink_to_fit();
+  streaming_matrices_.shrink_to_fit();
+}
+
+// ##################################################################
+/**Computes the memory footprint without building the metadata.*/
+std::pair<size_t, size_t> SweepMetadata::EstimateMemory(
+  const chi_mesh::sweep_management::AngleSet& angle_set,
+  const chi_mesh::MeshContinuum& grid,
+  const chi_math::SpatialDiscretization& discretization)
+{
+  const auto& spls = angle_set.GetSPDS().GetSPLS().item_id;
+  const size_t num_angles = angle_set.GetAngleIndices().size();
+  const size_t num_cells = spls.size();
+
+  size_t num_faces = 0;
+  size_t num_face_nodes = 0;
+  size_t num_streaming_entries = 0;
+  for (const auto cell_local_id : spls)
+  {
+    const auto& cell = grid.local_cells[cell_local_id];
+    const auto& cell_mapping = discretization.GetCellMapping(cell);
+    const size_t num_nodes = cell_mapping.NumNodes();
+
+    num_faces += cell.faces_.size();
+    for (size_t f = 0; f < cell.faces_.size(); ++f)
+      num_face_nodes += cell_mapping.NumFaceNodes(f);
+    num_streaming_entries += num_nodes * num_nodes;
+  }
+
+  // Every face is at most one of upwind or downwind
+  const size_t geometric =
+    (3 * (num_cells + 1) + num_faces + 1) * sizeof(size_t) +
+    (num_face_nodes + num_faces) * sizeof(int);
+  const size_t angular =
+    (num_cells + 1) * sizeof(size_t) +
+    num_angles * (num_faces + num_streaming_entries) * sizeof(double);
+
+  return {geometric, angular};
+}
+
+// ##################################################################
+/**Returns the memory, in bytes, occupied by the metadata.*/
+size_t SweepMetadata::MemoryUsage() const
+{
+  return (cell_face_offsets_.size() + face_node_offsets_.size() +
+          upwind_face_offsets_.size() + downwind_face_offsets_.size() +
+          streaming_offsets_.size()) *
+           sizeof(size_t) +
+         (face_node_maps_.size() + upwind_faces_.size() +
+          downwind_faces_.size()) *
+           sizeof(int) +
+         (face_mu_.size() + streaming_matrices_.size()) * sizeof(double);
+}
+
+// ##################################################################
+SweepMetadataCache::SweepMetadataCache(
+  const LBSGroupset& groupset,
+  const chi_mesh::MeshContinuum& grid,
+  const chi_math::SpatialDiscretization& discretization,
+  const std::vector<UnitCellMatrices>& unit_cell_matrices,
+  size_t memory_budget)
+  : groupset_(groupset),
+    grid_(grid),
+    discretization_(discretization),
+    unit_cell_matrices_(unit_cell_matrices),
+    memory_budget_(memory_budget)
+{
+}
+
+// ##################################################################
+const SweepMetadata* SweepMetadataCache::GetMetadata(
+  const chi_mesh::sweep_management::AngleSet& angle_set)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  auto it = metadata_.find(&angle_set);
+  if (it != metadata_.end()) return it->second.get();
+
+  //================================================== Build if it fits
+  // Anglesets that do not fit get a null entry so that the estimate is not
+  // repeated on every sweep. The estimate is exact for the arrays' contents
+  // hence the memory used never exceeds the budget.
+  const auto [geometric, angular] =
+    SweepMetadata::EstimateMemory(angle_set, grid_, discretization_);
+  const size_t available = memory_budget_ - memory_used_;
+
+  std::unique_ptr<SweepMetadata> metadata;
+  if (geometric <= available)
+  {
+    const bool include_angular_data = geometric + angular <= available;
+    metadata = std::make_unique<SweepMetadata>(angle_set,
+                                               groupset_,
+                                               grid_,
+                                               discretization_,
+                                               unit_cell_matrices_,
+                                               include_angular_data);
+    memory_used_ += metadata->MemoryUsage();
+  }
+
+  return (metadata_[&angle_set] = std::move(metadata)).get();
+}
+
+} // namespace lbs
@@ -0,0 +1,161 @@
+#ifndef CHITECH_LBS_SWEEPMETADATA_H
+#define CHITECH_LBS_SWEEPMETADATA_H
+
+#include "A_LBSSolver/lbs_structs.h"
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace chi_mesh
+{
+class MeshContinuum;
+namespace sweep_management
+{
+class AngleSet;
+}
+} // namespace chi_mesh
+
+namespace chi_math
+{
+class SpatialDiscretization;
+}
+
+namespace lbs
+{
+
+class LBSGroupset;
+
+// ##################################################################
+/**Geometric sweep data of a single angleset that does not change between
+ * sweeps. Cells are indexed by their position in the angleset's sweep
+ * ordering (SPLS) and directions by their index in the angleset.
+ *
+ * All items are stored in flat arrays, one array per item:
+ * - the upwind and downwind face lists of each cell,
+ * - the face-node to cell-node maps of each face,
+ * - and, optionally, the per-direction face \f$ \Omega \cdot n_f \f$ values
+ *   and streaming matrices \f$ A_{ij} = \Omega \cdot G_{ij} \f$.
+ *
+ * The per-direction data is by far the largest part, hence it can be left
+ * out when memory is limited.*/
+class SweepMetadata
+{
+public:
+  SweepMetadata(const chi_mesh::sweep_management::AngleSet& angle_set,
+                const LBSGroupset& groupset,
+                const chi_mesh::MeshContinuum& grid,
+                const chi_math::SpatialDiscretization& discretization,
+                const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                bool include_angular_data);
+
+  /**Returns the memory, in bytes, that the geometric part and the
+   * per-direction part of the metadata of the given angleset would
+   * occupy.*/
+  static std::pair<size_t, size_t>
+  EstimateMemory(const chi_mesh::sweep_management::AngleSet& angle_set,
+                 const chi_mesh::MeshContinuum& grid,
+                 const chi_math::SpatialDiscretization& discretization);
+
+  bool HasAngularData() const { return has_angular_data_; }
+  size_t MemoryUsage() const;
+
+  size_t NumUpwindFaces(size_t c) const
+  {
+    return upwind_face_offsets_[c + 1] - upwind_face_offsets_[c];
+  }
+  const int* UpwindFaces(size_t c) const
+  {
+    return &upwind_faces_[upwind_face_offsets_[c]];
+  }
+  size_t NumDownwindFaces(size_t c) const
+  {
+    return downwind_face_offsets_[c + 1] - downwind_face_offsets_[c];
+  }
+  const int* DownwindFaces(size_t c) const
+  {
+    return &downwind_faces_[downwind_face_offsets_[c]];
+  }
+
+  /**Cell node indices of the nodes of face `f` of cell `c`.*/
+  const int* FaceNodeMap(size_t c, size_t f) const
+  {
+    return &face_node_maps_[face_node_offsets_[cell_face_offsets_[c] + f]];
+  }
+
+  /**The \f$ \Omega \cdot n_f \f$ values of all the faces of cell `c` for
+   * direction `a`.*/
+  const double* FaceMu(size_t c, size_t a) const
+  {
+    const size_t num_faces = cell_face_offsets_[c + 1] - cell_face_offsets_[c];
+    return &face_mu_[cell_face_offsets_[c] * num_angles_ + a * num_faces];
+  }
+
+  /**The row-major streaming matrix of cell `c` for direction `a`.*/
+  const double* StreamingMatrix(size_t c, size_t a) const
+  {
+    const size_t n2 = (streaming_offsets_[c + 1] - streaming_offsets_[c]) /
+                      num_angles_;
+    return &streaming_matrices_[streaming_offsets_[c] + a * n2];
+  }
+
+private:
+  size_t num_angles_ = 0;
+  bool has_angular_data_ = false;
+
+  std::vector<size_t> cell_face_offsets_;
+  std::vector<size_t> face_node_offsets_;
+  std::vector<int> face_node_maps_;
+
+  std::vector<size_t> upwind_face_offsets_;
+  std::vector<int> upwind_faces_;
+  std::vector<size_t> downwind_face_offsets_;
+  std::vector<int> downwind_faces_;
+
+  std::vector<double> face_mu_;
+  std::vector<size_t> streaming_offsets_;
+  std::vector<double> streaming_matrices_;
+};
+
+// ##################################################################
+/**Builds and stores the SweepMetadata of the anglesets of a groupset. The
+ * metadata of an angleset is built the first time it is requested and
+ * only when it fits within the memory budget. If the complete metadata
+ * does not fit only the geometric part is stored. Safe to use from
+ * multiple sweep chunks executing concurrently.*/
+class SweepMetadataCache
+{
+public:
+  SweepMetadataCache(const LBSGroupset& groupset,
+                     const chi_mesh::MeshContinuum& grid,
+                     const chi_math::SpatialDiscretization& discretization,
+                     const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                     size_t memory_budget);
+
+  /**Returns the metadata of the given angleset, building it if needed.
+   * Returns `nullptr` if it does not fit within the memory budget.*/
+  const SweepMetadata*
+  GetMetadata(const chi_mesh::sweep_management::AngleSet& angle_set);
+
+  /**Returns the memory, in bytes, currently used by the cache.*/
+  size_t MemoryUsage() const { return memory_used_; }
+
+private:
+  const LBSGroupset& groupset_;
+  const chi_mesh::MeshContinuum& grid_;
+  const chi_math::SpatialDiscretization& discretization_;
+  const std::vector<UnitCellMatrices>& unit_cell_matrices_;
+  const size_t memory_budget_;
+
+  size_t memory_used_ = 0;
+  std::mutex mutex_;
+  std::map<const chi_mesh::sweep_management::AngleSet*,
+           std::unique_ptr<SweepMetadata>>
+    metadata_;
+};
+
+} // namespace lbs
+
+#endif // CHITECH_LBS_SWEEPMETADATA_H
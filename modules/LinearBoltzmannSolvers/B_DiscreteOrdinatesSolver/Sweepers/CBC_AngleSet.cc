@@ -5,10 +5,16 @@
 #include "mesh/SweepUtilities/sweepchunk_base.h"
 #include "mesh/MeshContinuum/chi_meshcontinuum.h"
 #include "math/chi_math_range.h"
+#include "utils/chi_thread_pool.h"
+#include "utils/chi_timer.h"
 
 #include "chi_runtime.h"
 #include "chi_log.h"
 
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
 namespace lbs
 {
 
@@ -40,6 +46,10 @@ CBC_AngleSet::GetCommunicator()
     &async_comm_);
 }
 
+// ###################################################################
+/**Advances the angle set. Tasks are executed from a ready queue, i.e.,
+ * a task is queued as soon as its last dependency, local or remote, has
+ * been satisfied, therefore no rescanning of the task list is needed.*/
 chi_mesh::sweep_management::AngleSetStatus CBC_AngleSet::AngleSetAdvance(
   chi_mesh::sweep_management::SweepChunk& sweep_chunk,
   const std::vector<size_t>& timing_tags,
@@ -49,67 +59,249 @@ chi_mesh::sweep_management::AngleSetStatus CBC_AngleSet::AngleSetAdvance(
 
   if (executed_) return Status::FINISHED;
 
-
-  if (current_task_list_.empty())
-    current_task_list_ = cbc_spds_.TaskList();
+  if (current_task_list_.empty()) InitializeTaskList();
 
   sweep_chunk.SetAngleSet(*this);
 
-  auto tasks_who_received_data = async_comm_.ReceiveData();
+  if (not ReceiveUpstreamData()) return Status::NOT_FINISHED;
+
+  ExecuteReadyTasks(sweep_chunk, timing_tags);
+
+  return CompletionStatus();
+}
 
-  for (const uint64_t task_number : tasks_who_received_data)
-    --current_task_list_[task_number].num_dependencies_;
+// ###################################################################
+/**Same as AngleSetAdvance except that the ready queue is drained by the
+ * threads of the supplied pool, each with its own sweep chunk.*/
+chi_mesh::sweep_management::AngleSetStatus
+CBC_AngleSet::AngleSetAdvanceThreaded(
+  const std::vector<chi_mesh::sweep_management::SweepChunk*>& sweep_chunks,
+  chi::ThreadPool& thread_pool,
+  const std::vector<size_t>& timing_tags)
+{
+  typedef chi_mesh::sweep_management::AngleSetStatus Status;
+
+  if (executed_) return Status::FINISHED;
+
+  if (current_task_list_.empty()) InitializeTaskList();
+
+  for (auto sweep_chunk : sweep_chunks)
+    sweep_chunk->SetAngleSet(*this);
+
+  if (not ReceiveUpstreamData()) return Status::NOT_FINISHED;
+
+  // Not worth waking the threads for a single ready task
+  if (ready_tasks_.size() > 1 and sweep_chunks.size() > 1)
+    ExecuteReadyTasksThreaded(sweep_chunks, thread_pool, timing_tags);
+  else
+    ExecuteReadyTasks(*sweep_chunks.front(), timing_tags);
+
+  return CompletionStatus();
+}
+
+// ###################################################################
+/**Copies the task list from the SPDS and queues all the tasks
+ * without dependencies.*/
+void CBC_AngleSet::InitializeTaskList()
+{
+  current_task_list_ = cbc_spds_.TaskList();
+
+  const size_t num_tasks = current_task_list_.size();
+  num_dependencies_ = std::vector<std::atomic<unsigned int>>(num_tasks);
+  ready_tasks_.clear();
+  num_completed_tasks_ = 0;
+
+  for (size_t t = 0; t < num_tasks; ++t)
+  {
+    const unsigned int num_deps = current_task_list_[t].num_dependencies_;
+    num_dependencies_[t].store(num_deps, std::memory_order_relaxed);
+    if (num_deps == 0) ready_tasks_.push_back(t);
+  }
+}
+
+// ###################################################################
+/**Satisfies one dependency of a task and queues the task when it has no
+ * more dependencies.*/
+void CBC_AngleSet::ReleaseDependency(uint64_t task_number)
+{
+  if (num_dependencies_[task_number].fetch_sub(
+        1, std::memory_order_acq_rel) == 1)
+    ready_tasks_.push_back(task_number);
+}
+
+// ###################################################################
+/**Receives upstream data, feeding the tasks that received data into the
+ * ready queue, and flushes the send buffers. Returns `false` if the
+ * reflecting boundaries do not yet allow execution.*/
+bool CBC_AngleSet::ReceiveUpstreamData()
+{
+  for (const uint64_t task_number : async_comm_.ReceiveData())
+    ReleaseDependency(task_number);
 
   async_comm_.SendData();
 
   // Check if boundaries allow for execution
   for (auto& [bid, bndry] : ref_boundaries_)
     if (not bndry->CheckAnglesReadyStatus(angles_, ref_group_subset_))
-      return Status::NOT_FINISHED;
+      return false;
 
-  bool all_tasks_completed = true;
-  bool a_task_executed = true;
-  while (a_task_executed)
+  return true;
+}
+
+// ###################################################################
+/**Executes tasks from the ready queue until it is empty. Completing a
+ * task can queue its successors.*/
+void CBC_AngleSet::ExecuteReadyTasks(
+  chi_mesh::sweep_management::SweepChunk& sweep_chunk,
+  const std::vector<size_t>& timing_tags)
+{
+  while (not ready_tasks_.empty())
   {
-    a_task_executed = false;
-    for (auto& cell_task : current_task_list_)
+    const uint64_t task_number = ready_tasks_.front();
+    ready_tasks_.pop_front();
+
+    auto& cell_task = current_task_list_[task_number];
+
+    Chi::log.LogEvent(timing_tags[0], chi::ChiLog::EventType::EVENT_BEGIN);
+    sweep_chunk.SetCell(cell_task.cell_ptr_, *this);
+    sweep_chunk.Sweep(*this);
+
+    for (uint64_t local_task_num : cell_task.successors_)
+      ReleaseDependency(local_task_num);
+    Chi::log.LogEvent(timing_tags[0], chi::ChiLog::EventType::EVENT_END);
+
+    cell_task.completed_ = true;
+    ++num_completed_tasks_;
+    async_comm_.SendData();
+  }
+}
+
+// ###################################################################
+/**Drains the ready queue with several threads. Every thread owns a
+ * double-ended queue: it pushes the successors it releases to the back of
+ * its own queue and pops from there, which keeps a thread working along
+ * the same path through the graph. A thread with an empty queue steals
+ * from the front of the other queues. Messages are only sent once the
+ * queue has been drained. The threads record the begin and end times of
+ * their tasks, which are logged as chunk events afterwards since only
+ * the calling thread may log.*/
+void CBC_AngleSet::ExecuteReadyTasksThreaded(
+  const std::vector<chi_mesh::sweep_management::SweepChunk*>& sweep_chunks,
+  chi::ThreadPool& thread_pool,
+  const std::vector<size_t>& timing_tags)
+{
+  const size_t num_workers =
+    std::min(sweep_chunks.size(), thread_pool.NumThreads());
+
+  struct WorkerQueue
+  {
+    std::mutex mutex;
+    std::deque<uint64_t> tasks;
+  };
+  std::vector<WorkerQueue> worker_queues(num_workers);
+
+  std::atomic<size_t> num_pending_tasks(ready_tasks_.size());
+  std::atomic<bool> aborted(false);
+  std::vector<size_t> num_executed(num_workers, 0);
+  std::vector<std::vector<std::pair<double, double>>> task_times(
+    num_workers);
+
+  for (size_t t = 0; t < ready_tasks_.size(); ++t)
+    worker_queues[t % num_workers].tasks.push_back(ready_tasks_[t]);
+  ready_tasks_.clear();
+
+  // Pops from the back of the own queue, otherwise steals from the front
+  // of another queue.
+  auto PopTask = [&worker_queues, num_workers](size_t w, uint64_t& task)
+  {
+    for (size_t k = 0; k < num_workers; ++k)
+    {
+      auto& queue = worker_queues[(w + k) % num_workers];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (queue.tasks.empty()) continue;
+      if (k == 0)
+      {
+        task = queue.tasks.back();
+        queue.tasks.pop_back();
+      }
+      else
+      {
+        task = queue.tasks.front();
+        queue.tasks.pop_front();
+      }
+      return true;
+    }
+    return false;
+  };
+
+  thread_pool.ParallelFor(
+    num_workers,
+    [&](size_t begin, size_t end, size_t chunk_id)
     {
-      if (not cell_task.completed_) all_tasks_completed = false;
-      if (cell_task.num_dependencies_ == 0 and not cell_task.completed_)
+      // num_workers does not exceed the number of threads, hence every
+      // chunk consists of exactly one worker
+      const size_t w = begin;
+      auto& sweep_chunk = *sweep_chunks[w];
+      auto& own_queue = worker_queues[w];
+      try
       {
-        Chi::log.LogEvent(timing_tags[0], chi::ChiLog::EventType::EVENT_BEGIN);
-        sweep_chunk.SetCell(cell_task.cell_ptr_, *this);
-        sweep_chunk.Sweep(*this);
+        while (num_pending_tasks.load(std::memory_order_acquire) > 0 and
+               not aborted.load(std::memory_order_relaxed))
+        {
+          uint64_t task_number;
+          if (not PopTask(w, task_number))
+          {
+            std::this_thread::yield();
+            continue;
+          }
+
+          auto& cell_task = current_task_list_[task_number];
+          const double begin_time = Chi::program_timer.GetTime();
+          sweep_chunk.SetCell(cell_task.cell_ptr_, *this);
+          sweep_chunk.Sweep(*this);
+          cell_task.completed_ = true;
 
-        for (uint64_t local_task_num : cell_task.successors_)
-          --current_task_list_[local_task_num].num_dependencies_;
-        Chi::log.LogEvent(timing_tags[0], chi::ChiLog::EventType::EVENT_END);
+          for (uint64_t successor : cell_task.successors_)
+            if (num_dependencies_[successor].fetch_sub(
+                  1, std::memory_order_acq_rel) == 1)
+            {
+              num_pending_tasks.fetch_add(1, std::memory_order_acq_rel);
+              std::lock_guard<std::mutex> lock(own_queue.mutex);
+              own_queue.tasks.push_back(successor);
+            }
+          task_times[w].emplace_back(begin_time,
+                                     Chi::program_timer.GetTime());
 
-        cell_task.completed_ = true;
-        a_task_executed = true;
-        async_comm_.SendData();
+          ++num_executed[w];
+          num_pending_tasks.fetch_sub(1, std::memory_order_acq_rel);
+        }
       }
-    } // for cell_task
-    async_comm_.SendData();
-  }
-  //for (auto& cell_task : current_task_list_)
-  //{
-  //  if (not cell_task.completed_) all_tasks_completed = false;
-  //  if (cell_task.num_dependencies_ == 0 and not cell_task.completed_)
-  //  {
-  //    Chi::log.LogEvent(timing_tags[0], chi::ChiLog::EventType::EVENT_BEGIN);
-  //    sweep_chunk.SetCell(cell_task.cell_ptr_, *this);
-  //    sweep_chunk.Sweep(*this);
-  //
-  //    for (uint64_t local_task_num : cell_task.successors_)
-  //      --current_task_list_[local_task_num].num_dependencies_;
-  //    Chi::log.LogEvent(timing_tags[0], chi::ChiLog::EventType::EVENT_END);
-  //
-  //    cell_task.completed_ = true;
-  //    async_comm_.SendData();
-  //  }
-  //} // for cell_task
+      catch (...)
+      {
+        aborted = true;
+        throw;
+      }
+    });
+
+  for (const size_t count : num_executed)
+    num_completed_tasks_ += count;
+
+  for (const auto& worker_task_times : task_times)
+    for (const auto& [begin_time, end_time] : worker_task_times)
+      Chi::log.LogEventInterval(timing_tags[0], begin_time, end_time);
+
+  async_comm_.SendData();
+}
+
+// ###################################################################
+/**Determines whether all the tasks have executed and all the messages
+ * have been sent, in which case the boundary readiness is updated.*/
+chi_mesh::sweep_management::AngleSetStatus CBC_AngleSet::CompletionStatus()
+{
+  typedef chi_mesh::sweep_management::AngleSetStatus Status;
 
+  const bool all_tasks_completed =
+    num_completed_tasks_ == current_task_list_.size();
   const bool all_messages_sent = async_comm_.SendData();
 
   if (all_tasks_completed and all_messages_sent)
@@ -129,6 +321,8 @@ chi_mesh::sweep_management::AngleSetStatus CBC_AngleSet::AngleSetAdvance(
 void CBC_AngleSet::ResetSweepBuffers()
 {
   current_task_list_.clear();
+  ready_tasks_.clear();
+  num_completed_tasks_ = 0;
   async_comm_.Reset();
   fluds_->ClearLocalAndReceivePsi();
   executed_ = false;
@@ -136,14 +330,14 @@ void CBC_AngleSet::ResetSweepBuffers()
 
 // ###################################################################
 /**Returns a pointer to a boundary flux data.*/
-const double* CBC_AngleSet::PsiBndry(uint64_t bndry_map,
-                                     unsigned int angle_num,
-                                     uint64_t cell_local_id,
-                                     unsigned int face_num,
-                                     unsigned int fi,
-                                     int g,
-                                     size_t gs_ss_begin,
-                                     bool surface_source_active)
+const PsiFloat* CBC_AngleSet::PsiBndry(uint64_t bndry_map,
+                                       unsigned int angle_num,
+                                       uint64_t cell_local_id,
+                                       unsigned int face_num,
+                                       unsigned int fi,
+                                       int g,
+                                       size_t gs_ss_begin,
+                                       bool surface_source_active)
 {
   if (ref_boundaries_[bndry_map]->IsReflecting())
     return ref_boundaries_[bndry_map]->HeterogeneousPsiIncoming(
@@ -157,12 +351,12 @@ const double* CBC_AngleSet::PsiBndry(uint64_t bndry_map,
 
 // ###################################################################
 /**Returns a pointer to outbound boundary flux data.*/
-double* CBC_AngleSet::ReflectingPsiOutBoundBndry(uint64_t bndry_map,
-                                                 unsigned int angle_num,
-                                                 uint64_t cell_local_id,
-                                                 unsigned int face_num,
-                                                 unsigned int fi,
-                                                 size_t gs_ss_begin)
+PsiFloat* CBC_AngleSet::ReflectingPsiOutBoundBndry(uint64_t bndry_map,
+                                                   unsigned int angle_num,
+                                                   uint64_t cell_local_id,
+                                                   unsigned int face_num,
+                                                   unsigned int fi,
+                                                   size_t gs_ss_begin)
 {
   return ref_boundaries_[bndry_map]->HeterogeneousPsiOutgoing(
     cell_local_id, face_num, fi, angle_num, gs_ss_begin);
@@ -4,6 +4,9 @@
 #include "mesh/SweepUtilities/AngleSet/AngleSet.h"
 #include "CBC_AsyncComm.h"
 
+#include <atomic>
+#include <deque>
+
 namespace lbs
 {
 
@@ -33,6 +36,11 @@ public:
     const std::vector<size_t>& timing_tags,
     chi_mesh::sweep_management::ExecutionPermission permission) override;
 
+  chi_mesh::sweep_management::AngleSetStatus AngleSetAdvanceThreaded(
+    const std::vector<chi_mesh::sweep_management::SweepChunk*>& sweep_chunks,
+    chi::ThreadPool& thread_pool,
+    const std::vector<size_t>& timing_tags) override;
+
   chi_mesh::sweep_management::AngleSetStatus FlushSendBuffers() override
   {
     const bool all_messages_sent = async_comm_.SendData();
@@ -42,24 +50,42 @@ public:
   }
   void ResetSweepBuffers() override;
   bool ReceiveDelayedData() override { return true; }
-  const double* PsiBndry(uint64_t bndry_map,
-                         unsigned int angle_num,
-                         uint64_t cell_local_id,
-                         unsigned int face_num,
-                         unsigned int fi,
-                         int g,
-                         size_t gs_ss_begin,
-                         bool surface_source_active) override;
-  double* ReflectingPsiOutBoundBndry(uint64_t bndry_map,
-                                     unsigned int angle_num,
-                                     uint64_t cell_local_id,
-                                     unsigned int face_num,
-                                     unsigned int fi,
-                                     size_t gs_ss_begin) override;
+  const PsiFloat* PsiBndry(uint64_t bndry_map,
+                           unsigned int angle_num,
+                           uint64_t cell_local_id,
+                           unsigned int face_num,
+                           unsigned int fi,
+                           int g,
+                           size_t gs_ss_begin,
+                           bool surface_source_active) override;
+  PsiFloat* ReflectingPsiOutBoundBndry(uint64_t bndry_map,
+                                       unsigned int angle_num,
+                                       uint64_t cell_local_id,
+                                       unsigned int face_num,
+                                       unsigned int fi,
+                                       size_t gs_ss_begin) override;
 
 protected:
+  void InitializeTaskList();
+  void ReleaseDependency(uint64_t task_number);
+  bool ReceiveUpstreamData();
+  void ExecuteReadyTasks(chi_mesh::sweep_management::SweepChunk& sweep_chunk,
+                         const std::vector<size_t>& timing_tags);
+  void ExecuteReadyTasksThreaded(
+    const std::vector<chi_mesh::sweep_management::SweepChunk*>& sweep_chunks,
+    chi::ThreadPool& thread_pool,
+    const std::vector<size_t>& timing_tags);
+  chi_mesh::sweep_management::AngleSetStatus CompletionStatus();
+
   const CBC_SPDS& cbc_spds_;
   std::vector<chi_mesh::sweep_management::Task> current_task_list_;
+  /**Remaining dependencies per task. Atomic so that several threads can
+   * release the successors of the tasks they complete.*/
+  std::vector<std::atomic<unsigned int>> num_dependencies_;
+  /**Tasks whose dependencies are all satisfied but that have not
+   * executed yet.*/
+  std::deque<uint64_t> ready_tasks_;
+  size_t num_completed_tasks_ = 0;
   CBC_ASynchronousCommunicator async_comm_;
 };
 
@@ -25,7 +25,8 @@ CBC_ASynchronousCommunicator::CBC_ASynchronousCommunicator(
 {
 }
 
-std::vector<double>& CBC_ASynchronousCommunicator::InitGetDownwindMessageData(
+std::vector<PsiFloat>&
+CBC_ASynchronousCommunicator::InitGetDownwindMessageData(
   int location_id,
   uint64_t cell_global_id,
   unsigned int face_id,
@@ -34,7 +35,8 @@ std::vector<double>& CBC_ASynchronousCommunicator::InitGetDownwindMessageData(
 {
   MessageKey key{location_id, cell_global_id, face_id};
 
-  std::vector<double>& data = outgoing_message_queue_[key];
+  std::lock_guard<std::mutex> lock(outgoing_message_queue_mutex_);
+  std::vector<PsiFloat>& data = outgoing_message_queue_[key];
   if (data.empty())
     data.assign(data_size, 0.0);
 
@@ -68,7 +70,7 @@ bool CBC_ASynchronousCommunicator::SendData()
       buffer_array.Write(face_id);
       buffer_array.Write(data_size);
 
-      for (const double value : data) // actual psi_data
+      for (const PsiFloat value : data) // actual psi_data
         buffer_array.Write(value);
     } // for item in queue
 
@@ -114,7 +116,7 @@ std::vector<uint64_t> CBC_ASynchronousCommunicator::ReceiveData()
 {
   typedef std::pair<uint64_t, uint> CellFaceKey; // cell_gid + face_id
 
-  std::map<CellFaceKey, std::vector<double>> received_messages;
+  std::map<CellFaceKey, std::vector<PsiFloat>> received_messages;
   std::vector<uint64_t> cells_who_received_data;
   auto& location_dependencies = fluds_.GetSPDS().GetLocationDependencies();
   for (int locJ : location_dependencies)
@@ -150,10 +152,10 @@ std::vector<uint64_t> CBC_ASynchronousCommunicator::ReceiveData()
         const uint face_id = data_array.Read<uint>();
         const size_t data_size = data_array.Read<size_t>();
 
-        std::vector<double> psi_data;
+        std::vector<PsiFloat> psi_data;
         psi_data.reserve(data_size);
         for (size_t k = 0; k < data_size; ++k)
-          psi_data.push_back(data_array.Read<double>());
+          psi_data.push_back(data_array.Read<PsiFloat>());
 
         received_messages[{cell_global_id, face_id}] = std::move(psi_data);
         cells_who_received_data.push_back(
@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <cstddef>
 #include <map>
+#include <mutex>
 #include <vector>
 
 #include "mesh/SweepUtilities/Communicators/AsyncComm.h"
@@ -24,6 +25,8 @@ class ByteArray;
 namespace lbs
 {
 
+using chi_mesh::sweep_management::PsiFloat;
+
 class CBC_FLUDS;
 
 class CBC_ASynchronousCommunicator
@@ -40,11 +43,11 @@ public:
   // face_id
   typedef std::tuple<int, uint64_t, unsigned int> MessageKey;
 
-  std::vector<double>& InitGetDownwindMessageData(int location_id,
-                                                  uint64_t cell_global_id,
-                                                  unsigned int face_id,
-                                                  size_t angle_set_id,
-                                                  size_t data_size) override;
+  std::vector<PsiFloat>& InitGetDownwindMessageData(int location_id,
+                                                    uint64_t cell_global_id,
+                                                    unsigned int face_id,
+                                                    size_t angle_set_id,
+                                                    size_t data_size) override;
 
   bool SendData();
   std::vector<uint64_t> ReceiveData();
@@ -58,7 +61,10 @@ public:
 protected:
   const size_t angle_set_id_;
   CBC_FLUDS& cbc_fluds_;
-  std::map<MessageKey, std::vector<double>> outgoing_message_queue_;
+  std::map<MessageKey, std::vector<PsiFloat>> outgoing_message_queue_;
+  /**Guards insertions into the outgoing message queue when several
+   * threads sweep cells of the same angle set.*/
+  std::mutex outgoing_message_queue_mutex_;
 
   struct BufferItem
   {
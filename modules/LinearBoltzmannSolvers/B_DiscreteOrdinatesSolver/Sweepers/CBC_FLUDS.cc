@@ -42,15 +42,15 @@ CBC_FLUDS::GetLocalCellUpwindPsi(const std::vector<double>& psi_data_block,
   return &psi_data_block[dof_map];
 }
 
-const std::vector<double>&
+const std::vector<PsiFloat>&
 CBC_FLUDS::GetNonLocalUpwindData(uint64_t cell_global_id,
                                  unsigned int face_id) const
 {
   return deplocs_outgoing_messages_.at({cell_global_id, face_id});
 }
 
-const double*
-CBC_FLUDS::GetNonLocalUpwindPsi(const std::vector<double>& psi_data,
+const PsiFloat*
+CBC_FLUDS::GetNonLocalUpwindPsi(const std::vector<PsiFloat>& psi_data,
                                 unsigned int face_node_mapped,
                                 unsigned int angle_set_index)
 {
@@ -21,6 +21,8 @@ class Cell;
 namespace lbs
 {
 
+using chi_mesh::sweep_management::PsiFloat;
+
 class CBC_FLUDS : public chi_mesh::sweep_management::FLUDS
 {
 public:
@@ -38,12 +40,12 @@ public:
   const double* GetLocalCellUpwindPsi(const std::vector<double>& psi_data_block,
                                       const chi_mesh::Cell& cell);
 
-  const std::vector<double>& GetNonLocalUpwindData(uint64_t cell_global_id,
-                                                   unsigned int face_id) const;
+  const std::vector<PsiFloat>&
+  GetNonLocalUpwindData(uint64_t cell_global_id, unsigned int face_id) const;
 
-  const double* GetNonLocalUpwindPsi(const std::vector<double>& psi_data,
-                                     unsigned int face_node_mapped,
-                                     unsigned int angle_set_index);
+  const PsiFloat* GetNonLocalUpwindPsi(const std::vector<PsiFloat>& psi_data,
+                                       unsigned int face_node_mapped,
+                                       unsigned int angle_set_index);
 
   void ClearLocalAndReceivePsi() override
   {
@@ -69,27 +71,30 @@ public:
   {
   }
 
-  std::vector<double>& DelayedLocalPsi() override { return delayed_local_psi_; }
-  std::vector<double>& DelayedLocalPsiOld() override
+  std::vector<PsiFloat>& DelayedLocalPsi() override
+  {
+    return delayed_local_psi_;
+  }
+  std::vector<PsiFloat>& DelayedLocalPsiOld() override
   {
     return delayed_local_psi_old_;
   }
 
-  std::vector<std::vector<double>>& DeplocIOutgoingPsi() override
+  std::vector<std::vector<PsiFloat>>& DeplocIOutgoingPsi() override
   {
     return deplocI_outgoing_psi_;
   }
 
-  std::vector<std::vector<double>>& PrelocIOutgoingPsi() override
+  std::vector<std::vector<PsiFloat>>& PrelocIOutgoingPsi() override
   {
     return prelocI_outgoing_psi_;
   }
 
-  std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsi() override
+  std::vector<std::vector<PsiFloat>>& DelayedPrelocIOutgoingPsi() override
   {
     return delayed_prelocI_outgoing_psi_;
   }
-  std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsiOld() override
+  std::vector<std::vector<PsiFloat>>& DelayedPrelocIOutgoingPsiOld() override
   {
     return delayed_prelocI_outgoing_psi_old_;
   }
@@ -98,7 +103,7 @@ public:
   // face_id
   typedef std::pair<uint64_t, unsigned int> CellFaceKey;
 
-  std::map<CellFaceKey, std::vector<double>>& DeplocsOutgoingMessages()
+  std::map<CellFaceKey, std::vector<PsiFloat>>& DeplocsOutgoingMessages()
   {
     return deplocs_outgoing_messages_;
   }
@@ -109,16 +114,16 @@ private:
   const chi_math::UnknownManager& psi_uk_man_;
   const chi_math::SpatialDiscretization& sdm_;
 
-  std::vector<double> delayed_local_psi_;
-  std::vector<double> delayed_local_psi_old_;
-  std::vector<std::vector<double>> deplocI_outgoing_psi_;
-  std::vector<std::vector<double>> prelocI_outgoing_psi_;
-  std::vector<std::vector<double>> boundryI_incoming_psi_;
+  std::vector<PsiFloat> delayed_local_psi_;
+  std::vector<PsiFloat> delayed_local_psi_old_;
+  std::vector<std::vector<PsiFloat>> deplocI_outgoing_psi_;
+  std::vector<std::vector<PsiFloat>> prelocI_outgoing_psi_;
+  std::vector<std::vector<PsiFloat>> boundryI_incoming_psi_;
 
-  std::vector<std::vector<double>> delayed_prelocI_outgoing_psi_;
-  std::vector<std::vector<double>> delayed_prelocI_outgoing_psi_old_;
+  std::vector<std::vector<PsiFloat>> delayed_prelocI_outgoing_psi_;
+  std::vector<std::vector<PsiFloat>> delayed_prelocI_outgoing_psi_old_;
 
-  std::map<CellFaceKey, std::vector<double>> deplocs_outgoing_messages_;
+  std::map<CellFaceKey, std::vector<PsiFloat>> deplocs_outgoing_messages_;
 };
 
 } // namespace lbs
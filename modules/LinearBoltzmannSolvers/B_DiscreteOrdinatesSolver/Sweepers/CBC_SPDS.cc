@@ -109,6 +109,29 @@ CBC_SPDS::CBC_SPDS(const chi_mesh::Vector3& omega,
   ////                                                        dependency graph
   // BuildTaskDependencyGraph(global_dependencies, cycle_allowance_flag);
 
+  BuildTaskList();
+
+  Chi::mpi.Barrier();
+
+  Chi::log.Log0Verbose1() << Chi::program_timer.GetTimeString()
+                          << " Done computing sweep ordering.\n\n";
+}
+
+CBC_SPDS::CBC_SPDS(const chi_mesh::Vector3& omega,
+                   const chi_mesh::MeshContinuum& grid,
+                   chi_data_types::ByteArray& raw,
+                   bool verbose)
+  : SPDS(omega, grid, verbose)
+{
+  DeSerialize(raw);
+
+  if (verbose_) PrintedGhostedGraph();
+
+  BuildTaskList();
+}
+
+void CBC_SPDS::BuildTaskList()
+{
   constexpr auto INCOMING =
     chi_mesh::sweep_management::FaceOrientation::INCOMING;
   constexpr auto OUTGOING =
@@ -131,8 +154,8 @@ CBC_SPDS::CBC_SPDS(const chi_mesh::Vector3& omega,
       else if (cell_face_orientations_[cell.local_id_][f] == OUTGOING)
       {
         const auto& face = cell.faces_[f];
-        if (face.has_neighbor_ and grid.IsCellLocal(face.neighbor_id_))
-          succesors.push_back(grid.cells[face.neighbor_id_].local_id_);
+        if (face.has_neighbor_ and grid_.IsCellLocal(face.neighbor_id_))
+          succesors.push_back(grid_.cells[face.neighbor_id_].local_id_);
       }
 
     task_list_.push_back({num_dependencies,
@@ -141,11 +164,6 @@ CBC_SPDS::CBC_SPDS(const chi_mesh::Vector3& omega,
                           /*cell_ptr_=*/&cell,
                           /*completed_=*/false});
   } // for cell in SPLS
-
-  Chi::mpi.Barrier();
-
-  Chi::log.Log0Verbose1() << Chi::program_timer.GetTimeString()
-                          << " Done computing sweep ordering.\n\n";
 }
 
 const std::vector<chi_mesh::sweep_management::Task>& CBC_SPDS::TaskList() const
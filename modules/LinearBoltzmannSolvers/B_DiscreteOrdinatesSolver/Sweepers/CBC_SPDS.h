@@ -16,10 +16,19 @@ public:
            const chi_mesh::MeshContinuum& grid,
            bool cycle_allowance_flag,
            bool verbose);
+  /**Restores a sweep ordering written with Serialize. No communication is
+   * performed.*/
+  CBC_SPDS(const chi_mesh::Vector3& omega,
+           const chi_mesh::MeshContinuum& grid,
+           chi_data_types::ByteArray& raw,
+           bool verbose);
 
   const std::vector<chi_mesh::sweep_management::Task>& TaskList() const;
 
 protected:
+  /**Creates a task for each local cell from the cell face orientations.*/
+  void BuildTaskList();
+
   std::vector<chi_mesh::sweep_management::Task> task_list_;
 };
 
@@ -30,6 +30,15 @@ chi::InputParameters lbs::DiscreteOrdinatesSolver::GetInputParameters()
   params.AddOptionalParameter(
     "sweep_type", "AAH", "The sweep type to use for sweep operatorations.");
 
+  params.AddOptionalParameter(
+    "sweep_data_cache_directory",
+    "",
+    "Directory in which the sweep orderings (SPDS) and the FLUDS common data "
+    "are cached. When set, the data is loaded from the directory if it was "
+    "stored by a previous run with the same mesh, partitioning, quadratures "
+    "and sweep options, otherwise it is built and stored. An empty string "
+    "disables the cache.");
+
   using namespace chi_data_types;
   params.ConstrainParameterRange("sweep_type",
                                  AllowableRangeList::New({"AAH", "CBC"}));
@@ -43,7 +52,9 @@ lbs::DiscreteOrdinatesSolver::DiscreteOrdinatesSolver(
   : LBSSolver(params),
     verbose_sweep_angles_(
       params.GetParamVectorValue<size_t>("directions_sweep_order_to_print")),
-    sweep_type_(params.GetParamValue<std::string>("sweep_type"))
+    sweep_type_(params.GetParamValue<std::string>("sweep_type")),
+    sweep_data_cache_directory_(
+      params.GetParamValue<std::string>("sweep_data_cache_directory"))
 {
 }
 
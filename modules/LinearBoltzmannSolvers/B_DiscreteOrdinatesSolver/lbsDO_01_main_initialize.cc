@@ -1,6 +1,7 @@
 #include "lbs_discrete_ordinates_solver.h"
 
 #include "B_DiscreteOrdinatesSolver/IterativeMethods/sweep_wgs_context.h"
+#include "B_DiscreteOrdinatesSolver/SweepChunks/AAH_SweepChunk.h"
 #include "A_LBSSolver/IterativeMethods/wgs_linear_solver.h"
 #include "A_LBSSolver/SourceFunctions/source_function.h"
 
@@ -45,6 +46,30 @@ void lbs::DiscreteOrdinatesSolver::InitializeWGSSolvers()
   {
     std::shared_ptr<SweepChunk> sweep_chunk = SetSweepChunk(groupset);
 
+    //============================= Additional chunks for threaded sweeps
+    std::vector<std::shared_ptr<SweepChunk>> worker_sweep_chunks;
+    for (int t = 1; t < options_.num_sweep_threads; ++t)
+      worker_sweep_chunks.push_back(SetSweepChunk(groupset));
+
+    //============================= Sweep metadata cache
+    if (options_.sweep_metadata_memory_budget_mb > 0.0)
+    {
+      const double budget_mb =
+        options_.sweep_metadata_memory_budget_mb / groupsets_.size();
+      auto cache = std::make_shared<SweepMetadataCache>(
+        groupset,
+        *grid_ptr_,
+        *discretization_,
+        unit_cell_matrices_,
+        static_cast<size_t>(budget_mb * 1024.0 * 1024.0));
+
+      auto chunks = worker_sweep_chunks;
+      chunks.push_back(sweep_chunk);
+      for (auto& chunk : chunks)
+        if (auto aah_chunk = std::dynamic_pointer_cast<AAH_SweepChunk>(chunk))
+          aah_chunk->SetSweepMetadataCache(cache);
+    }
+
     auto sweep_wgs_context_ptr =
     std::make_shared<SweepWGSContext<Mat, Vec, KSP>>(
       *this, groupset,
@@ -53,7 +78,8 @@ void lbs::DiscreteOrdinatesSolver::InitializeWGSSolvers()
         APPLY_FIXED_SOURCES | APPLY_AGS_SCATTER_SOURCES |
         APPLY_AGS_FISSION_SOURCES,                              //rhs_scope
         options_.verbose_inner_iterations,
-        sweep_chunk);
+        sweep_chunk,
+        worker_sweep_chunks);
 
     auto wgs_solver =
       std::make_shared<WGSLinearSolver<Mat,Vec,KSP>>(sweep_wgs_context_ptr);
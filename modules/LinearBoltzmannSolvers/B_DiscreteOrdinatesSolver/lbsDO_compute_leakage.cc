@@ -34,17 +34,31 @@ std::vector<double> lbs::DiscreteOrdinatesSolver::
   const int gs_num_groups = gsf+1-gsi;
 
   //================================================== Start integration
+  // The angular fluxes of a cell are loaded once, on its first face on the
+  // boundary, since they need not be held in a plain array.
   std::vector<double> local_leakage(gs_num_groups, 0.0);
+  std::vector<double> cell_psi;
   for (const auto& cell : grid_ptr_->local_cells)
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
     const auto& fe_values = unit_cell_matrices_[cell.local_id_];
+    const int64_t cell_psi_address = sdm.MapDOFLocal(cell, 0, psi_uk_man, 0, 0);
+    bool cell_psi_loaded = false;
 
     size_t f=0;
     for (const auto& face : cell.faces_)
     {
       if (not face.has_neighbor_ and face.neighbor_id_ == boundary_id)
       {
+        if (not cell_psi_loaded)
+        {
+          cell_psi.resize(cell_mapping.NumNodes() *
+                          psi_uk_man.GetTotalUnknownStructureSize());
+          LoadGroupsetPsi(groupset, cell_psi_address, cell_psi.size(),
+                          cell_psi.data());
+          cell_psi_loaded = true;
+        }
+
         const auto& IntF_shapeI = fe_values.face_Si_vectors[f];
         const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
         for (size_t fi=0; fi<num_face_nodes; ++fi)
@@ -59,10 +73,9 @@ std::vector<double> lbs::DiscreteOrdinatesSolver::
             {
               for (int gi=0; gi<gs_num_groups; ++gi)
               {
-                const int g = gi+gsi;
-                const int64_t imap = sdm.MapDOFLocal(cell, i, psi_uk_man, n, g);
+                const int64_t imap = sdm.MapDOFLocal(cell, i, psi_uk_man, n, gi);
 
-                const double psi = psi_new_local_[groupset_id][imap];
+                const double psi = cell_psi[imap - cell_psi_address];
 
                 local_leakage[gi] += weight * mu * psi * IntF_shapeI[i];
               }//for g
@@ -38,7 +38,10 @@ namespace lbs
  * where each FLUDS mirrors a SPDS in ii).
  *
  * The Template FLUDS can be scaled with number of angles and groups which
- * provides us with the angle-set-subset- and groupset-subset capability.*/
+ * provides us with the angle-set-subset- and groupset-subset capability.
+ *
+ * When the `sweep_data_cache_directory` option is set, ii) and iii) are
+ * loaded from a previous run's cache if possible and stored otherwise.*/
 void DiscreteOrdinatesSolver::InitializeSweepDataStructures()
 {
   Chi::log.Log() << Chi::program_timer.GetTimeString()
@@ -78,8 +81,19 @@ void DiscreteOrdinatesSolver::InitializeSweepDataStructures()
         groupset.allow_cycles_;
   }
 
+  //=================================== Load cached sweep data
+  if (LoadSweepDataCache())
+  {
+    Chi::log.Log() << Chi::program_timer.GetTimeString()
+                   << " Done initializing sweep datastructures from cache.\n";
+    return;
+  }
+
   //=================================== Build sweep orderings
+  // The task dependency graphs of the AAH sweep orderings are built
+  // afterwards, distributed over the locations.
   quadrature_spds_map_.clear();
+  std::vector<chi_mesh::sweep_management::SPDS_AdamsAdamsHawkins*> aah_spds;
   for (const auto& [quadrature, info] : quadrature_unq_so_grouping_map_)
   {
     const auto& unique_so_groupings = info.first;
@@ -107,8 +121,10 @@ void DiscreteOrdinatesSolver::InitializeSweepDataStructures()
           omega,
           *this->grid_ptr_,
           quadrature_allow_cycles_map_[quadrature],
-          verbose);
+          verbose,
+          /*defer_task_dependency_graph=*/true);
         quadrature_spds_map_[quadrature].push_back(new_swp_order);
+        aah_spds.push_back(new_swp_order.get());
       }
       else if (sweep_type_ == "CBC")
       {
@@ -124,6 +140,13 @@ void DiscreteOrdinatesSolver::InitializeSweepDataStructures()
     }
   } // quadrature info-pack
 
+  if (not aah_spds.empty())
+  {
+    using namespace chi_mesh::sweep_management;
+    SPDS_AdamsAdamsHawkins::BuildTaskDependencyGraphs(aah_spds);
+    Chi::mpi.Barrier();
+  }
+
   //=================================== Build FLUDS templates
   quadrature_fluds_commondata_map_.clear();
   for (const auto& [quadrature, spds_list] : quadrature_spds_map_)
@@ -147,6 +170,8 @@ void DiscreteOrdinatesSolver::InitializeSweepDataStructures()
     }
   } // for quadrature spds-list pair
 
+  SaveSweepDataCache();
+
   Chi::log.Log() << Chi::program_timer.GetTimeString()
                  << " Done initializing sweep datastructures.\n";
 }
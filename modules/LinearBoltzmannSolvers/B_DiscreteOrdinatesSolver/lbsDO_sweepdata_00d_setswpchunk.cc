@@ -27,10 +27,17 @@ lbs::DiscreteOrdinatesSolver::SetSweepChunk(LBSGroupset& groupset)
       num_moments_,
       max_cell_dof_count_);
 
+    sweep_chunk->SetDestinationPsiStore(GroupsetPsiStore(groupset));
+
     return sweep_chunk;
   }
   else if (sweep_type_ == "CBC")
   {
+    // The CBC FLUDS reads upwind angular fluxes from the psi vector
+    ChiLogicalErrorIf(GroupsetPsiStore(groupset) != nullptr,
+                      "When using sweep_type \"CBC\" then "
+                      "\"angular_flux_storage\" must be \"double\".");
+
     auto sweep_chunk = std::make_shared<CBC_SweepChunk>(
       phi_new_local_, psi_new_local_[groupset.id_],
       *grid_ptr_,
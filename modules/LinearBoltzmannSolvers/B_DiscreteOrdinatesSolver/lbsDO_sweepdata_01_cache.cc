@@ -0,0 +1,300 @@
+#include "lbs_discrete_ordinates_solver.h"
+
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+#include "mesh/SweepUtilities/SPDS/SPDS_AdamsAdamsHawkins.h"
+#include "mesh/SweepUtilities/FLUDS/AAH_FLUDS.h"
+
+#include "Sweepers/CBC_SPDS.h"
+#include "Sweepers/CBC_FLUDSCommonData.h"
+
+#include "data_types/byte_array.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+#include "utils/chi_timer.h"
+#include "utils/chi_utils.h"
+
+#include <sys/stat.h>
+#include <cerrno>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace lbs
+{
+
+namespace
+{
+/**Identifies a sweep data cache file. Bump the version whenever the
+ * serialized layout changes.*/
+constexpr uint64_t SWEEP_DATA_CACHE_MAGIC = 0x3130435753494843; // CHISWC01
+
+/**64-bit FNV-1a hash of a block of bytes.*/
+uint64_t HashBytes(const std::vector<std::byte>& bytes)
+{
+  uint64_t hash = 14695981039346656037ULL;
+  for (const std::byte b : bytes)
+  {
+    hash ^= static_cast<uint64_t>(b);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+/**The quadratures of the groupsets in order of first use. Unlike the
+ * iteration order of the quadrature maps this order is the same on every
+ * run.*/
+std::vector<std::shared_ptr<chi_math::AngularQuadrature>>
+OrderedQuadratures(const std::vector<LBSGroupset>& groupsets)
+{
+  std::vector<std::shared_ptr<chi_math::AngularQuadrature>> quadratures;
+  for (const auto& groupset : groupsets)
+    if (not chi::VectorListHas(quadratures, groupset.quadrature_))
+      quadratures.push_back(groupset.quadrature_);
+  return quadratures;
+}
+
+/**Name of the cache file of this location for the given key.*/
+std::string CacheFileName(const std::string& directory, uint64_t key)
+{
+  std::stringstream file_name;
+  file_name << directory << "/sweep_data_" << std::hex << std::setw(16)
+            << std::setfill('0') << key << std::dec << "_"
+            << Chi::mpi.location_id << ".cache";
+  return file_name.str();
+}
+} // namespace
+
+//###################################################################
+/**Computes the key that identifies the sweep data of this location. It
+ * covers everything the SPDSs and FLUDS common data depend on: the
+ * partitioning, the local cells and their neighbors, the quadratures with
+ * their sweep ordering groups, and the sweep options.*/
+uint64_t DiscreteOrdinatesSolver::SweepDataCacheKey() const
+{
+  chi_data_types::ByteArray key_data;
+
+  key_data.Write<uint64_t>(SWEEP_DATA_CACHE_MAGIC);
+  key_data.WriteVector(std::vector<char>(sweep_type_.begin(),
+                                         sweep_type_.end()));
+  key_data.Write<int>(Chi::mpi.location_id);
+  key_data.Write<int>(Chi::mpi.process_count);
+  key_data.Write<GeometryType>(options_.geometry_type);
+
+  //=================================== Quadratures
+  for (const auto& quadrature : OrderedQuadratures(groupsets_))
+  {
+    for (const auto& groupset : groupsets_)
+      if (groupset.quadrature_ == quadrature)
+      {
+        key_data.Write<bool>(groupset.allow_cycles_);
+        key_data.Write<AngleAggregationType>(groupset.angleagg_method_);
+        break;
+      }
+
+    key_data.WriteVector(quadrature->omegas_);
+
+    const auto& unique_so_groupings =
+      quadrature_unq_so_grouping_map_.at(quadrature).first;
+    key_data.Write<size_t>(unique_so_groupings.size());
+    for (const auto& so_grouping : unique_so_groupings)
+      key_data.WriteVector(so_grouping);
+  }
+
+  //=================================== Local cells
+  const auto& grid = *grid_ptr_;
+  key_data.Write<size_t>(grid.local_cells.size());
+  for (const auto& cell : grid.local_cells)
+  {
+    key_data.Write<uint64_t>(cell.global_id_);
+    key_data.WriteVector(cell.vertex_ids_);
+    for (const uint64_t vid : cell.vertex_ids_)
+      key_data.Write<chi_mesh::Vector3>(grid.vertices[vid]);
+
+    key_data.Write<size_t>(cell.faces_.size());
+    for (const auto& face : cell.faces_)
+    {
+      key_data.WriteVector(face.vertex_ids_);
+      key_data.Write<bool>(face.has_neighbor_);
+      key_data.Write<uint64_t>(face.neighbor_id_);
+      if (face.has_neighbor_)
+        key_data.Write<uint64_t>(grid.cells[face.neighbor_id_].partition_id_);
+    }
+  }
+
+  return HashBytes(key_data.Data());
+}
+
+//###################################################################
+/**Restores the SPDSs and FLUDS common data from the sweep data cache.
+ * The data is only used when the cache files of all locations are present
+ * and valid, otherwise nothing is restored and `false` is returned so
+ * that every location rebuilds the data.*/
+bool DiscreteOrdinatesSolver::LoadSweepDataCache()
+{
+  if (sweep_data_cache_directory_.empty()) return false;
+
+  const uint64_t key = SweepDataCacheKey();
+  const std::string file_name =
+    CacheFileName(sweep_data_cache_directory_, key);
+
+  //=================================== Read and validate file
+  chi_data_types::ByteArray raw;
+  bool location_succeeded = false;
+  {
+    std::ifstream ifile(file_name,
+                        std::ios::in | std::ios::binary | std::ios::ate);
+    if (ifile.is_open())
+    {
+      const auto file_size = static_cast<uint64_t>(ifile.tellg());
+      ifile.seekg(0);
+
+      uint64_t header[4] = {0, 0, 0, 0};
+      ifile.read(reinterpret_cast<char*>(header), sizeof(header));
+
+      const uint64_t payload_size = header[2];
+      if (ifile and header[0] == SWEEP_DATA_CACHE_MAGIC and
+          header[1] == key and payload_size + sizeof(header) == file_size)
+      {
+        raw.Data().resize(payload_size);
+        ifile.read(reinterpret_cast<char*>(raw.Data().data()),
+                   static_cast<std::streamsize>(payload_size));
+        location_succeeded = ifile and HashBytes(raw.Data()) == header[3];
+      }
+    }
+  }
+
+  bool global_succeeded = false;
+  MPI_Allreduce(&location_succeeded, // Send buffer
+                &global_succeeded,   // Recv buffer
+                1,                   // count
+                MPI_CXX_BOOL,        // Data type
+                MPI_LAND,            // Operation - Logical and
+                Chi::mpi.comm);      // Communicator
+
+  if (not global_succeeded)
+  {
+    Chi::log.Log() << "Sweep data cache not found or out of date in \""
+                   << sweep_data_cache_directory_ << "\". Rebuilding.";
+    return false;
+  }
+
+  //=================================== Restore SPDSs and FLUDS
+  using namespace chi_mesh::sweep_management;
+  quadrature_spds_map_.clear();
+  quadrature_fluds_commondata_map_.clear();
+  for (const auto& quadrature : OrderedQuadratures(groupsets_))
+  {
+    const auto& unique_so_groupings =
+      quadrature_unq_so_grouping_map_.at(quadrature).first;
+
+    auto& spds_list = quadrature_spds_map_[quadrature];
+    for (const auto& so_grouping : unique_so_groupings)
+    {
+      if (so_grouping.empty()) continue;
+
+      const auto& omega = quadrature->omegas_[so_grouping.front()];
+
+      bool verbose = false;
+      for (const size_t dir_id : verbose_sweep_angles_)
+        if (chi::VectorListHas(so_grouping, dir_id)) verbose = true;
+
+      if (sweep_type_ == "AAH")
+        spds_list.push_back(std::make_shared<SPDS_AdamsAdamsHawkins>(
+          omega, *grid_ptr_, raw, verbose));
+      else
+        spds_list.push_back(
+          std::make_shared<CBC_SPDS>(omega, *grid_ptr_, raw, verbose));
+    }
+
+    auto& fluds_list = quadrature_fluds_commondata_map_[quadrature];
+    for (const auto& spds : spds_list)
+    {
+      if (sweep_type_ == "AAH")
+        fluds_list.push_back(std::make_unique<AAH_FLUDSCommonData>(
+          grid_nodal_mappings_, *spds, raw));
+      else
+        fluds_list.push_back(
+          std::make_unique<CBC_FLUDSCommonData>(*spds, grid_nodal_mappings_));
+    }
+  } // for quadrature
+
+  ChiLogicalErrorIf(not raw.EndOfBuffer(),
+                    "Sweep data cache file \"" + file_name +
+                      "\" was not completely read.");
+
+  Chi::log.Log() << "Loaded sweep data cache from \""
+                 << sweep_data_cache_directory_ << "\".";
+  return true;
+}
+
+//###################################################################
+/**Stores the SPDSs and FLUDS common data in the sweep data cache. Failing
+ * to write the cache only produces a warning.*/
+void DiscreteOrdinatesSolver::SaveSweepDataCache() const
+{
+  if (sweep_data_cache_directory_.empty()) return;
+
+  //=================================== Make sure folder exists
+  if (Chi::mpi.location_id == 0)
+  {
+    struct stat st;
+    if (stat(sweep_data_cache_directory_.c_str(), &st) != 0)
+      if ((mkdir(sweep_data_cache_directory_.c_str(),
+                 S_IRWXU | S_IRWXG | S_IRWXO) != 0) and
+          (errno != EEXIST))
+        Chi::log.Log0Warning() << "Failed to create sweep data cache "
+                               << "directory: " << sweep_data_cache_directory_;
+  }
+
+  Chi::mpi.Barrier();
+
+  //=================================== Serialize
+  chi_data_types::ByteArray raw;
+  for (const auto& quadrature : OrderedQuadratures(groupsets_))
+  {
+    for (const auto& spds : quadrature_spds_map_.at(quadrature))
+      spds->Serialize(raw);
+    for (const auto& fluds_common_data :
+         quadrature_fluds_commondata_map_.at(quadrature))
+      fluds_common_data->Serialize(raw);
+  }
+
+  //=================================== Write file
+  const uint64_t key = SweepDataCacheKey();
+  const std::string file_name =
+    CacheFileName(sweep_data_cache_directory_, key);
+
+  const uint64_t header[4] = {
+    SWEEP_DATA_CACHE_MAGIC, key, raw.Size(), HashBytes(raw.Data())};
+
+  std::ofstream ofile(file_name,
+                      std::ios::out | std::ios::binary | std::ios::trunc);
+  bool location_succeeded = ofile.is_open();
+  if (location_succeeded)
+  {
+    ofile.write(reinterpret_cast<const char*>(header), sizeof(header));
+    ofile.write(reinterpret_cast<const char*>(raw.Data().data()),
+                static_cast<std::streamsize>(raw.Size()));
+    location_succeeded = static_cast<bool>(ofile);
+  }
+  ofile.close();
+
+  bool global_succeeded = false;
+  MPI_Allreduce(&location_succeeded, // Send buffer
+                &global_succeeded,   // Recv buffer
+                1,                   // count
+                MPI_CXX_BOOL,        // Data type
+                MPI_LAND,            // Operation - Logical and
+                Chi::mpi.comm);      // Communicator
+
+  if (global_succeeded)
+    Chi::log.Log() << "Stored sweep data cache in \""
+                   << sweep_data_cache_directory_ << "\".";
+  else
+    Chi::log.Log0Warning() << "Failed to store the sweep data cache in \""
+                           << sweep_data_cache_directory_ << "\".";
+}
+
+} // namespace lbs
@@ -34,6 +34,7 @@ protected:
 
   std::vector<size_t> verbose_sweep_angles_;
   const std::string sweep_type_;
+  const std::string sweep_data_cache_directory_;
 
 public:
   static chi::InputParameters GetInputParameters();
@@ -62,6 +63,11 @@ protected:
                             const chi_math::AngularQuadrature& quadrature,
                             AngleAggregationType agg_type,
                             lbs::GeometryType lbs_geo_type);
+  // Sweep data cache
+  uint64_t SweepDataCacheKey() const;
+  bool LoadSweepDataCache();
+  void SaveSweepDataCache() const;
+
   void InitFluxDataStructures(LBSGroupset& groupset);
   void ResetSweepOrderings(LBSGroupset& groupset);
   virtual std::shared_ptr<SweepChunk> SetSweepChunk(LBSGroupset& groupset);
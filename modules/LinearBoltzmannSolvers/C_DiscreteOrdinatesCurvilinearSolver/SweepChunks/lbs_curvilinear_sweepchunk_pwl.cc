@@ -91,6 +91,8 @@ SweepChunkPWLRZ::SweepChunkPWLRZ(
 
   post_cell_dir_sweep_callbacks_.push_back(
     std::bind(&SweepChunkPWLRZ::PostCellDirSweepCallback, this));
+
+  standard_kernel_pipeline_available_ = false;
 }
 
 // ##################################################################
@@ -189,7 +191,7 @@ void SweepChunkPWLRZ::KernelFEMRZUpwindSurfaceIntegrals()
     {
       const int j = cell_mapping_->MapFaceNode(f, fj);
 
-      const double* psi = sweep_dependency_interface_.GetUpwindPsi(fj);
+      const PsiFloat* psi = sweep_dependency_interface_.GetUpwindPsi(fj);
 
       const double mu_Nij = -mu * M_surf_f[i][j];
       Amat_[i][j] += mu_Nij;
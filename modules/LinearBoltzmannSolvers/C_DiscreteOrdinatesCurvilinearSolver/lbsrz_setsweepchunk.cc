@@ -23,6 +23,8 @@ lbs::DiscreteOrdinatesCurvilinearSolver::SetSweepChunk(
                                       num_moments_,
                                       max_cell_dof_count_);
 
+  sweep_chunk->SetDestinationPsiStore(GroupsetPsiStore(groupset));
+
   return sweep_chunk;
 }
 
@@ -0,0 +1,35 @@
+#include "D_DO_Transient/lbts_transient_solver.h"
+#include "D_DO_Transient/SweepChunks/lbts_sweepchunk_pwl.h"
+
+#include "LinearBoltzmannSolvers/B_DO_Solver/IterativeMethods/sweep_wgs_context.h"
+#include "LinearBoltzmannSolvers/A_LBSSolver/IterativeMethods/wgs_linear_solver.h"
+
+//###################################################################
+/**Builds the sweep chunks and within-groupset solvers used by every time
+ * step. The solvers are set up on their first solve and keep their PETSc
+ * objects and DSA preconditioners afterwards. The sweep chunks read the
+ * time step when they sweep and the source function holds a reference to
+ * it, hence a new time step only has to be passed to the chunks.*/
+void lbs::DiscOrdTransientSolver::InitializeTransientWGSSolvers()
+{
+  transient_sweep_chunks_.clear();
+  transient_wgs_solvers_.clear();
+  for (auto& groupset : groupsets_)
+  {
+    auto sweep_chunk = SetTransientSweepChunk(groupset);
+
+    auto sweep_wgs_context_ptr =
+    std::make_shared<SweepWGSContext<Mat, Vec, KSP>>(
+      *this, groupset,
+        active_set_source_function_,
+        APPLY_WGS_SCATTER_SOURCES | APPLY_WGS_FISSION_SOURCES,  //lhs_scope
+        APPLY_FIXED_SOURCES | APPLY_AGS_SCATTER_SOURCES |
+        APPLY_AGS_FISSION_SOURCES,                              //rhs_scope
+        options_.verbose_inner_iterations,
+        sweep_chunk);
+
+    transient_sweep_chunks_.push_back(sweep_chunk);
+    transient_wgs_solvers_.push_back(
+      std::make_shared<WGSLinearSolver<Mat,Vec,KSP>>(sweep_wgs_context_ptr));
+  }//for groupset
+}
@@ -2,15 +2,21 @@
 #include "D_DO_Transient/SweepChunks/lbts_sweepchunk_pwl.h"
 
 //###################################################################
-/**Sets up the sweek chunk for the given discretization method.*/
-std::shared_ptr<SweepChunk> lbs::DiscOrdTransientSolver::
-  SetTransientSweepChunk(LBSGroupset& groupset)
+/**Theta of the sweep chunks for the current stepping method.*/
+double lbs::DiscOrdTransientSolver::SweepChunkTheta() const
 {
-  double theta;
   if (method == chi_math::SteppingMethod::IMPLICIT_EULER)
-    theta = 1.0;
+    return 1.0;
   else
-    theta = 0.5;
+    return 0.5;
+}
+
+//###################################################################
+/**Sets up the sweek chunk for the given discretization method.*/
+std::shared_ptr<lbs::SweepChunkPWLTransientTheta>
+  lbs::DiscOrdTransientSolver::SetTransientSweepChunk(LBSGroupset& groupset)
+{
+  const double theta = SweepChunkTheta();
 
   //================================================== Setting up required
   //                                                   sweep chunks
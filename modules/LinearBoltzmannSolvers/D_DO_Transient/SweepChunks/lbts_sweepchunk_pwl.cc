@@ -15,7 +15,7 @@ SweepChunkPWLTransientTheta(
   std::vector<lbs::CellLBSView>& cell_transport_views,
   std::vector<double>& destination_phi,
   std::vector<double>& destination_psi,
-  const std::vector<double>& psi_prev_ref,
+  const AngularFluxStore& psi_prev_ref,
   const double input_theta,
   const double time_step,
   const std::vector<double>& source_moments,
@@ -43,10 +43,10 @@ SweepChunkPWLTransientTheta(
 
 }
 
-const double* lbs::SweepChunkPWLTransientTheta::Upwinder::
+const lbs::PsiFloat* lbs::SweepChunkPWLTransientTheta::Upwinder::
 GetUpwindPsi(int fj, bool local, bool boundary) const
 {
-  const double* psi;
+  const PsiFloat* psi;
   if (local)             psi = fluds.UpwindPsi(spls_index,
                                                 in_face_counter,
                                                 fj,0,angle_set_index);
@@ -60,10 +60,10 @@ GetUpwindPsi(int fj, bool local, bool boundary) const
   return psi;
 }
 
-double* lbs::SweepChunkPWLTransientTheta::Upwinder::
+lbs::PsiFloat* lbs::SweepChunkPWLTransientTheta::Upwinder::
 GetDownwindPsi(int fi, bool local, bool boundary, bool reflecting_bndry) const
 {
-  double* psi;
+  PsiFloat* psi;
   if (local)                 psi = fluds.
       OutgoingPsi(spls_index,
                   out_face_counter,
@@ -212,7 +212,7 @@ void lbs::SweepChunkPWLTransientTheta::
           {
             const int j = cell_mapping.MapFaceNode(f,fj);
 
-            const double* psi = upwind.GetUpwindPsi(fj, local, boundary);
+            const PsiFloat* psi = upwind.GetUpwindPsi(fj, local, boundary);
 
             const double mu_Nij = -mu * M_surf[f][i][j];
             Amat_[i][j] += mu_Nij;
@@ -240,7 +240,7 @@ void lbs::SweepChunkPWLTransientTheta::
           }//for m
           cint64_t imap = grid_fe_view_.MapDOFLocal(cell, i, psi_uk_man, angle_num, 0);
           if (fixed_src_active)
-            temp_src += tau_gsg[gsg] * psi_prev_[imap + gsg];
+            temp_src += tau_gsg[gsg] * psi_prev_.Get(imap + gsg);
           source_[i] = temp_src;
         }//for i
 
@@ -323,7 +323,7 @@ void lbs::SweepChunkPWLTransientTheta::
         {
           const int i = cell_mapping.MapFaceNode(f,fi);
 
-          double* psi = upwind.GetDownwindPsi(fi, local, boundary, reflecting_bndry);
+          PsiFloat* psi = upwind.GetDownwindPsi(fi, local, boundary, reflecting_bndry);
 
           if (not boundary or reflecting_bndry)
             for (int gsg = 0; gsg < gs_ss_size; ++gsg)
@@ -9,10 +9,13 @@
 
 #include "Ca_DO_SteadyState/lbs_DO_steady_state.h"
 #include "LinearBoltzmannSolvers/A_LBSSolver/Groupset/lbs_groupset.h"
+#include "LinearBoltzmannSolvers/A_LBSSolver/Tools/lbs_angular_flux_store.h"
 
 
 namespace lbs
 {
+using chi_mesh::sweep_management::PsiFloat;
+
 //###################################################################
 /**Sweep chunk for cartesian PWLD discretization Theta-scheme timestepping.*/
 class SweepChunkPWLTransientTheta : public chi_mesh::sweep_management::SweepChunk
@@ -30,9 +33,9 @@ protected:
   const int max_num_cell_dofs_;
   const bool save_angular_flux_;
 
-  const std::vector<double>& psi_prev_;
-  const double theta_;
-  const double dt_;
+  const AngularFluxStore& psi_prev_;
+  double theta_;
+  double dt_;
 
   //Runtime params
   bool a_and_b_initialized_;
@@ -51,7 +54,7 @@ public:
     std::vector<lbs::CellLBSView>& cell_transport_views,
     std::vector<double>& destination_phi,
     std::vector<double>& destination_psi,
-    const std::vector<double>& psi_prev_ref,
+    const AngularFluxStore& psi_prev_ref,
     double input_theta,
     double time_step,
     const std::vector<double>& source_moments,
@@ -62,6 +65,14 @@ public:
 
   void Sweep(chi_mesh::sweep_management::AngleSet* angle_set) override;
 
+  /**Sets the time step and theta. These are only used while sweeping, so
+   * the chunk can be reused across time steps.*/
+  void SetTimeStep(double time_step, double theta)
+  {
+    dt_ = time_step;
+    theta_ = theta;
+  }
+
 
   struct Upwinder
   {
@@ -81,11 +92,11 @@ public:
     size_t gs_ss_begin;
     bool surface_source_active;
 
-    const double* GetUpwindPsi(int fj, bool local, bool boundary) const;
-    double* GetDownwindPsi(int fi,
-                           bool local,
-                           bool boundary,
-                           bool reflecting_bndry) const;
+    const PsiFloat* GetUpwindPsi(int fj, bool local, bool boundary) const;
+    PsiFloat* GetDownwindPsi(int fi,
+                             bool local,
+                             bool boundary,
+                             bool reflecting_bndry) const;
   };
 
 };
@@ -11,6 +11,12 @@ void lbs::DiscOrdTransientSolver::Initialize()
 {
   chi::log.Log() << "Initializing " << TextName() << ".";
   options_.save_angular_flux = true;
+  // The transient sweep chunk writes directly into psi_new_local_
+  ChiInvalidArgumentIf(
+    options_.angular_flux_storage != AngularFluxStorageMode::DOUBLE,
+    "The transient solver requires \"angular_flux_storage\" to be "
+    "\"double\". Use \"retained_angular_flux_storage\" to reduce the "
+    "memory of the angular fluxes of the previous time step.");
   DiscOrdKEigenvalueSolver::Initialize();
   DiscOrdKEigenvalueSolver::Execute();
 
@@ -26,7 +32,14 @@ void lbs::DiscOrdTransientSolver::Initialize()
   fission_rate_local_.resize(grid_ptr_->local_cells.size(), 0.0);
   phi_prev_local_ = phi_old_local_;
   precursor_prev_local_ = precursor_new_local_;
-  psi_prev_local_ = psi_new_local_;
+  psi_prev_local_.clear();
+  for (const auto& psi : psi_new_local_)
+  {
+    psi_prev_local_.emplace_back(options_.retained_angular_flux_storage,
+                                 psi.size(),
+                                 options_.angular_flux_spill_folder);
+    psi_prev_local_.back().Assign(psi);
+  }
 
   if (transient_options_.verbosity_level >= 0)
   {
@@ -1,7 +1,5 @@
 #include "lbts_transient_solver.h"
-
-#include "LinearBoltzmannSolvers/B_DO_Solver/IterativeMethods/sweep_wgs_context.h"
-#include "LinearBoltzmannSolvers/A_LBSSolver/IterativeMethods/wgs_linear_solver.h"
+#include "D_DO_Transient/SweepChunks/lbts_sweepchunk_pwl.h"
 
 #include "chi_runtime.h"
 #include "chi_log.h"
@@ -15,29 +13,24 @@ void lbs::DiscOrdTransientSolver::Step()
 
   phi_old_local_ = phi_prev_local_;
 
+  //======================================== Reuse the solvers of previous
+  //                                         steps, only updating dt
+  if (transient_wgs_solvers_.empty())
+    InitializeTransientWGSSolvers();
+  else
+    for (auto& sweep_chunk : transient_sweep_chunks_)
+      sweep_chunk->SetTimeStep(dt_, SweepChunkTheta());
+
   for (auto& groupset : groupsets_)
   {
     //======================================== Converge the scattering source
     //                                         with a fixed fission source
     //                                         and temporal source
     q_moments_local_.assign(q_moments_local_.size(), 0.0);
-    auto sweep_chunk = SetTransientSweepChunk(groupset);
-
-    auto sweep_wgs_context_ptr =
-    std::make_shared<SweepWGSContext<Mat, Vec, KSP>>(
-      *this, groupset,
-        active_set_source_function_,
-        APPLY_WGS_SCATTER_SOURCES | APPLY_WGS_FISSION_SOURCES,  //lhs_scope
-        APPLY_FIXED_SOURCES | APPLY_AGS_SCATTER_SOURCES |
-        APPLY_AGS_FISSION_SOURCES,                              //rhs_scope
-        options_.verbose_inner_iterations,
-        sweep_chunk);
-
-    WGSLinearSolver<Mat,Vec,KSP> solver(sweep_wgs_context_ptr);
-    solver.Setup();
-    solver.Solve();
 
-    Chi::mpi.Barrier();
+    auto& solver = transient_wgs_solvers_[groupset.id_];
+    solver->Setup();
+    solver->Solve();
   }
 
   //======================================== Compute t^{n+1} value
@@ -6,7 +6,8 @@ void lbs::DiscOrdTransientSolver::Advance()
 {
   time_ += dt_;
   phi_prev_local_ = phi_new_local_;
-  psi_prev_local_ = psi_new_local_;
+  for (size_t gs = 0; gs < psi_new_local_.size(); ++gs)
+    psi_prev_local_[gs].Assign(psi_new_local_[gs]);
   if (options_.use_precursors)
     precursor_prev_local_ = precursor_new_local_;
 }
@@ -9,6 +9,8 @@ typedef chi_mesh::sweep_management::SweepChunk SweepChunk;
 namespace lbs
 {
 
+class SweepChunkPWLTransientTheta;
+
 //################################################################### Class def
 /**A transient neutral particle transport solver.
  *
@@ -47,11 +49,19 @@ protected:
   /**Previous time step vectors.*/
   std::vector<double> phi_prev_local_;
   std::vector<double> precursor_prev_local_;
-  std::vector<std::vector<double>> psi_prev_local_;
+  /**Retained angular fluxes, held according to
+   * options_.retained_angular_flux_storage.*/
+  std::vector<AngularFluxStore> psi_prev_local_;
 
   /**Fission rate vector*/
   std::vector<double> fission_rate_local_;
 
+  /**Per-groupset sweep chunks and within-groupset solvers. These are built
+   * on the first step and reused by all the following steps.*/
+  std::vector<std::shared_ptr<SweepChunkPWLTransientTheta>>
+    transient_sweep_chunks_;
+  std::vector<LinSolvePtr> transient_wgs_solvers_;
+
 public:
   explicit DiscOrdTransientSolver(const std::string& in_text_name);
 
@@ -63,7 +73,10 @@ public:
   void Advance() override;
 
   //Iterative operations
-  std::shared_ptr<SweepChunk> SetTransientSweepChunk(LBSGroupset& groupset);
+  std::shared_ptr<SweepChunkPWLTransientTheta>
+    SetTransientSweepChunk(LBSGroupset& groupset);
+  double SweepChunkTheta() const;
+  void InitializeTransientWGSSolvers();
 
   double ComputeBeta();
   void   PostStepCallBackFunction() const;
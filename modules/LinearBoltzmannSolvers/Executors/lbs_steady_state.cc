@@ -50,6 +50,11 @@ void SteadyStateSolver::Execute()
   if (lbs_solver_.Options().use_precursors)
     lbs_solver_.ComputePrecursors();
 
+  const auto& options = lbs_solver_.Options();
+  if (options.write_restart_data)
+    lbs_solver_.WriteRestartData(options.write_restart_folder_name,
+                                 options.write_restart_file_base);
+
   lbs_solver_.UpdateFieldFunctions();
 }
 
@@ -182,6 +182,30 @@ chi::ParameterBlock chi_math_Test02_ParallelVector(const chi::InputParameters&)
                       << ghost_vec2.GetGlobalValue(1)
                       << std::endl;
 
+  //==================================================
+  Chi::log.Log() << "Testing chi_math::VectorGhostCommunicator "
+                 << "split communication and modes" << std::endl;
+
+  for (const auto mode : {GhostCommunicationMode::ALLTOALLV,
+                          GhostCommunicationMode::NEIGHBORHOOD})
+  {
+    VectorGhostCommunicator vgc3(5, 10, ghost_ids, Chi::mpi.comm, mode);
+    auto ghosted = vgc3.MakeGhostedVector();
+    for (size_t i = 0; i < 5; ++i)
+      ghosted[i] = static_cast<double>(5 * Chi::mpi.location_id + i);
+
+    vgc3.CommunicateGhostEntriesBegin(ghosted);
+    // Owned entries can change while the communication is in progress
+    ghosted[0] = -1.0;
+    vgc3.CommunicateGhostEntriesEnd(ghosted);
+
+    std::stringstream outstr;
+    for (size_t i = 5; i < ghosted.size(); ++i)
+      outstr << ghosted[i] << " ";
+    Chi::log.LogAll() << "vgc3 mode " << static_cast<int>(mode)
+                      << " ghosts: " << outstr.str() << std::endl;
+  }
+
   return chi::ParameterBlock();
 }
 
@@ -0,0 +1,71 @@
+#include "math/chi_math.h"
+#include "math/chi_math_batched_linear_algebra.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+
+#include <cmath>
+
+namespace chi_unit_tests
+{
+
+chi::ParameterBlock
+chi_math_Test03_BatchedGaussElimination(const chi::InputParameters& params);
+
+RegisterWrapperFunction(
+  /*namespace_name=*/chi_unit_tests,
+  /*name_in_lua=*/chi_math_Test03_BatchedGaussElimination,
+  /*syntax_function=*/nullptr,
+  /*actual_function=*/chi_math_Test03_BatchedGaussElimination);
+
+chi::ParameterBlock
+chi_math_Test03_BatchedGaussElimination(const chi::InputParameters&)
+{
+  const size_t num_systems = 13; // Deliberately not a multiple of the width
+  const size_t stride = chi_math::PaddedBatchStride(num_systems);
+
+  for (const int n : {3, 4, 8, 16, 20})
+  {
+    chi_math::AlignedVecDbl A(n * n * stride, 0.0);
+    chi_math::AlignedVecDbl b(n * stride, 0.0);
+
+    // Reference solutions with the scalar routine
+    std::vector<VecDbl> x_ref(num_systems);
+    for (size_t s = 0; s < num_systems; ++s)
+    {
+      MatDbl As(n, VecDbl(n, 0.0));
+      VecDbl bs(n, 0.0);
+      for (int i = 0; i < n; ++i)
+      {
+        for (int j = 0; j < n; ++j)
+          As[i][j] = std::sin(1.0 + i + 2.0 * j + 0.1 * s);
+        As[i][i] += 2.0 * n + 0.5 * s; // Diagonally dominant
+        bs[i] = std::cos(0.3 * i + s);
+
+        for (int j = 0; j < n; ++j)
+          A[(i * n + j) * stride + s] = As[i][j];
+        b[i * stride + s] = bs[i];
+      }
+      chi_math::GaussElimination(As, bs, n);
+      x_ref[s] = bs;
+    }
+
+    chi_math::BatchedGaussElimination(A.data(), b.data(), n, num_systems,
+                                      stride);
+
+    double max_diff = 0.0;
+    for (size_t s = 0; s < num_systems; ++s)
+      for (int i = 0; i < n; ++i)
+        max_diff =
+          std::max(max_diff, std::fabs(b[i * stride + s] - x_ref[s][i]));
+
+    Chi::log.Log() << "BatchedGaussElimination n=" << n << " "
+                   << (max_diff < 1.0e-12 ? "passed" : "FAILED");
+  }
+
+  return chi::ParameterBlock();
+}
+
+} // namespace chi_unit_tests
@@ -0,0 +1 @@
+chi_unit_tests.chi_math_Test03_BatchedGaussElimination()
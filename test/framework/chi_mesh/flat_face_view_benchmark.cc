@@ -0,0 +1,152 @@
+#include "mesh/MeshHandler/chi_meshhandler.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+
+#include <chrono>
+
+namespace chi_unit_tests
+{
+
+chi::InputParameters FlatFaceViewBenchmarkSyntax();
+chi::ParameterBlock
+FlatFaceViewBenchmark(const chi::InputParameters& input_parameters);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/FlatFaceViewBenchmark,
+                        /*syntax_function=*/FlatFaceViewBenchmarkSyntax,
+                        /*actual_function=*/FlatFaceViewBenchmark);
+
+chi::InputParameters FlatFaceViewBenchmarkSyntax()
+{
+  chi::InputParameters params;
+
+  params.AddRequiredParameterBlock("arg0", "General parameters");
+
+  return params;
+}
+
+namespace
+{
+/**Sums, over a pass, the quantities read by the sweep and assembly face
+ * loops. Both access paths must produce the same values.*/
+struct FaceLoopSums
+{
+  double mu = 0.0;
+  uint64_t neighbor_ids = 0;
+  int64_t neighbor_local_ids = 0;
+  uint64_t vertex_ids = 0;
+
+  bool operator==(const FaceLoopSums& other) const
+  {
+    return mu == other.mu and neighbor_ids == other.neighbor_ids and
+           neighbor_local_ids == other.neighbor_local_ids and
+           vertex_ids == other.vertex_ids;
+  }
+};
+} // namespace
+
+/**Loops repeatedly over the faces of the local cells of the current grid,
+ * once through the cells' own faces and once through the grid's
+ * FlatFaceView, and reports the average time per pass of both. The loops
+ * compute omega dot normal for a few directions and resolve the local
+ * neighbors and the face vertices, like the sweep and assembly loops.*/
+chi::ParameterBlock
+FlatFaceViewBenchmark(const chi::InputParameters& input_parameters)
+{
+  const chi::ParameterBlock& params = input_parameters.GetParam("arg0");
+
+  const int num_passes = params.Has("num_passes")
+                           ? params.GetParamValue<int>("num_passes")
+                           : 20;
+
+  const auto& grid = *chi_mesh::GetCurrentHandler().GetGrid();
+  const auto& face_view = grid.GetFlatFaceView();
+
+  const std::vector<chi_mesh::Vector3> omegas = {
+    chi_mesh::Vector3(0.5, 0.5, 0.7071067811865476),
+    chi_mesh::Vector3(-0.5, 0.5, 0.7071067811865476),
+    chi_mesh::Vector3(0.5, -0.5, -0.7071067811865476),
+    chi_mesh::Vector3(-0.5, -0.5, -0.7071067811865476)};
+
+  auto CellFacesPass = [&]()
+  {
+    FaceLoopSums sums;
+    for (const auto& omega : omegas)
+      for (const auto& cell : grid.local_cells)
+        for (const auto& face : cell.faces_)
+        {
+          sums.mu += omega.Dot(face.normal_);
+          if (face.has_neighbor_)
+          {
+            sums.neighbor_ids += face.neighbor_id_;
+            if (grid.IsCellLocal(face.neighbor_id_))
+              sums.neighbor_local_ids += static_cast<int64_t>(
+                grid.cells[face.neighbor_id_].local_id_);
+          }
+          for (uint64_t vid : face.vertex_ids_)
+            sums.vertex_ids += vid;
+        }
+    return sums;
+  };
+
+  auto FlatFaceViewPass = [&]()
+  {
+    FaceLoopSums sums;
+    for (const auto& omega : omegas)
+      for (const auto& cell : grid.local_cells)
+      {
+        const size_t face_offset = face_view.CellFaceOffset(cell.local_id_);
+        const size_t num_faces = face_view.NumFaces(cell.local_id_);
+        for (size_t fi = face_offset; fi < face_offset + num_faces; ++fi)
+        {
+          sums.mu += omega.Dot(face_view.Normal(fi));
+          if (face_view.HasNeighbor(fi))
+          {
+            sums.neighbor_ids += face_view.NeighborID(fi);
+            const int64_t local_id = face_view.NeighborLocalID(fi);
+            if (local_id >= 0) sums.neighbor_local_ids += local_id;
+          }
+          const uint64_t* vertex_ids = face_view.FaceVertexIDs(fi);
+          for (size_t v = 0; v < face_view.NumFaceVertices(fi); ++v)
+            sums.vertex_ids += vertex_ids[v];
+        }
+      }
+    return sums;
+  };
+
+  auto TimePasses = [num_passes](auto Pass, FaceLoopSums& sums)
+  {
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int p = 0; p < num_passes; ++p)
+      sums = Pass();
+    const auto t1 = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double>(t1 - t0).count() / num_passes;
+  };
+
+  FaceLoopSums cell_faces_sums;
+  FaceLoopSums flat_face_view_sums;
+  const double time_cell_faces = TimePasses(CellFacesPass, cell_faces_sums);
+  const double time_flat_face_view =
+    TimePasses(FlatFaceViewPass, flat_face_view_sums);
+
+  Chi::log.Log() << "FlatFaceViewBenchmark num_faces=" << face_view.NumFaces();
+  Chi::log.Log() << "Cell faces average pass time (s):     "
+                 << time_cell_faces;
+  Chi::log.Log() << "Flat face view average pass time (s): "
+                 << time_flat_face_view;
+  Chi::log.Log() << "Speedup: " << time_cell_faces / time_flat_face_view;
+
+  if (cell_faces_sums == flat_face_view_sums)
+    Chi::log.Log() << "FlatFaceViewBenchmark results identical";
+  else
+    Chi::log.Log() << "FlatFaceViewBenchmark results differ";
+
+  return chi::ParameterBlock{};
+}
+
+} // namespace chi_unit_tests
@@ -0,0 +1,30 @@
+-- Micro-benchmark comparing loops over the faces of the local cells through
+-- the cells' own faces and through the grid's flat face view, on a fixed 3D
+-- orthogonal mesh.
+-- Test: FlatFaceViewBenchmark results identical
+num_procs = 1
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+  chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+nodes={}
+N=30
+L=5.0
+xmin = -L/2
+dx = L/N
+for i=1,(N+1) do
+  k=i-1
+  nodes[i] = xmin + k*dx
+end
+
+meshgen1 = chi_mesh.OrthogonalMeshGenerator.Create({ node_sets = {nodes,nodes,nodes} })
+chi_mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Benchmark
+chi_unit_tests.FlatFaceViewBenchmark({num_passes = 20})
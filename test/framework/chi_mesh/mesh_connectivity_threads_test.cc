@@ -0,0 +1,80 @@
+#include "mesh/UnpartitionedMesh/chi_unpartitioned_mesh.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+
+namespace chi_unit_tests
+{
+
+chi::ParameterBlock MeshConnectivityThreadsTest(const chi::InputParameters&);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/MeshConnectivityThreadsTest,
+                        /*syntax_function=*/nullptr,
+                        /*actual_function=*/MeshConnectivityThreadsTest);
+
+/**Reads the same mesh with BuildMeshConnectivity running on 1, 3 and 4
+ * threads and counts the faces whose connectivity differs from the
+ * single-threaded result.*/
+chi::ParameterBlock MeshConnectivityThreadsTest(const chi::InputParameters&)
+{
+  const size_t original_num_mesh_threads = Chi::run_time::num_mesh_threads_;
+
+  chi_mesh::UnpartitionedMesh::Options options;
+  options.file_name = "ReactorPinMesh.obj";
+
+  Chi::run_time::num_mesh_threads_ = 1;
+  chi_mesh::UnpartitionedMesh serial_mesh;
+  serial_mesh.ReadFromWavefrontOBJ(options);
+  const auto& serial_cells = serial_mesh.GetRawCells();
+
+  size_t num_connected_faces = 0;
+  for (const auto* cell : serial_cells)
+    for (const auto& face : cell->faces)
+      if (face.has_neighbor) ++num_connected_faces;
+
+  Chi::log.Log() << "MeshConnectivityThreadsTest num_connected_faces="
+                 << num_connected_faces;
+
+  size_t total_num_mismatches = 0;
+  for (const size_t num_threads : {size_t(3), size_t(4)})
+  {
+    Chi::run_time::num_mesh_threads_ = num_threads;
+    chi_mesh::UnpartitionedMesh threaded_mesh;
+    threaded_mesh.ReadFromWavefrontOBJ(options);
+    const auto& threaded_cells = threaded_mesh.GetRawCells();
+
+    size_t num_mismatches = 0;
+    if (threaded_cells.size() != serial_cells.size()) ++num_mismatches;
+    else
+      for (size_t c = 0; c < serial_cells.size(); ++c)
+      {
+        const auto& serial_faces = serial_cells[c]->faces;
+        const auto& threaded_faces = threaded_cells[c]->faces;
+        if (threaded_faces.size() != serial_faces.size())
+        {
+          ++num_mismatches;
+          continue;
+        }
+        for (size_t f = 0; f < serial_faces.size(); ++f)
+          if (threaded_faces[f].has_neighbor != serial_faces[f].has_neighbor or
+              threaded_faces[f].neighbor != serial_faces[f].neighbor)
+            ++num_mismatches;
+      }
+
+    Chi::log.Log() << "MeshConnectivityThreadsTest " << num_threads
+                   << " threads num_mismatches=" << num_mismatches;
+    total_num_mismatches += num_mismatches;
+  }
+
+  Chi::run_time::num_mesh_threads_ = original_num_mesh_threads;
+
+  Chi::log.Log() << "MeshConnectivityThreadsTest total_num_mismatches="
+                 << total_num_mismatches;
+
+  return chi::ParameterBlock{};
+}
+
+} // namespace chi_unit_tests
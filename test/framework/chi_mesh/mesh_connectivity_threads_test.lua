@@ -0,0 +1,4 @@
+-- Compares the cell connectivity of a mesh built on several threads with
+-- the single-threaded connectivity.
+-- Test: total_num_mismatches=0
+chi_unit_tests.MeshConnectivityThreadsTest()
@@ -0,0 +1,6 @@
+chi_unit_tests.chi_mpi_Test00_MapAllToAll()
+
+--############################################### Runtime selection
+chiMPISetMapAllToAllAlgorithm("NBX")
+chi_unit_tests.chi_mpi_Test00_MapAllToAll()
+chiMPISetMapAllToAllAlgorithm("DENSE")
@@ -0,0 +1,68 @@
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+
+#include <sstream>
+
+namespace chi_unit_tests
+{
+
+chi::ParameterBlock LogRepeatingEventTest(const chi::InputParameters&);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/LogRepeatingEventTest,
+                        /*syntax_function=*/nullptr,
+                        /*actual_function=*/LogRepeatingEventTest);
+
+/**Logs many more events than the history retains and checks that the
+ * aggregates still account for all of them.*/
+chi::ParameterBlock LogRepeatingEventTest(const chi::InputParameters&)
+{
+  typedef chi::ChiLog::EventType EventType;
+  typedef chi::ChiLog::EventOperation EventOperation;
+
+  Chi::log.Log() << "LogRepeatingEvent test";
+
+  Chi::log.SetEventHistoryCapacity(16);
+  const size_t tag = Chi::log.GetRepeatingEventTag("RepeatingEventTest");
+
+  const int num_events = 10000;
+  for (int i = 0; i < num_events; ++i)
+  {
+    Chi::log.LogEvent(tag, EventType::EVENT_BEGIN);
+    Chi::log.LogEvent(
+      tag,
+      EventType::EVENT_END,
+      std::make_shared<chi::ChiLog::EventInfo>(static_cast<double>(i)));
+  }
+
+  Chi::log.SetEventTracing(false);
+  Chi::log.LogEvent(tag, EventType::SINGLE_OCCURRENCE);
+  Chi::log.SetEventTracing(true);
+
+  const double num_occurrences =
+    Chi::log.ProcessEvent(tag, EventOperation::NUMBER_OF_OCCURRENCES);
+  const double max_value =
+    Chi::log.ProcessEvent(tag, EventOperation::MAX_VALUE);
+  const double average_value =
+    Chi::log.ProcessEvent(tag, EventOperation::AVERAGE_VALUE);
+
+  std::stringstream history(Chi::log.PrintEventHistory(tag));
+  size_t num_history_lines = 0;
+  for (std::string line; std::getline(history, line);)
+    ++num_history_lines;
+
+  Chi::log.Log() << "num_occurrences=" << num_occurrences;
+  Chi::log.Log() << "max_value=" << max_value;
+  Chi::log.Log() << "average_value=" << average_value;
+  Chi::log.Log() << "num_history_lines=" << num_history_lines;
+  Chi::log.Log() << Chi::log.PrintEventSummary(tag);
+
+  Chi::log.SetEventHistoryCapacity(
+    chi::ChiLog::DEFAULT_EVENT_HISTORY_CAPACITY);
+
+  return chi::ParameterBlock{};
+}
+
+} // namespace chi_unit_tests
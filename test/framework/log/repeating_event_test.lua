@@ -0,0 +1,3 @@
+chi_unit_tests.LogRepeatingEventTest()
+
+chiLogExportEventTrace("repeating_event_test_trace.json")
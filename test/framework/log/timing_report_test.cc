@@ -0,0 +1,91 @@
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+#include "console/chi_console.h"
+
+#include "utils/chi_timer.h"
+
+namespace chi_unit_tests
+{
+
+chi::ParameterBlock LogTimingReportTest(const chi::InputParameters&);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/LogTimingReportTest,
+                        /*syntax_function=*/nullptr,
+                        /*actual_function=*/LogTimingReportTest);
+
+/**Times a block on every location and a block on location 0 only, then
+ * checks the global timing report and its JSON export.*/
+chi::ParameterBlock LogTimingReportTest(const chi::InputParameters&)
+{
+  Chi::log.Log() << "LogTimingReport test";
+
+  auto& t_all = Chi::log.CreateTimingBlock("ReportAllLocations");
+  for (int i = 0; i < 2; ++i)
+  {
+    t_all.TimeSectionBegin();
+    chi::Sleep(std::chrono::milliseconds(10));
+    t_all.TimeSectionEnd();
+  }
+
+  if (Chi::mpi.location_id == 0)
+  {
+    auto& t_0 =
+      Chi::log.CreateTimingBlock("ReportLocation0Only", "ReportAllLocations");
+    for (int i = 0; i < 3; ++i)
+    {
+      t_0.TimeSectionBegin();
+      chi::Sleep(std::chrono::milliseconds(50));
+      t_0.TimeSectionEnd();
+    }
+  }
+
+  const auto report = Chi::log.MakeGlobalTimingReport();
+
+  for (const auto& entry : report)
+  {
+    if (entry.name == "ReportAllLocations")
+    {
+      Chi::log.Log() << "all_path=" << entry.path;
+      Chi::log.Log() << "all_average_occurences=" << entry.average_occurences;
+    }
+    if (entry.name == "ReportLocation0Only")
+    {
+      Chi::log.Log() << "loc0_path=" << entry.path;
+      Chi::log.Log() << "loc0_depth=" << entry.depth;
+      Chi::log.Log() << "loc0_average_occurences="
+                     << entry.average_occurences;
+      Chi::log.Log() << "loc0_min_time=" << entry.min_time;
+      Chi::log.Log() << "loc0_max_location=" << entry.max_location;
+      Chi::log.Log() << "loc0_imbalance=" << entry.imbalance;
+      Chi::log.Log() << "loc0_max_time_ge_150ms="
+                     << (entry.max_time >= 0.15 ? 1 : 0);
+    }
+  }
+
+  //============================================= Check the JSON keys
+  const std::string json = Chi::log.MakeGlobalTimingReportJSON();
+
+  const std::vector<std::string> keys = {"\"num_locations\": ",
+                                         "\"timing_blocks\": [",
+                                         "\"path\": ",
+                                         "\"name\": \"ReportLocation0Only\"",
+                                         "\"depth\": ",
+                                         "\"average_occurences\": ",
+                                         "\"min_time\": ",
+                                         "\"average_time\": ",
+                                         "\"max_time\": ",
+                                         "\"max_location\": ",
+                                         "\"imbalance\": "};
+  size_t num_json_keys_found = 0;
+  for (const auto& key : keys)
+    if (json.find(key) != std::string::npos) ++num_json_keys_found;
+
+  Chi::log.Log() << "num_json_keys_found=" << num_json_keys_found;
+
+  return chi::ParameterBlock{};
+}
+
+} // namespace chi_unit_tests
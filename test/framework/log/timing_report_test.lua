@@ -0,0 +1,4 @@
+chi_unit_tests.LogTimingReportTest()
+
+chiLogPrintTimingReport()
+chiLogExportTimingReport("timing_report_test.json")
@@ -1,4 +1,5 @@
 chi_unit_tests.LogTimingInfoTest()
 
 chiLogPrintTimingGraph()
-chiLogPrintTimingGraph(1)
\ No newline at end of file
+chiLogPrintTimingGraph(1)
+chiLogPrintTimingReport()
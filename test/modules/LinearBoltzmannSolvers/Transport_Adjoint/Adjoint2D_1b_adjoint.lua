@@ -128,7 +128,9 @@ ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys1})
 chiSolverInitialize(ss_solver)
 chiSolverExecute(ss_solver)
 
-chiLBSWriteFluxMoments(phys1, "Adjoint2D_1b_adjoint")
+-- Written compressed, Adjoint2D_1c_response reads it back. Adjoint2D_2b
+-- covers the uncompressed path.
+chiLBSWriteFluxMoments(phys1, "Adjoint2D_1b_adjoint", true)
 
 --############################################### Get field functions
 ff_m0 = chiGetFieldFunctionHandleByName("phi_g000_m00")
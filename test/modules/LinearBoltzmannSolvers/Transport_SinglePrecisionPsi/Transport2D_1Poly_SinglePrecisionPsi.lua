@@ -0,0 +1,6 @@
+-- 2D Transport test with AAH sweeps, run against the double precision golds
+-- of Transport2D_1Poly.lua to check a build with
+-- CHI_SWEEP_SINGLE_PRECISION_PSI=ON.
+-- SDM: PWLD
+-- Test: Max-value=0.50758 and 2.52527e-04
+dofile("../Transport_Steady/Transport2D_1Poly.lua")
@@ -0,0 +1,7 @@
+-- 3D Transport test with CBC sweeps, run against the double precision golds
+-- of Transport3D_6CDistributedMesh.lua to check a build with
+-- CHI_SWEEP_SINGLE_PRECISION_PSI=ON.
+-- SDM: PWLD
+-- Test: max-grp0(latest) = 1.131566e-01
+--       max-grp19(latest) = 7.340585e-04
+dofile("../Transport_Steady/Transport3D_6CDistributedMesh.lua")
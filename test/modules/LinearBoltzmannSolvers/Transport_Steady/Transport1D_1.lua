@@ -1,7 +1,9 @@
 -- 1D Transport test with Vacuum and Incident-isotropic BC.
 -- SDM: PWLD
 -- Test: Max-value=0.49903 and 7.18243e-4
+-- Pass num_sweep_threads=<n> to execute the anglesets on n threads.
 num_procs = 3
+if (num_sweep_threads == nil) then num_sweep_threads = 1 end
 
 
 
@@ -108,6 +110,7 @@ lbs_options =
     }
   },
   scattering_order = 5,
+  num_sweep_threads = num_sweep_threads,
 }
 
 phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
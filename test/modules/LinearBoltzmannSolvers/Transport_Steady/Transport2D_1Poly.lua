@@ -1,7 +1,9 @@
 -- 2D Transport test with Vacuum and Incident-isotropic BC.
 -- SDM: PWLD
 -- Test: Max-value=0.50758 and 2.52527e-04
+-- Pass num_sweep_threads=<n> to execute the anglesets on n threads.
 num_procs = 4
+if (num_sweep_threads == nil) then num_sweep_threads = 1 end
 
 
 
@@ -115,6 +117,7 @@ lbs_options =
     }
   },
   scattering_order = 1,
+  num_sweep_threads = num_sweep_threads,
 }
 
 phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
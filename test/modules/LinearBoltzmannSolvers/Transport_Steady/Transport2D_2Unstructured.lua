@@ -1,7 +1,9 @@
 -- 2D Transport test with Vacuum and Incident-isotropic BC.
 -- SDM: PWLD
 -- Test: Max-value=0.51187 and 1.42458e-03
+-- Pass num_sweep_threads=<n> to set the sources and sweep on n threads.
 num_procs = 4
+if (num_sweep_threads == nil) then num_sweep_threads = 1 end
 --Unstructured mesh
 
 
@@ -114,6 +116,7 @@ lbs_options =
         }
     },
     scattering_order = 1,
+    num_sweep_threads = num_sweep_threads,
 }
 
 phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
@@ -0,0 +1,155 @@
+-- 2D LinearBSolver test of a block of graphite with an air cavity. DSA and TG
+-- SDM: PWLD
+-- Solves the problem of Transport2D_4a_DSA_ortho twice, first with assembled
+-- WGDSA/TGDSA operators and then with matrix-free operators, and compares
+-- the volume averaged scalar fluxes. The first groupset enables the
+-- matrix-free operator via the groupset parameters and the second via
+-- chiLBSGroupsetSetWGDSA/chiLBSGroupsetSetTGDSA.
+-- Test: matrix_free_max_rel_diff= 0.0 (tolerance 1.0e-5)
+num_procs = 4
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+  chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+nodes={}
+N=20
+L=100
+xmin = -L/2
+dx = L/N
+for i=1,(N+1) do
+  k=i-1
+  nodes[i] = xmin + k*dx
+end
+
+meshgen1 = chi_mesh.OrthogonalMeshGenerator.Create({ node_sets = {nodes,nodes} })
+chi_mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+chiVolumeMesherSetMatIDToAll(0)
+
+vol1 = chi_mesh.RPPLogicalVolume.Create
+({ xmin=-10.0,xmax=10.0,ymin=-10.0,ymax=10.0, infz=true })
+chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol1,1)
+
+--############################################### Add materials
+materials = {}
+materials[1] = chiPhysicsAddMaterial("Test Material");
+materials[2] = chiPhysicsAddMaterial("Test Material2");
+
+chiPhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+chiPhysicsMaterialAddProperty(materials[2],TRANSPORT_XSECTIONS)
+
+chiPhysicsMaterialAddProperty(materials[1],ISOTROPIC_MG_SOURCE)
+chiPhysicsMaterialAddProperty(materials[2],ISOTROPIC_MG_SOURCE)
+
+num_groups = 168
+chiPhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+  CHI_XSFILE,"xs_graphite_pure.cxs")
+chiPhysicsMaterialSetProperty(materials[2],TRANSPORT_XSECTIONS,
+  CHI_XSFILE,"xs_air50RH.cxs")
+
+src={}
+for g=1,num_groups do
+  src[g] = 0.0
+end
+src[1] = 1.0
+chiPhysicsMaterialSetProperty(materials[1],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+src[1] = 0.0
+chiPhysicsMaterialSetProperty(materials[2],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+
+--############################################### Setup Physics
+pquad0 = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,2, 2,false)
+chiOptimizeAngularQuadratureForPolarSymmetry(pquad0, 4.0*math.pi)
+
+-- The DSA solves are converged tightly so that both variants apply the
+-- same correction.
+dsa_tol = 1.0e-10
+dsa_max_its = 1000
+pp_groups = {0, 62, 100, 167}
+
+function SolveCase(case_name, matrix_free)
+  local lbs_block =
+  {
+    num_groups = num_groups,
+    groupsets =
+    {
+      {
+        groups_from_to = {0, 62},
+        angular_quadrature_handle = pquad0,
+        angle_aggregation_num_subsets = 1,
+        groupset_num_subsets = 1,
+        inner_linear_method = "gmres",
+        l_abs_tol = 1.0e-8,
+        l_max_its = 1000,
+        gmres_restart_interval = 30,
+        apply_wgdsa = true,
+        wgdsa_l_abs_tol = dsa_tol,
+        wgdsa_l_max_its = dsa_max_its,
+        wgdsa_matrix_free = matrix_free,
+      },
+      {
+        groups_from_to = {63, num_groups-1},
+        angular_quadrature_handle = pquad0,
+        angle_aggregation_num_subsets = 1,
+        groupset_num_subsets = 1,
+        inner_linear_method = "gmres",
+        l_abs_tol = 1.0e-8,
+        l_max_its = 1000,
+        gmres_restart_interval = 30,
+      },
+    }
+  }
+
+  local phys = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+  lbs.SetOptions(phys, { scattering_order = 1 })
+
+  chiLBSGroupsetSetWGDSA(phys,1,dsa_max_its,dsa_tol,false,"",matrix_free)
+  chiLBSGroupsetSetTGDSA(phys,1,dsa_max_its,dsa_tol,false,"",matrix_free)
+
+  local ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys})
+
+  chiSolverInitialize(ss_solver)
+  chiSolverExecute(ss_solver)
+
+  local fflist,count = chiLBSGetScalarFieldFunctionList(phys)
+
+  local pps = {}
+  for _,g in ipairs(pp_groups) do
+    pps[#pps+1] = chi.CellVolumeIntegralPostProcessor.Create
+    ({
+      name = case_name.."-grp"..tostring(g),
+      field_function = fflist[g+1],
+      compute_volume_average = true,
+      print_numeric_format = "scientific"
+    })
+  end
+  chi.ExecutePostProcessors(pps)
+
+  local values = {}
+  for i,pp in ipairs(pps) do
+    values[i] = chi.PostProcessorGetValue(pp)
+  end
+  return values
+end
+
+assembled_values = SolveCase("assembled", false)
+matrix_free_values = SolveCase("matrix_free", true)
+
+max_rel_diff = 0.0
+for i=1,#pp_groups do
+  local rel_diff = math.abs(matrix_free_values[i] - assembled_values[i]) /
+                   math.abs(assembled_values[i])
+  max_rel_diff = math.max(max_rel_diff, rel_diff)
+end
+
+chiLog(LOG_0, string.format("matrix_free_max_rel_diff=%.6e", max_rel_diff))
@@ -0,0 +1,39 @@
+-- 2D LinearBSolver restart test. Solves on 4 locations, partitioned in
+-- x-slabs, writes restart data and the volume averaged group 0 flux, which
+-- the Transport2D_6b-6e tests restore.
+-- SDM: PWLD
+num_procs = 4
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+  chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+restart_partitioner = chi.KBAGraphPartitioner.Create
+({
+  nx = 4, ny = 1, nz = 1,
+  xcuts = {-25.0, 0.0, 25.0},
+})
+restart_num_groups = 2
+restart_single_sweep = false
+restart_options =
+{
+  write_restart_data = true,
+  write_restart_folder_name = "YRestart6",
+  write_restart_file_base = "restart6",
+}
+
+dofile("utils/Restart_problem.lua")
+
+if (chi_location_id == 0) then
+  local file = io.open(restart_values_file, "w")
+  file:write(string.format("%.17e\n", restart_phi_avg))
+  file:close()
+end
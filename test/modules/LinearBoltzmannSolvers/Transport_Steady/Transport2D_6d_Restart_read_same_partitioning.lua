@@ -0,0 +1,36 @@
+-- 2D LinearBSolver restart test. Restores the restart data written by
+-- Transport2D_6a with the same partitioning, in which case every location
+-- reads its own block.
+-- SDM: PWLD
+-- Test: restart_rel_diff= 0.0 (tolerance 1.0e-6)
+num_procs = 4
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+  chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+restart_partitioner = chi.KBAGraphPartitioner.Create
+({
+  nx = 4, ny = 1, nz = 1,
+  xcuts = {-25.0, 0.0, 25.0},
+})
+restart_num_groups = 2
+restart_single_sweep = true
+restart_options =
+{
+  read_restart_data = true,
+  read_restart_folder_name = "YRestart6",
+  read_restart_file_base = "restart6",
+}
+
+dofile("utils/Restart_problem.lua")
+
+CompareRestoredFlux()
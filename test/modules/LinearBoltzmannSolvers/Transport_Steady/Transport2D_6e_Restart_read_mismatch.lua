@@ -0,0 +1,29 @@
+-- 2D LinearBSolver restart test. Attempts to restore the restart data
+-- written by Transport2D_6a, with 2 groups, into a problem with 3 groups.
+-- The read must be rejected with a layout mismatch.
+-- SDM: PWLD
+num_procs = 2
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+  chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+restart_partitioner = nil
+restart_num_groups = 3
+restart_single_sweep = true
+restart_options =
+{
+  read_restart_data = true,
+  read_restart_folder_name = "YRestart6",
+  read_restart_file_base = "restart6",
+}
+
+dofile("utils/Restart_problem.lua")
@@ -0,0 +1,24 @@
+-- 2D LinearBSolver test of single precision angular flux storage.
+-- Solves with two groupsets and angular_flux_storage = "single" and compares
+-- the scalar fluxes and the XMAX leakage with a single groupset solve that
+-- stores the angular fluxes in double precision.
+-- SDM: PWLD
+-- Test: single_phi_max_rel_diff= 0.0 (tolerance 1.0e-6)
+--       single_leakage_max_rel_diff= 0.0 (tolerance 1.0e-5)
+num_procs = 2
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+  chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+dofile("utils/AngularFluxStorage_problem.lua")
+
+CompareStorageToDouble("single")
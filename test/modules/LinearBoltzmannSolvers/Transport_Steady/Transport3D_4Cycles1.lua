@@ -105,6 +105,10 @@ if (reflecting) then
     {name = "zmax", type = "reflecting"})
 end
 
+if (sweep_data_cache ~= nil) then
+  lbs_block.sweep_data_cache_directory = sweep_data_cache
+end
+
 phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
 lbs.SetOptions(phys1, lbs_options)
 
@@ -156,6 +160,29 @@ maxval = chiFFInterpolationGetValue(curffi)
 
 chiLog(LOG_0,string.format("Max-value2=%.5e", maxval))
 
+--############################################### Rerun from sweep data cache
+if (sweep_data_cache ~= nil) then
+  phys2 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+  lbs.SetOptions(phys2, lbs_options)
+
+  ss_solver2 = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys2})
+  chiSolverInitialize(ss_solver2)
+  chiSolverExecute(ss_solver2)
+
+  fflist2,count2 = chiLBSGetScalarFieldFunctionList(phys2)
+
+  ffi2 = chiFFInterpolationCreate(VOLUME)
+  chiFFInterpolationSetProperty(ffi2,OPERATION,OP_MAX)
+  chiFFInterpolationSetProperty(ffi2,LOGICAL_VOLUME,vol0)
+  chiFFInterpolationSetProperty(ffi2,ADD_FIELDFUNCTION,fflist2[1])
+
+  chiFFInterpolationInitialize(ffi2)
+  chiFFInterpolationExecute(ffi2)
+  maxval = chiFFInterpolationGetValue(ffi2)
+
+  chiLog(LOG_0,string.format("Cached-Max-value1=%.5e", maxval))
+end
+
 --############################################### Exports
 if (master_export == nil) then
   chiExportFieldFunctionToVTKG(fflist[1],"ZPhi3D","Phi")
@@ -0,0 +1,168 @@
+-- 3D Transport test with cost-weighted partitioning of a two material mesh.
+-- The 8x8 quad mesh is written to a gmsh file and extruded. The cells of the
+-- two leftmost columns are material 0 with a cost factor of 3, the others
+-- material 1 with a cost factor of 1.
+-- SDM: PWLD
+-- With KBA nx=2, ny=2 and optimized cuts the x-cut lands at x=0.25 when the
+-- cells are weighted by cost, which balances the cost exactly:
+-- Test: Partitioner predicted cost imbalance max/avg = 1.0
+-- Without weights the x-cut lands at x=0.5 (pass partition_weights="none"):
+-- Test: Partitioner predicted cost imbalance max/avg = 1.333333
+-- Pass partitioner_type="parmetis" to use the PETSc partitioner, balancing
+-- both the cost and the cell count.
+num_procs = 4
+if (partition_weights == nil) then partition_weights = "cost" end
+if (partitioner_type == nil) then partitioner_type = "kba" end
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+  chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+--############################################### Write the 2D mesh
+-- Every location writes its own copy since every location reads the mesh.
+N = 8
+L = 1.0
+dx = L/N
+mesh_file_name = string.format("YCostWeightedPartition_%s_%s_%d.msh",
+                               partition_weights, partitioner_type,
+                               chi_location_id)
+
+mesh_file = io.open(mesh_file_name, "w")
+mesh_file:write("$MeshFormat\n2.2 0 8\n$EndMeshFormat\n")
+mesh_file:write("$Nodes\n"..tostring((N+1)*(N+1)).."\n")
+for j=0,N do
+  for i=0,N do
+    mesh_file:write(string.format("%d %.6f %.6f 0.0\n",
+                                  j*(N+1)+i+1, i*dx, j*dx))
+  end
+end
+mesh_file:write("$EndNodes\n")
+mesh_file:write("$Elements\n"..tostring(N*N).."\n")
+for j=0,N-1 do
+  for i=0,N-1 do
+    local v0 = j*(N+1)+i+1
+    -- Physical regions 1 and 2 become materials 0 and 1
+    local physical_region = (i < 2) and 1 or 2
+    mesh_file:write(string.format("%d 3 2 %d 1 %d %d %d %d\n",
+                                  j*N+i+1, physical_region,
+                                  v0, v0+1, v0+N+2, v0+N+1))
+  end
+end
+mesh_file:write("$EndElements\n")
+mesh_file:close()
+
+--############################################### Setup mesh
+if (partitioner_type == "parmetis") then
+  partitioner = chi.PETScGraphPartitioner.Create({type="parmetis"})
+else
+  partitioner = chi.KBAGraphPartitioner.Create
+  ({
+    nx = 2, ny = 2,
+    optimize_cuts = true,
+  })
+end
+
+meshgen1 = chi_mesh.ExtruderMeshGenerator.Create
+({
+  inputs =
+  {
+    chi_mesh.FromFileMeshGenerator.Create({ filename = mesh_file_name }),
+  },
+  layers = {{z=1.0, n=4}},
+  partitioner = partitioner,
+  partition_weights = partition_weights,
+  partition_multi_constraint = (partitioner_type == "parmetis"),
+  material_cost_factors = {3.0, 1.0},
+})
+
+chi_mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Add materials
+materials = {}
+materials[1] = chiPhysicsAddMaterial("Test Material");
+materials[2] = chiPhysicsAddMaterial("Test Material2");
+
+chiPhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+chiPhysicsMaterialAddProperty(materials[2],TRANSPORT_XSECTIONS)
+
+chiPhysicsMaterialAddProperty(materials[1],ISOTROPIC_MG_SOURCE)
+chiPhysicsMaterialAddProperty(materials[2],ISOTROPIC_MG_SOURCE)
+
+num_groups = 2
+chiPhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+  SIMPLEXS1,num_groups,1.0,0.9)
+chiPhysicsMaterialSetProperty(materials[2],TRANSPORT_XSECTIONS,
+  SIMPLEXS1,num_groups,0.1,0.5)
+
+src={}
+for g=1,num_groups do
+  src[g] = 0.0
+end
+chiPhysicsMaterialSetProperty(materials[2],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+src[1] = 1.0
+chiPhysicsMaterialSetProperty(materials[1],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+
+--############################################### Setup Physics
+pquad0 = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,2, 4)
+
+lbs_block =
+{
+  num_groups = num_groups,
+  groupsets =
+  {
+    {
+      groups_from_to = {0, num_groups-1},
+      angular_quadrature_handle = pquad0,
+      angle_aggregation_type = "polar",
+      angle_aggregation_num_subsets = 1,
+      groupset_num_subsets = 1,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-6,
+      l_max_its = 300,
+      gmres_restart_interval = 100,
+    },
+  },
+  sweep_type = "CBC",
+}
+lbs_options =
+{
+  scattering_order = 1,
+  save_angular_flux = true
+}
+
+phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+lbs.SetOptions(phys1, lbs_options)
+
+--############################################### Initialize and Execute Solver
+ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys1})
+
+chiSolverInitialize(ss_solver)
+chiSolverExecute(ss_solver)
+
+--############################################### Get field functions
+fflist,count = chiLBSGetScalarFieldFunctionList(phys1)
+
+pp1 = chi.CellVolumeIntegralPostProcessor.Create
+({
+  name="avg-grp0",
+  field_function = fflist[1],
+  compute_volume_average = true,
+  print_numeric_format = "scientific"
+})
+pp2 = chi.CellVolumeIntegralPostProcessor.Create
+({
+  name="avg-grp1",
+  field_function = fflist[2],
+  compute_volume_average = true,
+  print_numeric_format = "scientific"
+})
+chi.ExecutePostProcessors({ pp1, pp2 })
+
+chiLogPrintTimingGraph()
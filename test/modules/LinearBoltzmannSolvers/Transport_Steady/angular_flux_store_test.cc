@@ -0,0 +1,156 @@
+#include "A_LBSSolver/Tools/lbs_angular_flux_store.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+
+#include <random>
+
+namespace chi_unit_tests
+{
+
+chi::ParameterBlock AngularFluxStoreTest(const chi::InputParameters&);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/AngularFluxStoreTest,
+                        /*syntax_function=*/nullptr,
+                        /*actual_function=*/AngularFluxStoreTest);
+
+namespace
+{
+/**Applies the same stores to an AngularFluxStore and a reference vector
+ * and returns the number of values that Load, Get or Assign report
+ * differently from the reference, rounded to the precision of the mode.*/
+size_t CheckStorageMode(lbs::AngularFluxStorageMode mode)
+{
+  typedef lbs::AngularFluxStore Store;
+  const size_t B = Store::BLOCK_SIZE;
+  // Two and a half blocks, the last one partial
+  const size_t size = 2 * B + B / 2 + 7;
+
+  Store store(mode, size);
+  std::vector<double> reference(size, 0.0);
+
+  std::mt19937_64 generator(1234);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  auto StoreRange = [&](size_t offset, std::vector<double> values)
+  {
+    store.Store(offset, values.size(), values.data());
+    std::copy(values.begin(), values.end(), reference.begin() + offset);
+  };
+  auto Random = [&](size_t count)
+  {
+    std::vector<double> values(count);
+    for (double& value : values)
+      value = distribution(generator);
+    return values;
+  };
+  auto Constant = [](size_t count, double value)
+  { return std::vector<double>(count, value); };
+
+  auto Rounded = [mode](double value)
+  {
+    if (mode == lbs::AngularFluxStorageMode::SINGLE)
+      return static_cast<double>(static_cast<float>(value));
+    return value;
+  };
+
+  size_t num_errors = 0;
+  auto CheckRange = [&](size_t offset, size_t count)
+  {
+    std::vector<double> values(count, -1.0);
+    store.Load(offset, count, values.data());
+    for (size_t i = 0; i < count; ++i)
+      if (values[i] != Rounded(reference[offset + i])) ++num_errors;
+  };
+  auto CheckAll = [&]()
+  {
+    CheckRange(0, size);
+    // Ranges straddling the block boundaries
+    CheckRange(B - 3, 6);
+    CheckRange(2 * B - 1, B / 2);
+    CheckRange(B / 2, 2 * B);
+    for (size_t i : {size_t(0), B - 1, B, 2 * B, size - 1})
+      if (store.Get(i) != Rounded(reference[i])) ++num_errors;
+  };
+
+  //============================================= Partial stores straddling
+  //                                              block boundaries
+  StoreRange(B - 10, Random(30));
+  StoreRange(2 * B - 5, Random(B / 2));
+  CheckAll();
+
+  //============================================= Whole blocks, including the
+  //                                              partial last block
+  StoreRange(B, Random(B));
+  StoreRange(2 * B, Constant(size - 2 * B, 0.25));
+  CheckAll();
+
+  //============================================= Partial store into a block
+  //                                              that was just loaded
+  CheckRange(0, 10);
+  StoreRange(5, Random(20));
+  CheckAll();
+
+  //============================================= A block of zeros, then a
+  //                                              partial store into it
+  StoreRange(B, Constant(B, 0.0));
+  CheckAll();
+  StoreRange(B + B / 2, Random(3));
+  CheckAll();
+
+  //============================================= Assign, move and zero
+  const auto values = Random(size);
+  store.Assign(values);
+  reference = values;
+  CheckAll();
+
+  Store other(lbs::AngularFluxStorageMode::DOUBLE, size);
+  const auto other_values = Random(size);
+  other.Assign(other_values);
+  store.Assign(other);
+  reference = other_values;
+  CheckAll();
+
+  Store moved(std::move(store));
+  store = std::move(moved);
+  if (store.Mode() != mode or store.Size() != size) ++num_errors;
+  CheckAll();
+
+  store.SetZero();
+  std::fill(reference.begin(), reference.end(), 0.0);
+  CheckAll();
+
+  return num_errors;
+}
+} // namespace
+
+/**Checks Load, Store, Get and Assign of every angular flux storage mode
+ * on ranges that straddle the compressed block boundaries.*/
+chi::ParameterBlock AngularFluxStoreTest(const chi::InputParameters&)
+{
+  typedef lbs::AngularFluxStorageMode Mode;
+
+  size_t total_num_errors = 0;
+  for (const auto& [mode, name] :
+       std::vector<std::pair<Mode, std::string>>{{Mode::DOUBLE, "double"},
+                                                 {Mode::SINGLE, "single"},
+                                                 {Mode::COMPRESSED,
+                                                  "compressed"},
+                                                 {Mode::MAPPED, "mapped"}})
+  {
+    const size_t num_errors = CheckStorageMode(mode);
+    Chi::log.Log() << "AngularFluxStoreTest " << name
+                   << " num_errors=" << num_errors;
+    total_num_errors += num_errors;
+  }
+
+  Chi::log.Log() << "AngularFluxStoreTest total_num_errors="
+                 << total_num_errors;
+
+  return chi::ParameterBlock{};
+}
+
+} // namespace chi_unit_tests
@@ -0,0 +1,3 @@
+-- Unit test of lbs::AngularFluxStore in every storage mode.
+-- Test: AngularFluxStoreTest total_num_errors=0
+chi_unit_tests.AngularFluxStoreTest()
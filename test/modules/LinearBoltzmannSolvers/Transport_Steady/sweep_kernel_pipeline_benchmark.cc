@@ -0,0 +1,116 @@
+#include "B_DiscreteOrdinatesSolver/lbs_discrete_ordinates_solver.h"
+#include "B_DiscreteOrdinatesSolver/IterativeMethods/sweep_wgs_context.h"
+#include "B_DiscreteOrdinatesSolver/SweepChunks/SweepChunk.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+
+#include <petscksp.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace chi_unit_tests
+{
+
+chi::InputParameters SweepKernelPipelineBenchmarkSyntax();
+chi::ParameterBlock
+SweepKernelPipelineBenchmark(const chi::InputParameters& input_parameters);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/SweepKernelPipelineBenchmark,
+                        /*syntax_function=*/SweepKernelPipelineBenchmarkSyntax,
+                        /*actual_function=*/SweepKernelPipelineBenchmark);
+
+chi::InputParameters SweepKernelPipelineBenchmarkSyntax()
+{
+  chi::InputParameters params;
+
+  params.AddRequiredParameterBlock("arg0", "General parameters");
+
+  return params;
+}
+
+/**Sweeps the first groupset of an initialized discrete ordinates solver
+ * repeatedly, once with the compile-time kernel pipeline and once with the
+ * named kernels, and reports the average sweep time of both. The two
+ * resulting scalar fluxes must agree.*/
+chi::ParameterBlock
+SweepKernelPipelineBenchmark(const chi::InputParameters& input_parameters)
+{
+  typedef lbs::SweepWGSContext<Mat, Vec, KSP> SweepWGSContext;
+
+  const chi::ParameterBlock& params = input_parameters.GetParam("arg0");
+
+  const size_t solver_handle = params.GetParamValue<size_t>("solver_handle");
+  const int num_sweeps = params.Has("num_sweeps")
+                           ? params.GetParamValue<int>("num_sweeps")
+                           : 10;
+
+  auto& solver = Chi::GetStackItem<lbs::DiscreteOrdinatesSolver>(
+    Chi::object_stack, solver_handle, __FUNCTION__);
+
+  ChiLogicalErrorIf(solver.GetWGSSolvers().empty(),
+                    "The solver must be initialized.");
+
+  auto context = std::dynamic_pointer_cast<SweepWGSContext>(
+    solver.GetWGSSolvers().front()->GetContext());
+  ChiLogicalErrorIf(not context, "The solver does not use sweeps.");
+
+  auto sweep_chunk = std::dynamic_pointer_cast<lbs::SweepChunk>(
+    context->sweep_chunk_);
+  ChiLogicalErrorIf(not sweep_chunk, "Unsupported sweep chunk type.");
+
+  auto& sweep_scheduler = context->sweep_scheduler_;
+  auto& phi = solver.PhiNewLocal();
+  sweep_scheduler.SetDestinationPhi(phi);
+
+  auto TimeSweeps = [&](bool force_named_kernels)
+  {
+    sweep_chunk->SetForceNamedKernels(force_named_kernels);
+
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int s = 0; s < num_sweeps; ++s)
+    {
+      sweep_scheduler.ZeroIncomingDelayedPsi();
+      sweep_scheduler.ZeroOutputFluxDataStructures();
+      sweep_scheduler.Sweep();
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double>(t1 - t0).count() / num_sweeps;
+  };
+
+  const double time_named = TimeSweeps(true);
+  const std::vector<double> phi_named = phi;
+
+  const double time_static = TimeSweeps(false);
+  const std::vector<double> phi_static = phi;
+
+  sweep_chunk->SetForceNamedKernels(false);
+
+  double max_rel_diff = 0.0;
+  for (size_t i = 0; i < phi_static.size(); ++i)
+  {
+    const double scale = std::max(std::fabs(phi_named[i]), 1.0e-12);
+    max_rel_diff = std::max(max_rel_diff,
+                            std::fabs(phi_static[i] - phi_named[i]) / scale);
+  }
+
+  Chi::log.Log() << "Named kernels average sweep time (s):   " << time_named;
+  Chi::log.Log() << "Kernel pipeline average sweep time (s): " << time_static;
+  Chi::log.Log() << "Speedup: " << time_named / time_static;
+
+  if (max_rel_diff < 1.0e-10)
+    Chi::log.Log() << "SweepKernelPipelineBenchmark results identical";
+  else
+    Chi::log.Log() << "SweepKernelPipelineBenchmark results differ "
+                   << max_rel_diff;
+
+  return chi::ParameterBlock{};
+}
+
+} // namespace chi_unit_tests
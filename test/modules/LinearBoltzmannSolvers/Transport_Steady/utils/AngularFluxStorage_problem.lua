@@ -0,0 +1,145 @@
+-- Problem shared by the Transport2D_7*_AngularFluxStorage tests.
+-- Defines CompareStorageToDouble(storage) which solves the problem once
+-- with a single groupset and double precision angular flux storage, and
+-- once with two groupsets and the given angular_flux_storage. It prints the
+-- maximum relative differences of the group scalar fluxes and of the XMAX
+-- leakage of every group. The leakage of the second groupset checks that
+-- the angular fluxes are indexed by the group's position in the groupset.
+
+--############################################### Setup mesh
+nodes={}
+N=20
+L=100
+xmin = -L/2
+dx = L/N
+for i=1,(N+1) do
+  k=i-1
+  nodes[i] = xmin + k*dx
+end
+
+meshgen1 = chi_mesh.OrthogonalMeshGenerator.Create({ node_sets = {nodes,nodes} })
+chi_mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+chiVolumeMesherSetMatIDToAll(0)
+
+vol1 = chi_mesh.RPPLogicalVolume.Create
+({ xmin=-10.0,xmax=10.0,ymin=-10.0,ymax=10.0, infz=true })
+chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol1,1)
+
+--############################################### Add materials
+materials = {}
+materials[1] = chiPhysicsAddMaterial("Test Material");
+materials[2] = chiPhysicsAddMaterial("Test Material2");
+
+chiPhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+chiPhysicsMaterialAddProperty(materials[2],TRANSPORT_XSECTIONS)
+
+chiPhysicsMaterialAddProperty(materials[1],ISOTROPIC_MG_SOURCE)
+chiPhysicsMaterialAddProperty(materials[2],ISOTROPIC_MG_SOURCE)
+
+num_groups = 4
+chiPhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+  SIMPLEXS1,num_groups,1.0,0.9)
+chiPhysicsMaterialSetProperty(materials[2],TRANSPORT_XSECTIONS,
+  SIMPLEXS1,num_groups,0.1,0.5)
+
+src={}
+for g=1,num_groups do
+  src[g] = 0.0
+end
+chiPhysicsMaterialSetProperty(materials[1],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+src[1] = 1.0
+chiPhysicsMaterialSetProperty(materials[2],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+
+--############################################### Setup Physics
+pquad0 = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,2, 2,false)
+chiOptimizeAngularQuadratureForPolarSymmetry(pquad0, 4.0*math.pi)
+
+XMAX = 0
+
+function MakeGroupset(first_group, last_group)
+  return
+  {
+    groups_from_to = {first_group, last_group},
+    angular_quadrature_handle = pquad0,
+    angle_aggregation_num_subsets = 1,
+    groupset_num_subsets = 1,
+    inner_linear_method = "gmres",
+    l_abs_tol = 1.0e-10,
+    l_max_its = 300,
+    gmres_restart_interval = 100,
+  }
+end
+
+-- Returns the volume averaged scalar flux and the XMAX leakage per group
+function SolveCase(case_name, storage, groupset_ranges)
+  local groupsets = {}
+  for i,range in ipairs(groupset_ranges) do
+    groupsets[i] = MakeGroupset(range[1], range[2])
+  end
+
+  local phys = lbs.DiscreteOrdinatesSolver.Create
+  ({
+    num_groups = num_groups,
+    groupsets = groupsets,
+  })
+  lbs.SetOptions(phys,
+  {
+    scattering_order = 1,
+    save_angular_flux = true,
+    angular_flux_storage = storage,
+  })
+
+  local ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys})
+
+  chiSolverInitialize(ss_solver)
+  chiSolverExecute(ss_solver)
+
+  local fflist,count = chiLBSGetScalarFieldFunctionList(phys)
+
+  local phi_avg = {}
+  for g=0,num_groups-1 do
+    local pp = chi.CellVolumeIntegralPostProcessor.Create
+    ({
+      name = case_name.."-phi-avg-grp"..tostring(g),
+      field_function = fflist[g+1],
+      compute_volume_average = true,
+      print_numeric_format = "scientific"
+    })
+    chi.ExecutePostProcessors({ pp })
+    phi_avg[g+1] = chi.PostProcessorGetValue(pp)
+  end
+
+  local leakage = {}
+  for gs=0,#groupset_ranges-1 do
+    local gs_leakage = chiLBSComputeLeakage(phys, gs, XMAX)
+    for _,value in ipairs(gs_leakage) do
+      leakage[#leakage+1] = value
+    end
+  end
+
+  return phi_avg, leakage
+end
+
+function MaxRelDiff(values, reference_values)
+  local max_rel_diff = 0.0
+  for i=1,#reference_values do
+    local rel_diff = math.abs(values[i] - reference_values[i]) /
+                     math.abs(reference_values[i])
+    max_rel_diff = math.max(max_rel_diff, rel_diff)
+  end
+  return max_rel_diff
+end
+
+function CompareStorageToDouble(storage)
+  local ref_phi, ref_leakage =
+    SolveCase("double", "double", {{0, num_groups-1}})
+  local phi, leakage =
+    SolveCase(storage, storage, {{0, 1}, {2, num_groups-1}})
+
+  chiLog(LOG_0, string.format("%s_phi_max_rel_diff=%.6e",
+                              storage, MaxRelDiff(phi, ref_phi)))
+  chiLog(LOG_0, string.format("%s_leakage_max_rel_diff=%.6e",
+                              storage, MaxRelDiff(leakage, ref_leakage)))
+end
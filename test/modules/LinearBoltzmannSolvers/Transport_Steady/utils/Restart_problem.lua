@@ -0,0 +1,125 @@
+-- Problem shared by the Transport2D_6*_Restart tests. Expects the globals
+--   restart_partitioner   handle of the partitioner to use,
+--   restart_num_groups    number of groups,
+--   restart_single_sweep  if true, the groupset does a single Richardson
+--                         iteration, i.e., a single sweep from phi_old,
+--   restart_options       table of additional lbs options.
+-- Creates the solver ss_solver, executes it and computes the volume average
+-- of the group 0 scalar flux, restart_phi_avg.
+restart_folder = "YRestart6"
+restart_values_file = restart_folder.."/Transport2D_6a_values.txt"
+
+--############################################### Setup mesh
+nodes={}
+N=20
+L=100
+xmin = -L/2
+dx = L/N
+for i=1,(N+1) do
+  k=i-1
+  nodes[i] = xmin + k*dx
+end
+
+meshgen1 = chi_mesh.OrthogonalMeshGenerator.Create
+({
+  node_sets = {nodes,nodes},
+  partitioner = restart_partitioner,
+})
+chi_mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+chiVolumeMesherSetMatIDToAll(0)
+
+vol1 = chi_mesh.RPPLogicalVolume.Create
+({ xmin=-10.0,xmax=10.0,ymin=-10.0,ymax=10.0, infz=true })
+chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol1,1)
+
+--############################################### Add materials
+materials = {}
+materials[1] = chiPhysicsAddMaterial("Test Material");
+materials[2] = chiPhysicsAddMaterial("Test Material2");
+
+chiPhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+chiPhysicsMaterialAddProperty(materials[2],TRANSPORT_XSECTIONS)
+
+chiPhysicsMaterialAddProperty(materials[1],ISOTROPIC_MG_SOURCE)
+chiPhysicsMaterialAddProperty(materials[2],ISOTROPIC_MG_SOURCE)
+
+num_groups = restart_num_groups
+chiPhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+  SIMPLEXS1,num_groups,1.0,0.9)
+chiPhysicsMaterialSetProperty(materials[2],TRANSPORT_XSECTIONS,
+  SIMPLEXS1,num_groups,0.1,0.5)
+
+src={}
+for g=1,num_groups do
+  src[g] = 0.0
+end
+chiPhysicsMaterialSetProperty(materials[1],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+src[1] = 1.0
+chiPhysicsMaterialSetProperty(materials[2],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+
+--############################################### Setup Physics
+pquad0 = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,2, 2,false)
+chiOptimizeAngularQuadratureForPolarSymmetry(pquad0, 4.0*math.pi)
+
+groupset =
+{
+  groups_from_to = {0, num_groups-1},
+  angular_quadrature_handle = pquad0,
+  angle_aggregation_num_subsets = 1,
+  groupset_num_subsets = 1,
+  inner_linear_method = "gmres",
+  l_abs_tol = 1.0e-10,
+  l_max_its = 300,
+  gmres_restart_interval = 100,
+}
+if (restart_single_sweep) then
+  groupset.inner_linear_method = "richardson"
+  groupset.l_max_its = 1
+end
+
+phys1 = lbs.DiscreteOrdinatesSolver.Create
+({
+  num_groups = num_groups,
+  groupsets = { groupset },
+})
+
+lbs_options = restart_options
+lbs_options.scattering_order = 1
+lbs_options.save_angular_flux = true
+lbs.SetOptions(phys1, lbs_options)
+
+--############################################### Initialize and Execute Solver
+ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys1})
+
+chiSolverInitialize(ss_solver)
+chiSolverExecute(ss_solver)
+
+--############################################### Post-processing
+fflist,count = chiLBSGetScalarFieldFunctionList(phys1)
+
+pp1 = chi.CellVolumeIntegralPostProcessor.Create
+({
+  name="phi-avg-grp0",
+  field_function = fflist[1],
+  compute_volume_average = true,
+  print_numeric_format = "scientific"
+})
+chi.ExecutePostProcessors({ pp1 })
+
+restart_phi_avg = chi.PostProcessorGetValue(pp1)
+
+--############################################### Compares to the writer
+-- Prints the relative difference between the flux after a single sweep from
+-- the restored phi_old and the converged flux of the writer. A failed
+-- restore starts from zero, in which case a single sweep is far off.
+function CompareRestoredFlux()
+  local file = io.open(restart_values_file, "r")
+  local written_phi_avg = file:read("*n")
+  file:close()
+
+  local rel_diff = math.abs(restart_phi_avg - written_phi_avg) /
+                   math.abs(written_phi_avg)
+  chiLog(LOG_0, string.format("restart_rel_diff=%.6e", rel_diff))
+end